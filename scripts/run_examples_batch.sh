@@ -0,0 +1,78 @@
+#!/bin/bash
+
+# Run the examples of run_examples.sh in one CAnalyzer process (batch mode)
+
+CANALYZER_HOME=`pwd`
+
+TESTDATA=$CANALYZER_HOME/testdata
+OUTPUT=$CANALYZER_HOME/dry_run
+FILELIST=$OUTPUT/examples.lst
+
+mkdir -p $OUTPUT
+
+cat > $FILELIST <<END_OF_LIST
+$TESTDATA/prg1.c
+$TESTDATA/prg2.c
+$TESTDATA/prg3.c
+$TESTDATA/continue.c
+$TESTDATA/test-if_only_if_no_else.c
+$TESTDATA/test-if_only_if_and_else.c
+$TESTDATA/test-if_if_else_ladder.c
+$TESTDATA/test-if_inside_if.c
+$TESTDATA/test-if_after_if.c
+$TESTDATA/test_while.c
+$TESTDATA/test_for.c
+$TESTDATA/test_for_simple.c
+$TESTDATA/test_while_simple.c
+$TESTDATA/test_do_while.c
+$TESTDATA/test_do_while_simple.c
+$TESTDATA/test_nested_while.c
+$TESTDATA/test_if_in_do_while.c
+$TESTDATA/test_if_in_while_in_if.c
+$TESTDATA/test_while_in_for.c
+$TESTDATA/nomain.c
+$TESTDATA/test_only_arithmatic_binary_ops.c
+$TESTDATA/p1.c
+$TESTDATA/p2.c
+$TESTDATA/test_only_asg.c
+$TESTDATA/globalvar.c
+$TESTDATA/test-if_relational_op.c
+$TESTDATA/test-if_true_condition.c
+$TESTDATA/test_cond_in_loop.c
+$TESTDATA/test_while1.c
+$TESTDATA/test_const.c
+$TESTDATA/test_uo_logicalnot.c
+$TESTDATA/test_unary.c
+$TESTDATA/test-addExpr.c
+$TESTDATA/test_initial_values.c
+$TESTDATA/test_incrdecr.c
+$TESTDATA/test_incr_new.c
+$TESTDATA/test_incdec.c
+$TESTDATA/test_incr_condition.c
+$TESTDATA/test-ICE.c
+$TESTDATA/test-CompAssign.c
+$TESTDATA/test_decl_with_expr_assignment.c
+$TESTDATA/test-paren-for-decl.c
+$TESTDATA/test-paren-for-assignment.c
+$TESTDATA/test_fun_param.c
+$TESTDATA/test_uint.c
+$TESTDATA/test_only_cascaded_asgn.c
+$TESTDATA/test_only_opeq.c
+$TESTDATA/test_only_opincr.c
+$TESTDATA/test_no_if.c
+$TESTDATA/test_only_while_comp_stmt.c
+$TESTDATA/test_while_2relop_cond.c
+$TESTDATA/dowhile.c
+$TESTDATA/empty_if.c
+$TESTDATA/arr1.c
+$TESTDATA/struct1.c
+END_OF_LIST
+
+echo -e "\nRunning example test cases in batch mode ... \n\n"
+
+$CANALYZER_HOME/bin/CAnalyzer --batch $FILELIST $OUTPUT
+
+echo -e "\n[Done]\n"
+
+echo -e "\nErrors/Warnings:\n"
+grep -i "error" $OUTPUT/*.txt; grep -i "warning" $OUTPUT/*.txt; grep -i "stack" $OUTPUT/*.txt; grep -i "segmentation" $OUTPUT/*.txt; grep -i "Aborted" $OUTPUT/*.txt
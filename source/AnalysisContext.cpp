@@ -0,0 +1,128 @@
+//
+// AnalysisContext.cpp
+//
+
+/// \file
+/// \brief Defines AnalysisContext - all state needed to analyze one function
+/// (CFG traversal, Apron and statement processing state)
+///
+#include <stdlib.h>
+
+#include "AnalysisContext.h"
+
+/// \brief Context of the function being analyzed by current thread
+static __thread AnalysisContext* s_currentContext = NULL;
+
+/// \brief Create empty context for a function
+AnalysisContext::AnalysisContext(const FunctionOptions& functionOptions)
+  : exprStack(ArenaAllocator<MyApronExpr>(&arena)),
+    condStack(ArenaAllocator<CondExprCons>(&arena))
+{
+  options = functionOptions;
+  NumUnrollings = functionOptions.numUnrollings;
+
+  blocksToVisit = NULL;
+  entryBlock = NULL;
+  exitBlock = NULL;
+  numWideningDone = 0;
+  numBlocksProcessed = 0;
+
+  man = NULL;
+  AbsValPtr = NULL;
+  AbstractMemoryPtr = NULL;
+  tempVarPool.numUsed = 0;
+  recordingProgram = NULL;
+  envVersion = 0;
+  recordingEnvVersion = 0;
+  expr_type = 0;
+
+  isCascadedAssign = false;
+  assignCount = 0;
+}
+
+/// \brief Free everything allocated for the function
+///
+/// Abstract values of MyCFGInfo records, AbstractMemory and the environment
+/// are freed by their owners (see ApronWrappers.h).
+AnalysisContext::~AnalysisContext()
+{
+  clearCachedTransfers();
+
+  delete recordingProgram;
+
+  for (int i = 0; i < myEdgeStructList.size(); i++)
+  {
+    delete myEdgeStructList[i];
+  }
+
+  for (int i = 0; i < globalBlockList.size(); i++)
+  {
+    delete globalBlockList[i];
+  }
+
+  delete [] blocksToVisit;
+
+  for (int i = 0; i < globalVarList.size(); i++)
+  {
+    // varName and varType are allocated by strdup()
+    free((void *) globalVarList[i]->varName);
+    free((void *) globalVarList[i]->varType);
+    delete globalVarList[i];
+  }
+
+  if (AbsValPtr)
+  {
+    // AbsVal is empty after last block moved it into its MyCFGInfo
+    if (AbsValPtr->abstract_value.abstract0 != NULL)
+    {
+      ap_abstract1_clear(man, &(AbsValPtr->abstract_value));
+    }
+
+    delete AbsValPtr;
+  }
+
+  delete AbstractMemoryPtr;
+}
+
+/// \brief Delete transfer programs and condition constraints cached for
+/// blocks
+void AnalysisContext::clearCachedTransfers()
+{
+  for (int i = 0; i < myCFGInfoList.size(); i++)
+  {
+    if (myCFGInfoList[i].condCons != NULL)
+    {
+      clearCondExprCons(myCFGInfoList[i].condCons);
+      delete myCFGInfoList[i].condCons;
+      myCFGInfoList[i].condCons = NULL;
+    }
+
+    delete myCFGInfoList[i].transferProgram;
+    myCFGInfoList[i].transferProgram = NULL;
+  }
+}
+
+/// \brief Get context of the function being analyzed by current thread
+AnalysisContext* AnalysisContext::getCurrent()
+{
+  return s_currentContext;
+}
+
+/// \brief Set context of the function being analyzed by current thread
+void AnalysisContext::setCurrent(AnalysisContext* context)
+{
+  s_currentContext = context;
+}
+
+/// \brief Set context as current
+AnalysisContextScope::AnalysisContextScope(AnalysisContext* context)
+{
+  m_previous = AnalysisContext::getCurrent();
+  AnalysisContext::setCurrent(context);
+}
+
+/// \brief Restore previous context
+AnalysisContextScope::~AnalysisContextScope()
+{
+  AnalysisContext::setCurrent(m_previous);
+}
@@ -0,0 +1,194 @@
+//
+// AnalysisContext.h
+//
+
+/// \file
+/// \brief Defines AnalysisContext - all state needed to analyze one function
+/// (CFG traversal, Apron and statement processing state)
+///
+#include <vector>
+
+#ifndef ANALYSISCONTEXT_H
+# define ANALYSISCONTEXT_H
+
+#include "MyASTVisitor.h"
+#include "Apron.h"
+#include "EdgeIndex.h"
+#include "LoopForest.h"
+#include "WeakTopologicalOrder.h"
+
+/// \brief State of the analysis of one function
+///
+/// An AnalysisContext is created when analysis of a function begins and is
+/// destroyed when it ends, so nothing of a function is visible to the next
+/// one. MyASTVisitor and MyCFG hold a pointer to the context, free functions
+/// in Apron.cpp and MyProcessStmt get it from AnalysisContext::getCurrent()
+/// which is set per thread.
+class AnalysisContext
+{
+  public:
+
+    /// \brief Create empty context for a function
+    /// @param options - options to analyze the function with
+    AnalysisContext(const FunctionOptions& options);
+
+    /// \brief Free everything allocated for the function
+    ~AnalysisContext();
+
+    /// \brief Delete transfer programs and condition constraints cached for
+    /// blocks, e.g. when their dimensions are not valid anymore
+    /// @return void (nothing)
+    void clearCachedTransfers();
+
+    /// \brief Get context of the function being analyzed by current thread
+    /// @return AnalysisContext* - current context, NULL outside a function
+    static AnalysisContext* getCurrent();
+
+    /// \brief Set context of the function being analyzed by current thread
+    /// @param context - context to be set as current
+    /// @return void (nothing)
+    static void setCurrent(AnalysisContext* context);
+
+    /// \brief Options to analyze the function with
+    FunctionOptions options;
+
+    /// \brief Number of times loop unrolling to be done to delay widening
+    int NumUnrollings;
+
+    // CFG traversal state (MyASTVisitor.cpp)
+
+    /// \brief Table of MyCFGInfo records indexed by block id
+    MyCFGInfoList myCFGInfoList;
+
+    /// \brief List of edges in the top-down flow graph
+    edgeStructList myEdgeStructList;
+
+    /// \brief Successor / predecessor edges and back edges of every block
+    EdgeIndex edgeIndex;
+
+    /// \brief Keep track of blocks to visit
+    int* blocksToVisit;
+
+    /// \brief Block structures indexed by block id
+    t_blockStructList globalBlockList;
+
+    /// \brief Loop-nesting forest of CFG, owns the loops
+    LoopForest loopForest;
+
+    /// \brief Weak topological order of CFG blocks, the iteration strategy
+    WeakTopologicalOrder wto;
+
+    /// \brief CFG block list to traverse (flattened weak topological order)
+    std::vector<clang::CFGBlock *> blockList;
+
+    /// \brief Entry and exit blocks of CFG
+    clang::CFGBlock* entryBlock;
+    clang::CFGBlock* exitBlock;
+
+    /// \brief Bitset of block ids reachable from entry block
+    std::vector<bool> reachableBlocks;
+
+    /// \brief Number of widenings applied at component heads
+    int numWideningDone;
+
+    /// \brief Number of blocks analyzed (processBlock() calls), to compare
+    /// iteration engines
+    int numBlocksProcessed;
+
+    /// \brief Successors of predecessors of every block, indexed by block
+    /// id, entries of a block are replaced on each visit of the block
+    std::vector<MySuccOfPredInfoList> SuccOfPredInfo;
+
+    // Apron state (Apron.cpp)
+
+    /// \brief Apron manager (not owned, see getApronManager())
+    ap_manager_t* man;
+
+    /// \brief Apron environment
+    Environment env;
+
+    /// \brief Pointer to structre to hold abstract value
+    AbsVal* AbsValPtr;
+
+    /// \brief Pointer to structure to store Abstract Memory
+    AbstractMemory* AbstractMemoryPtr;
+
+    /// \brief Temporary variables reserved in environment
+    TempVarPool tempVarPool;
+
+    /// \brief Transfer program being recorded (see startTransferRecording()),
+    /// NULL if none
+    TransferProgram* recordingProgram;
+
+    /// \brief Number of changes of environment; dimensions of cached
+    /// transfer programs and condition constraints are valid only on the
+    /// environment they were made on (see setEnvironment() in Apron.cpp)
+    unsigned envVersion;
+
+    /// \brief envVersion when recording started, program is dropped if
+    /// environment changes
+    unsigned recordingEnvVersion;
+
+    /// \brief Apron type (int/real) of current expression
+    int expr_type;
+
+    /// \brief Vector containg pointers to VariableCount Structure (owns the
+    /// symbols of the function)
+    VariableCountList globalVarList;
+
+    /// \brief Symbol of every variable declaration seen in the function
+    VariableSymbolTable varSymbols;
+
+    /// \brief Symbols of globalVarList by name, declarations with the same
+    /// name share one symbol
+    VariableNameTable varNames;
+
+    /// \brief Variables of globalVarList with a count set since counts were
+    /// last applied (see updateAbsValFromGlobalVarList())
+    VariableCountList pendingCountVars;
+
+    /// \brief Arena for data of current statement (see resetStatementArena())
+    StatementArena arena;
+
+    /// \brief MyApronExpr list
+    MyApronExprStack exprStack;
+
+    /// \brief CondExprCons list
+    CondExprConsStack condStack;
+
+    // Statement processing state (MyProcessStmt.cpp)
+
+    /// \brief Flag to indicate if current expression is compound expression
+    bool isCascadedAssign;
+
+    /// \brief Count number of assignments in a statement
+    /// (required for cascaded assignments)
+    int assignCount;
+
+  private:
+
+    // Context owns lists and pointers above, it must not be copied
+    AnalysisContext(const AnalysisContext&);
+    AnalysisContext& operator=(const AnalysisContext&);
+};
+
+/// \brief Set an AnalysisContext as current for the lifetime of this object
+/// and restore previous one on destruction
+class AnalysisContextScope
+{
+  public:
+
+    /// \brief Set context as current
+    /// @param context - context to be set as current
+    AnalysisContextScope(AnalysisContext* context);
+
+    /// \brief Restore previous context
+    ~AnalysisContextScope();
+
+  private:
+
+    /// \brief Context which was current before
+    AnalysisContext* m_previous;
+};
+
+#endif // ANALYSISCONTEXT_H
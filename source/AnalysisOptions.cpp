@@ -0,0 +1,453 @@
+//
+// AnalysisOptions.cpp
+//
+
+/// \file
+/// \brief Defines analysis options (abstract domain, loop unrollings,
+/// verbosity, iteration engine, output format and per-function overrides)
+/// filled from command line or a config file
+///
+#include <climits>
+#include <fstream>
+#include <stdlib.h>
+#include <string.h>
+
+#include "AnalysisOptions.h"
+
+/// \brief Remove leading and trailing white space from a string
+/// @param str - string to trim
+/// @return std::string - trimmed string
+static std::string trim(const std::string& str)
+{
+  size_t first = str.find_first_not_of(" \t\r\n");
+
+  if (first == std::string::npos)
+  {
+    return "";
+  }
+
+  size_t last = str.find_last_not_of(" \t\r\n");
+
+  return str.substr(first, last - first + 1);
+}
+
+/// \brief Convert string to non-negative integer
+/// @param str - string to convert
+/// @param value - converted value
+/// @return bool - true if str is a non-negative integer not above INT_MAX,
+/// false otherwise
+static bool toNonNegativeInt(const std::string& str, int& value)
+{
+  if (str.empty())
+  {
+    return false;
+  }
+
+  char* end = NULL;
+  long v = strtol(str.c_str(), &end, 10);
+
+  // out of range values (strtol() saturates at LONG_MAX) do not fit in int
+  if (*end != '\0' || v < 0 || v > INT_MAX)
+  {
+    return false;
+  }
+
+  value = (int) v;
+
+  return true;
+}
+
+/// \brief Set default options - Box domain, 5 unrollings, verbosity 1,
+/// WTO engine, full output and one analysis thread
+AnalysisOptions::AnalysisOptions()
+{
+  m_defaults.domain = DOMAIN_BOX;
+  m_defaults.numUnrollings = 5;
+  m_defaults.verbosity = 1;
+  m_defaults.engine = ENGINE_WTO;
+
+  m_outputFormat = OUTPUT_FULL;
+  m_numJobs = 1;
+}
+
+/// \brief Get printable name of an abstract domain
+const char* AnalysisOptions::getDomainName(AbstractDomain domain)
+{
+  switch (domain)
+  {
+    case DOMAIN_BOX:
+      return "Box (Interval)";
+    case DOMAIN_OCTAGON:
+      return "Octagon";
+    case DOMAIN_POLYHEDRA:
+      return "Polyhedra";
+    case DOMAIN_DEFAULT:
+      break;
+  }
+
+  return "default";
+}
+
+/// \brief Get printable name of an iteration engine
+const char* AnalysisOptions::getEngineName(IterationEngine engine)
+{
+  switch (engine)
+  {
+    case ENGINE_WTO:
+      return "wto";
+    case ENGINE_WORKLIST:
+      return "worklist";
+    case ENGINE_DEFAULT:
+      break;
+  }
+
+  return "default";
+}
+
+/// \brief Print help for analysis options
+void AnalysisOptions::printHelp(std::ostream& os)
+{
+  os << "Analysis options:\n\n"
+    << "  --domain=box|oct|pk      abstract domain (default box)\n"
+    << "  --unroll=N               loop unrollings before widening (default 5)\n"
+    << "  --verbosity=N            0 quiet, 1 normal, 2 also dump whole CFG\n"
+    << "  --engine=wto|worklist    fixpoint iteration over weak topological\n"
+    << "                           order or with a worklist (default wto)\n"
+    << "  --format=full|summary    print block table after every block or\n"
+    << "                           once per function (default full)\n"
+    << "  --jobs=N                 analyze functions of a file in N threads\n"
+    << "                           (default 1)\n"
+    << "  --config=FILE            read options from FILE\n"
+    << "  --function=NAME:KEY=VALUE[,KEY=VALUE]\n"
+    << "                           override domain/unroll/verbosity/engine\n"
+    << "                           for function NAME\n\n";
+}
+
+/// \brief Get override entry for a function, create if not present
+FunctionOptions& AnalysisOptions::getOverride(const std::string& functionName)
+{
+  std::map<std::string, FunctionOptions>::iterator it;
+
+  it = m_functionOverrides.find(functionName);
+
+  if (it == m_functionOverrides.end())
+  {
+    FunctionOptions notSet;
+
+    notSet.domain = DOMAIN_DEFAULT;
+    notSet.numUnrollings = -1;
+    notSet.verbosity = -1;
+    notSet.engine = ENGINE_DEFAULT;
+
+    it = m_functionOverrides.insert(std::make_pair(functionName, notSet)).first;
+  }
+
+  return it->second;
+}
+
+/// \brief Set one option in options (global or per-function)
+bool AnalysisOptions::setOption(const std::string& key,
+  const std::string& value, FunctionOptions& options, bool isGlobal)
+{
+  if (key == "domain")
+  {
+    if (value == "box" || value == "1")
+    {
+      options.domain = DOMAIN_BOX;
+    }
+    else
+    if (value == "oct" || value == "2")
+    {
+      options.domain = DOMAIN_OCTAGON;
+    }
+    else
+    if (value == "pk" || value == "poly" || value == "3")
+    {
+      options.domain = DOMAIN_POLYHEDRA;
+    }
+    else
+    {
+      std::cout << "\n Invalid value for domain: " << value << "\n";
+      return false;
+    }
+  }
+  else
+  if (key == "unroll")
+  {
+    // at least one unrolling, widening is done every numUnrollings visits
+    if (!toNonNegativeInt(value, options.numUnrollings) ||
+        options.numUnrollings == 0)
+    {
+      std::cout << "\n Invalid value for unroll: " << value << "\n";
+      return false;
+    }
+  }
+  else
+  if (key == "verbosity")
+  {
+    if (!toNonNegativeInt(value, options.verbosity))
+    {
+      std::cout << "\n Invalid value for verbosity: " << value << "\n";
+      return false;
+    }
+  }
+  else
+  if (key == "engine")
+  {
+    if (value == "wto")
+    {
+      options.engine = ENGINE_WTO;
+    }
+    else
+    if (value == "worklist")
+    {
+      options.engine = ENGINE_WORKLIST;
+    }
+    else
+    {
+      std::cout << "\n Invalid value for engine: " << value << "\n";
+      return false;
+    }
+  }
+  else
+  if (key == "format" && isGlobal)
+  {
+    if (value == "full")
+    {
+      m_outputFormat = OUTPUT_FULL;
+    }
+    else
+    if (value == "summary")
+    {
+      m_outputFormat = OUTPUT_SUMMARY;
+    }
+    else
+    {
+      std::cout << "\n Invalid value for format: " << value << "\n";
+      return false;
+    }
+  }
+  else
+  if (key == "jobs" && isGlobal)
+  {
+    if (!toNonNegativeInt(value, m_numJobs) || m_numJobs == 0)
+    {
+      std::cout << "\n Invalid value for jobs: " << value << "\n";
+      return false;
+    }
+  }
+  else
+  {
+    std::cout << "\n Invalid option: " << key << "\n";
+    return false;
+  }
+
+  return true;
+}
+
+/// \brief Parse one command line argument of form --key=value
+bool AnalysisOptions::parseArgument(const char* arg)
+{
+  if (strncmp(arg, "--", 2) != 0)
+  {
+    return false;
+  }
+
+  std::string option = arg + 2;
+  size_t pos = option.find('=');
+
+  if (pos == std::string::npos)
+  {
+    std::cout << "\n Option " << arg << " needs a value\n";
+    return false;
+  }
+
+  std::string key = option.substr(0, pos);
+  std::string value = option.substr(pos + 1);
+
+  if (key == "config")
+  {
+    return parseConfigFile(value.c_str());
+  }
+
+  if (key == "function")
+  {
+    // --function=name:key=value[,key=value...]
+    size_t colon = value.find(':');
+
+    if (colon == std::string::npos || colon == 0)
+    {
+      std::cout << "\n Invalid function override: " << value << "\n";
+      return false;
+    }
+
+    FunctionOptions& functionOverride = getOverride(value.substr(0, colon));
+    std::string settings = value.substr(colon + 1);
+
+    while (!settings.empty())
+    {
+      size_t comma = settings.find(',');
+      std::string setting = settings.substr(0, comma);
+
+      settings = (comma == std::string::npos) ? "" : settings.substr(comma + 1);
+
+      size_t eq = setting.find('=');
+
+      if (eq == std::string::npos ||
+          !setOption(setting.substr(0, eq), setting.substr(eq + 1),
+            functionOverride, false))
+      {
+        std::cout << "\n Invalid function override: " << value << "\n";
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  return setOption(key, value, m_defaults, true);
+}
+
+/// \brief Read options from config file
+bool AnalysisOptions::parseConfigFile(const char* fileName)
+{
+  std::ifstream configFile(fileName);
+
+  if (!configFile)
+  {
+    std::cout << "\n Could not open config file " << fileName << "\n";
+    return false;
+  }
+
+  // options of current section, global options until first [function]
+  FunctionOptions* current = &m_defaults;
+  bool isGlobal = true;
+
+  std::string line;
+  int lineNo = 0;
+
+  while (std::getline(configFile, line))
+  {
+    lineNo++;
+    line = trim(line);
+
+    if (line.empty() || line[0] == '#')
+    {
+      continue;
+    }
+
+    if (line[0] == '[')
+    {
+      // section "[function name]"
+      size_t end = line.find(']');
+      std::string section = trim(line.substr(1,
+        (end == std::string::npos) ? std::string::npos : end - 1));
+
+      if (end == std::string::npos || section.compare(0, 9, "function ") != 0)
+      {
+        std::cout << "\n " << fileName << ":" << lineNo
+          << ": invalid section " << line << "\n";
+        return false;
+      }
+
+      current = &getOverride(trim(section.substr(9)));
+      isGlobal = false;
+
+      continue;
+    }
+
+    size_t eq = line.find('=');
+
+    if (eq == std::string::npos ||
+        !setOption(trim(line.substr(0, eq)), trim(line.substr(eq + 1)),
+          *current, isGlobal))
+    {
+      std::cout << "\n " << fileName << ":" << lineNo
+        << ": invalid line " << line << "\n";
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/// \brief Get options for a function, i.e. global options with
+/// overrides given for this function applied on top
+FunctionOptions AnalysisOptions::getFunctionOptions(
+  const std::string& functionName) const
+{
+  FunctionOptions options = m_defaults;
+
+  std::map<std::string, FunctionOptions>::const_iterator it;
+
+  it = m_functionOverrides.find(functionName);
+
+  if (it != m_functionOverrides.end())
+  {
+    if (it->second.domain != DOMAIN_DEFAULT)
+    {
+      options.domain = it->second.domain;
+    }
+
+    if (it->second.numUnrollings >= 0)
+    {
+      options.numUnrollings = it->second.numUnrollings;
+    }
+
+    if (it->second.verbosity >= 0)
+    {
+      options.verbosity = it->second.verbosity;
+    }
+
+    if (it->second.engine != ENGINE_DEFAULT)
+    {
+      options.engine = it->second.engine;
+    }
+  }
+
+  return options;
+}
+
+/// \brief Get global abstract domain
+AbstractDomain AnalysisOptions::getDomain() const
+{
+  return m_defaults.domain;
+}
+
+/// \brief Get output format
+OutputFormat AnalysisOptions::getOutputFormat() const
+{
+  return m_outputFormat;
+}
+
+/// \brief Get number of threads to analyze functions with
+int AnalysisOptions::getNumJobs() const
+{
+  return m_numJobs;
+}
+
+/// \brief Print options
+void AnalysisOptions::print(std::ostream& os) const
+{
+  os << "\n Analysis options:"
+    << "\n\tdomain = " << getDomainName(m_defaults.domain)
+    << "\n\tunroll = " << m_defaults.numUnrollings
+    << "\n\tverbosity = " << m_defaults.verbosity
+    << "\n\tengine = " << getEngineName(m_defaults.engine)
+    << "\n\tformat = "
+    << ((m_outputFormat == OUTPUT_FULL) ? "full" : "summary")
+    << "\n\tjobs = " << m_numJobs << "\n";
+
+  std::map<std::string, FunctionOptions>::const_iterator it;
+
+  for (it = m_functionOverrides.begin(); it != m_functionOverrides.end(); it++)
+  {
+    FunctionOptions options = getFunctionOptions(it->first);
+
+    os << "\tfunction " << it->first
+      << ": domain = " << getDomainName(options.domain)
+      << ", unroll = " << options.numUnrollings
+      << ", verbosity = " << options.verbosity
+      << ", engine = " << getEngineName(options.engine) << "\n";
+  }
+}
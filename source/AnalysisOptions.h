@@ -0,0 +1,166 @@
+//
+// AnalysisOptions.h
+//
+
+/// \file
+/// \brief Defines analysis options (abstract domain, loop unrollings,
+/// verbosity, iteration engine, output format and per-function overrides)
+/// filled from command line or a config file
+///
+#include <iostream>
+#include <map>
+#include <string>
+
+#ifndef ANALYSISOPTIONS_H
+# define ANALYSISOPTIONS_H
+
+/// \brief Numerical abstract domains provided by Apron library,
+/// DOMAIN_DEFAULT is used by per-function overrides to inherit global value
+typedef enum AbstractDomain
+{
+  DOMAIN_DEFAULT   = 0,
+  DOMAIN_BOX       = 1,
+  DOMAIN_OCTAGON   = 2,
+  DOMAIN_POLYHEDRA = 3
+} AbstractDomain;
+
+/// \brief Number of abstract domains (including DOMAIN_DEFAULT),
+/// used to size tables indexed by AbstractDomain
+const int NUM_ABSTRACT_DOMAINS = 4;
+
+/// \brief Fixpoint iteration engine, ENGINE_DEFAULT is used by per-function
+/// overrides to inherit global value
+/// - ENGINE_WTO - recursive iteration over the weak topological order, every
+///   loop is iterated until stable, all of its blocks in every iteration
+/// - ENGINE_WORKLIST - worklist in reverse postorder, a block is analyzed
+///   again only if the output of one of its predecessors changed
+typedef enum IterationEngine
+{
+  ENGINE_DEFAULT  = 0,
+  ENGINE_WTO      = 1,
+  ENGINE_WORKLIST = 2
+} IterationEngine;
+
+/// \brief Output format of the dump
+/// - OUTPUT_FULL - print MyCFGInfo table after every visited block
+/// - OUTPUT_SUMMARY - print MyCFGInfo table once a function is analyzed
+typedef enum OutputFormat
+{
+  OUTPUT_FULL    = 0,
+  OUTPUT_SUMMARY = 1
+} OutputFormat;
+
+/// \brief Options which can be given globally and overridden per function,
+/// a negative value (or DOMAIN_DEFAULT) in an override means "not set"
+typedef struct FunctionOptions
+{
+  /// \brief Abstract domain used to analyze the function
+  AbstractDomain domain;
+
+  /// \brief Number of times loop unrolling to be done to delay widening
+  int numUnrollings;
+
+  /// \brief Verbosity of dump - 0 quiet, 1 normal, 2 also dump whole CFG
+  int verbosity;
+
+  /// \brief Fixpoint iteration engine used to analyze the function
+  IterationEngine engine;
+} FunctionOptions;
+
+/// \brief Analysis options created once per run and passed to
+/// MyASTConsumer / MyASTVisitor
+class AnalysisOptions
+{
+  public:
+
+    /// \brief Set default options - Box domain, 5 unrollings, verbosity 1,
+    /// WTO engine, full output and one analysis thread
+    AnalysisOptions();
+
+    /// \brief Parse one command line argument of form --key=value
+    ///
+    /// --domain=box|oct|pk, --unroll=N, --verbosity=N, --engine=wto|worklist,
+    /// --format=full|summary, --jobs=N, --config=file and
+    /// --function=name:key=value[,key=value...]
+    ///
+    /// @param arg - command line argument
+    /// @return bool - true if arg is a valid analysis option, false otherwise
+    bool parseArgument(const char* arg);
+
+    /// \brief Read options from config file
+    ///
+    /// Every line is "key = value", lines starting with '#' are comments.
+    /// A section "[function name]" starts overrides for function name.
+    ///
+    /// @param fileName - config file name
+    /// @return bool - true on success, false otherwise
+    bool parseConfigFile(const char* fileName);
+
+    /// \brief Get options for a function, i.e. global options with
+    /// overrides given for this function applied on top
+    /// @param functionName - name of function
+    /// @return FunctionOptions - options to analyze the function with
+    FunctionOptions getFunctionOptions(const std::string& functionName) const;
+
+    /// \brief Get global abstract domain (functions may override it)
+    /// @return AbstractDomain - abstract domain
+    AbstractDomain getDomain() const;
+
+    /// \brief Get output format
+    /// @return OutputFormat - output format of the dump
+    OutputFormat getOutputFormat() const;
+
+    /// \brief Get number of threads to analyze functions with
+    /// @return int - number of threads, 1 analyzes functions one by one
+    int getNumJobs() const;
+
+    /// \brief Print options
+    /// @param os - output stream
+    /// @return void (nothing)
+    void print(std::ostream& os) const;
+
+    /// \brief Get printable name of an abstract domain
+    /// @param domain - abstract domain
+    /// @return const char* - name of domain
+    static const char* getDomainName(AbstractDomain domain);
+
+    /// \brief Get printable name of an iteration engine
+    /// @param engine - iteration engine
+    /// @return const char* - name of engine
+    static const char* getEngineName(IterationEngine engine);
+
+    /// \brief Print help for analysis options
+    /// @param os - output stream
+    /// @return void (nothing)
+    static void printHelp(std::ostream& os);
+
+  private:
+
+    /// \brief Set one option in options (global or per-function)
+    /// @param key - option name
+    /// @param value - option value
+    /// @param options - options to be updated
+    /// @param isGlobal - true if options are global options
+    /// @return bool - true if key and value are valid, false otherwise
+    bool setOption(const std::string& key, const std::string& value,
+      FunctionOptions& options, bool isGlobal);
+
+    /// \brief Get override entry for a function, create if not present
+    /// @param functionName - name of function
+    /// @return FunctionOptions& - override entry
+    FunctionOptions& getOverride(const std::string& functionName);
+
+    /// \brief Global options
+    FunctionOptions m_defaults;
+
+    /// \brief Output format of the dump
+    OutputFormat m_outputFormat;
+
+    /// \brief Number of threads to analyze functions with
+    int m_numJobs;
+
+    /// \brief Per-function overrides
+    std::map<std::string, FunctionOptions> m_functionOverrides;
+};
+
+#endif // ANALYSISOPTIONS_H
@@ -0,0 +1,179 @@
+//
+// AnalysisOutput.cpp
+//
+
+/// \file
+/// \brief Defines per-thread redirection of analysis output, used to buffer
+/// output of functions analyzed in parallel and print it in source order
+///
+#include <stdlib.h>
+
+#include "AnalysisOutput.h"
+
+/// \brief Output buffer of current thread, NULL to write to stdout / stderr
+static __thread OutputBuffer* s_currentBuffer = NULL;
+
+/// \brief Get FILE* for normal output (stdout) of current thread
+FILE* getOutFile()
+{
+  return s_currentBuffer ? s_currentBuffer->getOutFile() : stdout;
+}
+
+/// \brief Get FILE* for dump output (stderr) of current thread
+FILE* getErrFile()
+{
+  return s_currentBuffer ? s_currentBuffer->getErrFile() : stderr;
+}
+
+/// \brief Get stream for normal output of current thread
+std::ostream& getOutStream()
+{
+  return s_currentBuffer ? s_currentBuffer->getOutStream() : std::cout;
+}
+
+/// \brief Get stream for dump output of current thread
+std::ostream& getErrStream()
+{
+  return s_currentBuffer ? s_currentBuffer->getErrStream() : std::cerr;
+}
+
+/// \brief Create stream buffer writing to file
+FileStreamBuf::FileStreamBuf(FILE* file)
+{
+  m_file = file;
+}
+
+/// \brief Write one character
+int FileStreamBuf::overflow(int c)
+{
+  if (c == EOF)
+  {
+    return 0;
+  }
+
+  return fputc(c, m_file);
+}
+
+/// \brief Write n characters
+std::streamsize FileStreamBuf::xsputn(const char* s, std::streamsize n)
+{
+  return fwrite(s, 1, n, m_file);
+}
+
+/// \brief Open empty output and dump buffers
+OutputBuffer::OutputBuffer()
+{
+  m_outData = NULL;
+  m_outSize = 0;
+  m_outFile = open_memstream(&m_outData, &m_outSize);
+
+  m_errData = NULL;
+  m_errSize = 0;
+  m_errFile = open_memstream(&m_errData, &m_errSize);
+
+  m_outStreamBuf = new FileStreamBuf(getOutFile());
+  m_outStream = new std::ostream(m_outStreamBuf);
+  m_errStreamBuf = new FileStreamBuf(getErrFile());
+  m_errStream = new std::ostream(m_errStreamBuf);
+}
+
+/// \brief Free buffers
+OutputBuffer::~OutputBuffer()
+{
+  delete m_outStream;
+  delete m_outStreamBuf;
+  delete m_errStream;
+  delete m_errStreamBuf;
+
+  if (m_outFile)
+  {
+    fclose(m_outFile);
+  }
+
+  if (m_errFile)
+  {
+    fclose(m_errFile);
+  }
+
+  free(m_outData);
+  free(m_errData);
+}
+
+/// \brief Get FILE* writing to output buffer
+FILE* OutputBuffer::getOutFile()
+{
+  // fall back to stdout if buffer could not be allocated
+  return m_outFile ? m_outFile : stdout;
+}
+
+/// \brief Get FILE* writing to dump buffer
+FILE* OutputBuffer::getErrFile()
+{
+  return m_errFile ? m_errFile : stderr;
+}
+
+/// \brief Get stream writing to output buffer
+std::ostream& OutputBuffer::getOutStream()
+{
+  return *m_outStream;
+}
+
+/// \brief Get stream writing to dump buffer
+std::ostream& OutputBuffer::getErrStream()
+{
+  return *m_errStream;
+}
+
+/// \brief Write buffered output to stdout and dump to stderr
+void OutputBuffer::flush()
+{
+  if (m_outFile)
+  {
+    // closing the stream makes m_outData / m_outSize final
+    fclose(m_outFile);
+    m_outFile = NULL;
+
+    // nothing is written to the streams after the buffer is flushed
+    fwrite(m_outData, 1, m_outSize, stdout);
+  }
+
+  if (m_errFile)
+  {
+    fclose(m_errFile);
+    m_errFile = NULL;
+
+    fwrite(m_errData, 1, m_errSize, stderr);
+  }
+}
+
+/// \brief Redirect output of current thread to buffer
+OutputRedirect::OutputRedirect(OutputBuffer* buffer)
+{
+  m_previous = s_currentBuffer;
+  s_currentBuffer = buffer;
+}
+
+/// \brief Restore previous output of current thread
+OutputRedirect::~OutputRedirect()
+{
+  s_currentBuffer = m_previous;
+}
+
+/// \brief Create unbuffered stream writing to file
+FileRawOstream::FileRawOstream(FILE* file)
+  : llvm::raw_ostream(true)
+{
+  m_file = file;
+}
+
+/// \brief Write Size bytes from Ptr to file
+void FileRawOstream::write_impl(const char* Ptr, size_t Size)
+{
+  fwrite(Ptr, 1, Size, m_file);
+}
+
+/// \brief Current position in file
+uint64_t FileRawOstream::current_pos() const
+{
+  return ftell(m_file);
+}
@@ -0,0 +1,160 @@
+//
+// AnalysisOutput.h
+//
+
+/// \file
+/// \brief Defines per-thread redirection of analysis output, used to buffer
+/// output of functions analyzed in parallel and print it in source order
+///
+#include <stdio.h>
+#include <iostream>
+#include <streambuf>
+
+#ifndef ANALYSISOUTPUT_H
+# define ANALYSISOUTPUT_H
+
+#include "llvm/Support/raw_ostream.h"
+
+/// \brief Get FILE* for normal output (stdout) of current thread
+/// @return FILE* - output buffer of current thread or stdout
+FILE* getOutFile();
+
+/// \brief Get FILE* for dump output (stderr) of current thread
+/// @return FILE* - dump buffer of current thread or stderr
+FILE* getErrFile();
+
+/// \brief Get stream for normal output of current thread, analysis code
+/// prints through it instead of std::cout
+/// @return std::ostream& - output stream of current thread's buffer or
+/// std::cout
+std::ostream& getOutStream();
+
+/// \brief Get stream for dump output of current thread, analysis code
+/// prints through it instead of std::cerr
+/// @return std::ostream& - dump stream of current thread's buffer or
+/// std::cerr
+std::ostream& getErrStream();
+
+/// \brief Unbuffered std::streambuf writing to a FILE*, so output of a
+/// std::ostream and of Apron print functions to the same FILE* keeps its
+/// order
+class FileStreamBuf : public std::streambuf
+{
+  public:
+
+    /// \brief Create stream buffer writing to file
+    /// @param file - FILE* to write to
+    FileStreamBuf(FILE* file);
+
+  protected:
+
+    /// \brief Write one character
+    virtual int overflow(int c);
+
+    /// \brief Write n characters
+    virtual std::streamsize xsputn(const char* s, std::streamsize n);
+
+  private:
+
+    /// \brief File to write to
+    FILE* m_file;
+};
+
+/// \brief In-memory copy of stdout and stderr output of one analysis job
+class OutputBuffer
+{
+  public:
+
+    /// \brief Open empty output and dump buffers
+    OutputBuffer();
+
+    /// \brief Free buffers
+    ~OutputBuffer();
+
+    /// \brief Get FILE* writing to output buffer
+    /// @return FILE* - output buffer
+    FILE* getOutFile();
+
+    /// \brief Get FILE* writing to dump buffer
+    /// @return FILE* - dump buffer
+    FILE* getErrFile();
+
+    /// \brief Get stream writing to output buffer
+    /// @return std::ostream& - output stream
+    std::ostream& getOutStream();
+
+    /// \brief Get stream writing to dump buffer
+    /// @return std::ostream& - dump stream
+    std::ostream& getErrStream();
+
+    /// \brief Write buffered output to stdout and dump to stderr
+    /// @param none
+    /// @return void (nothing)
+    void flush();
+
+  private:
+
+    // Buffer is owned by open_memstream(), it must not be copied
+    OutputBuffer(const OutputBuffer&);
+    OutputBuffer& operator=(const OutputBuffer&);
+
+    /// \brief Output buffer and its size, filled by open_memstream()
+    char* m_outData;
+    size_t m_outSize;
+    FILE* m_outFile;
+
+    /// \brief Dump buffer and its size, filled by open_memstream()
+    char* m_errData;
+    size_t m_errSize;
+    FILE* m_errFile;
+
+    /// \brief Streams on output and dump buffers, owned by the buffer (not
+    /// by the thread) so formatting state is never shared between threads
+    FileStreamBuf* m_outStreamBuf;
+    std::ostream* m_outStream;
+    FileStreamBuf* m_errStreamBuf;
+    std::ostream* m_errStream;
+};
+
+/// \brief Redirect output of current thread to an OutputBuffer for the
+/// lifetime of this object
+class OutputRedirect
+{
+  public:
+
+    /// \brief Redirect output of current thread to buffer
+    /// @param buffer - buffer to receive output
+    OutputRedirect(OutputBuffer* buffer);
+
+    /// \brief Restore previous output of current thread
+    ~OutputRedirect();
+
+  private:
+
+    /// \brief Buffer which was current before
+    OutputBuffer* m_previous;
+};
+
+/// \brief llvm::raw_ostream writing to a FILE*, used to print clang
+/// declarations, statements and CFGs to getErrFile()
+class FileRawOstream : public llvm::raw_ostream
+{
+  public:
+
+    /// \brief Create unbuffered stream writing to file
+    /// @param file - FILE* to write to
+    FileRawOstream(FILE* file);
+
+  private:
+
+    /// \brief Write Size bytes from Ptr to file
+    virtual void write_impl(const char* Ptr, size_t Size);
+
+    /// \brief Current position in file
+    virtual uint64_t current_pos() const;
+
+    /// \brief File to write to
+    FILE* m_file;
+};
+
+#endif // ANALYSISOUTPUT_H
@@ -5,73 +5,69 @@
 /// \file
 /// \brief Defines Apron related declarations and definitions
 ///
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <climits>
 #include <cfloat>
+#include <map>
+#include <stdlib.h>
 
 #include <Apron.h>
+#include "AnalysisContext.h"
+#include "AnalysisOutput.h"
 
-/// \brief Apron manager
-ap_manager_t* man;
-
-/// \brief Apron environment
-ap_environment_t* env;
-
-/// \brief Pointer to structre to hold abstract value
-AbsVal* AbsValPtr = NULL;
-
-/// \brief Pointer to structure to store Abstract Memory
-AbstractMemory* AbstractMemoryPtr = NULL;
-
-/// \brief Counter for no. of temporary variables created
-int mycount = 0;
-
-/// \brief Apron type (int/real) of current expression
-int expr_type = 0;
+/// \brief Clear MyApronExpr and CondExprCons stacks and give back all
+/// memory of the statement arena
+void resetStatementArena()
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-/// \brief Vector containg pointers to VariableCount Structure
-VariableCountList globalVarList;
+  // condition constraints nobody removed (e.g. operands of a logical
+  // operator)
+  for (int i = 0; i < ctx->condStack.size(); i++)
+  {
+    clearCondExprCons(&(ctx->condStack[i]));
+  }
 
-/// \brief MyApronExpr list
-// initialize empty list
-MyApronExpr* head = NULL;
+  // stacks must not keep storage of the arena, swap in empty ones
+  MyApronExprStack(ctx->exprStack.get_allocator()).swap(ctx->exprStack);
+  CondExprConsStack(ctx->condStack.get_allocator()).swap(ctx->condStack);
 
-/// \brief Pointer to CondExprAbsVal list
-CondExprAbsVal* absval_head = NULL;
+  ctx->arena.reset();
+}
 
 /// \brief Add apron type expression to MyApronExpr list
-void addExpression(ap_texpr1_t* expression, int expr_type)
+void addExpression(ap_texpr0_t* expression, int expr_type)
 {
-  MyApronExpr* t_node;
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  MyApronExpr t_node;
 
-  t_node = (MyApronExpr*) new MyApronExpr;
-  t_node->data = expression;
-  t_node->expr_type = expr_type;
-  t_node->next = head;
-  head = t_node;
+  t_node.data = expression;
+  t_node.expr_type = expr_type;
+  ctx->exprStack.push_back(t_node);
 }
 
 /// \brief Remove apron type expression from MyApronExpr list
 MyApronExpr* removeExpression()
 {
-  MyApronExpr* t_node;
-
-  t_node = (MyApronExpr*) new MyApronExpr;
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-  if (head != NULL)
+  if (!ctx->exprStack.empty())
   {
-    // head is not empty, return head node and set head = head->next
-    t_node->data = head->data;
-    t_node->expr_type = head->expr_type;
-    head = head->next;
+    // copy top into the arena, its slot is reused by next addExpression()
+    MyApronExpr* t_node = new (ctx->arena.allocate(sizeof(MyApronExpr)))
+      MyApronExpr(ctx->exprStack.back());
+    ctx->exprStack.pop_back();
     return t_node;
   }
   else
   {
     // Send underflow error
-    std::cout << "Expression underflow! ";
-    std::cout << "Attempt to extract expression from empty MyApronExpr!\n\n";
+    getOutStream() << "Expression underflow! ";
+    getOutStream()
+      << "Attempt to extract expression from empty MyApronExpr!\n\n";
     return NULL;
   }
 }
@@ -79,175 +75,640 @@ MyApronExpr* removeExpression()
 /// \brief Show apron type expressions of MyApronExpr list
 void showExpression()
 {
-  MyApronExpr* t_node;
-  ap_texpr1_t *t_tree_expr[1];
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-  t_node = (MyApronExpr*) new MyApronExpr;
-
-  if (head != NULL)
+  if (!ctx->exprStack.empty())
   {
-    // head is not empty, print list
-    t_node = head;
-    std::cout << " (";
+    // list is not empty, print it from top
+    getOutStream() << " (";
 
-    do
+    for (int i = ctx->exprStack.size() - 1; i >= 0; i--)
     {
-      t_tree_expr[0] = t_node->data;
-      ap_texpr1_print(t_tree_expr[0]);
-      std::cout << " ,";
-      t_node = t_node->next;
-    } while (t_node != NULL);
+      printTreeExpr(getOutFile(), ctx->exprStack[i].data);
+      getOutStream() << " ,";
+    }
 
-    std::cout << " END)\n\n";
+    getOutStream() << " END)\n\n";
   }
   else
   {
     // empty list
-    std::cout << "\n\nMyApronExpr Expression List is empty!\n\n";
+    getOutStream() << "\n\nMyApronExpr Expression List is empty!\n\n";
   }
 }
 
-/// \brief Add condAbsVal and negCondAbsVal to CondExprAbsVal list
-void addCondExprAbsVal(ap_abstract1_t absVal, ap_abstract1_t negAbsVal)
+/// \brief Add constraints of condition and of its negation to CondExprCons
+/// list
+void addCondExprCons(ap_tcons0_array_t condCons,
+  ap_tcons0_array_t negCondCons)
 {
-  CondExprAbsVal* t_CondExprAbsVal;
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-  t_CondExprAbsVal = (CondExprAbsVal*) new CondExprAbsVal;
-  t_CondExprAbsVal->condAbsVal = absVal;
-  t_CondExprAbsVal->negCondAbsVal = negAbsVal;
-  t_CondExprAbsVal->next = absval_head;
-  absval_head = t_CondExprAbsVal;
+  CondExprCons t_CondExprCons;
+
+  t_CondExprCons.condCons = condCons;
+  t_CondExprCons.negCondCons = negCondCons;
+  t_CondExprCons.isLinear = false;
+  ctx->condStack.push_back(t_CondExprCons);
 }
 
-/// \brief Remove condAbsVal and negCondAbsVal from CondExprAbsVal list
-CondExprAbsVal* removeCondExprAbsVal()
+/// \brief Remove constraints of condition and of its negation from
+/// CondExprCons list
+CondExprCons* removeCondExprCons()
 {
-  CondExprAbsVal* t_CondExprAbsVal;
-
-  t_CondExprAbsVal = (CondExprAbsVal*) new CondExprAbsVal;
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-  if (absval_head != NULL)
+  if (!ctx->condStack.empty())
   {
-    // absval_head is not empty, return head node and set head = head->next
-    t_CondExprAbsVal->condAbsVal = absval_head->condAbsVal;
-    t_CondExprAbsVal->negCondAbsVal = absval_head->negCondAbsVal;
-    absval_head = absval_head->next;
-    return t_CondExprAbsVal;
+    // copy top into the arena, its slot is reused by next
+    // addCondExprCons()
+    CondExprCons* t_CondExprCons =
+      new (ctx->arena.allocate(sizeof(CondExprCons)))
+      CondExprCons(ctx->condStack.back());
+    ctx->condStack.pop_back();
+    return t_CondExprCons;
   }
   else
   {
     // Send underflow error
-    std::cout << "CondExprAbsVal list underflow! ";
-    std::cout << "Attempt to extract element from empty CondExprAbsVal!\n\n";
+    getOutStream() << "CondExprCons list underflow! ";
+    getOutStream() << "Attempt to extract element from empty CondExprCons!\n\n";
     return NULL;
   }
 }
 
-/// \brief Show condAbsVal and negCondAbsVal from CondExprAbsVal list
-void showCondExprAbsVal()
+/// \brief Show constraints of condition and of its negation from
+/// CondExprCons list
+void showCondExprCons()
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  if (!ctx->condStack.empty())
+  {
+    // list is not empty, print it from top
+    getErrStream() << "\n  CondExprCons:\n";
+
+    for (int i = ctx->condStack.size() - 1; i >= 0; i--)
+    {
+      ap_tcons0_array_fprint(getErrFile(), &(ctx->condStack[i].condCons),
+        getDimNames());
+      ap_tcons0_array_fprint(getErrFile(), &(ctx->condStack[i].negCondCons),
+        getDimNames());
+    }
+
+    getOutStream() << "\n\n";
+  }
+  else
+  {
+    // empty list
+    getOutStream() << "\n\nCondExprCons list is empty!\n\n";
+  }
+}
+
+/// \brief Make constraint array holding one constraint
+/// @param cons - constraint, the array takes ownership of it
+/// @return ap_tcons0_array_t - constraint array
+static ap_tcons0_array_t makeConsArray(ap_tcons0_t cons)
+{
+  ap_tcons0_array_t t_consarray = ap_tcons0_array_make(1);
+  t_consarray.p[0] = cons;
+
+  return t_consarray;
+}
+
+/// \brief Make constraints of a condition known to be true / false
+CondExprCons makeCondExprCons(int positive)
+{
+  // true - no constraint, false - unsatisfiable constraint (-1 >= 0)
+  CondExprCons t_CondExprCons;
+
+  t_CondExprCons.condCons = (positive == 0) ?
+    makeConsArray(ap_tcons0_make_unsat()) :
+    ap_tcons0_array_make(0);
+  t_CondExprCons.negCondCons = (positive == 1) ?
+    makeConsArray(ap_tcons0_make_unsat()) :
+    ap_tcons0_array_make(0);
+  t_CondExprCons.isLinear = false;
+
+  return t_CondExprCons;
+}
+
+/// \brief Clear constraint arrays of a CondExprCons
+void clearCondExprCons(CondExprCons* cons)
+{
+  ap_tcons0_array_clear(&(cons->condCons));
+  ap_tcons0_array_clear(&(cons->negCondCons));
+
+  if (cons->isLinear)
+  {
+    ap_lincons0_array_clear(&(cons->linCondCons));
+    ap_lincons0_array_clear(&(cons->linNegCondCons));
+    cons->isLinear = false;
+  }
+}
+
+/// \brief Coefficients of dimensions of a linear expression being collected,
+/// all coefficients and constants fit in int (see ap_linexpr0_set_*_int())
+typedef std::map<ap_dim_t, int> LinearTerms;
+
+/// \brief Multiply two coefficients of a linear expression
+/// @param a - first factor
+/// @param b - second factor
+/// @param product - a * b, set if it fits in int
+/// @return bool - false on overflow
+static bool multiplyCoefficients(int a, int b, int* product)
 {
-  CondExprAbsVal* t_CondExprAbsVal;
-  ap_abstract1_t t_absval;
+  // product of two ints always fits in long long
+  long long result = (long long) a * b;
+
+  if (result < INT_MIN || result > INT_MAX)
+  {
+    return false;
+  }
 
-  t_CondExprAbsVal = (CondExprAbsVal*) new CondExprAbsVal;
+  *product = (int) result;
 
-  if (absval_head != NULL)
+  return true;
+}
+
+/// \brief Add product of two coefficients to a coefficient of a linear
+/// expression
+/// @param a - first factor
+/// @param b - second factor
+/// @param sum - coefficient, sum + a * b is stored if it fits in int
+/// @return bool - false on overflow
+static bool addProductToCoefficient(int a, int b, int* sum)
+{
+  // |a * b| <= 2^62 and |sum| < 2^31, so the sum fits in long long
+  long long result = (long long) a * b + *sum;
+
+  if (result < INT_MIN || result > INT_MAX)
   {
-    // absval_head is not empty, print list
-    t_CondExprAbsVal = absval_head;
+    return false;
+  }
+
+  *sum = (int) result;
 
-    std::cerr << "\n  CondExprAbsVal:\n";
+  return true;
+}
 
-    do
+/// \brief Get value of a leaf of tree expression which is an integer
+/// constant (see ap_texpr0_cst_scalar_int())
+/// @param expr - tree expression
+/// @param value - value of constant
+/// @return bool - true if expr is an integer constant which fits in int
+static bool getIntegerOfTreeExpr(ap_texpr0_t* expr, int* value)
+{
+  if (expr->discr != AP_TEXPR_CST ||
+      expr->val.cst.discr != AP_COEFF_SCALAR ||
+      expr->val.cst.val.scalar->discr != AP_SCALAR_MPQ)
+  {
+    return false;
+  }
+
+  mpq_ptr mpq = expr->val.cst.val.scalar->val.mpq;
+
+  if (mpz_cmp_ui(mpq_denref(mpq), 1) != 0 ||
+      !mpz_fits_sint_p(mpq_numref(mpq)))
+  {
+    return false;
+  }
+
+  *value = (int) mpz_get_si(mpq_numref(mpq));
+
+  return true;
+}
+
+/// \brief Add factor * expr to a linear expression being collected
+/// @param expr - tree expression
+/// @param intdim - number of integer dimensions of environment
+/// @param factor - factor of expr
+/// @param terms - coefficients of dimensions
+/// @param cst - constant of linear expression
+/// @return bool - false if expr is not affine over integer variables or a
+///         coefficient does not fit in int (tree expression is used then)
+static bool collectLinearTerms(ap_texpr0_t* expr, size_t intdim, int factor,
+  LinearTerms& terms, int* cst)
+{
+  int value;
+
+  if (getIntegerOfTreeExpr(expr, &value))
+  {
+    return addProductToCoefficient(factor, value, cst);
+  }
+
+  if (expr->discr == AP_TEXPR_DIM)
+  {
+    // rounding of integer operations is exact on integer variables only
+    if (expr->val.dim >= intdim)
     {
-      t_absval = t_CondExprAbsVal->condAbsVal;
-      ap_abstract1_fprint(stderr, man, &(t_absval));
-      t_absval = t_CondExprAbsVal->negCondAbsVal;
-      ap_abstract1_fprint(stderr, man, &(t_absval));
+      return false;
+    }
 
-      t_CondExprAbsVal = t_CondExprAbsVal->next;
-    } while (t_CondExprAbsVal != NULL);
+    return addProductToCoefficient(factor, 1, &terms[expr->val.dim]);
+  }
 
-    std::cout << "\n\n";
+  if (expr->discr != AP_TEXPR_NODE)
+  {
+    return false;
   }
-  else
+
+  ap_texpr0_node_t* node = expr->val.node;
+
+  if (node->type != AP_RTYPE_INT && node->type != AP_RTYPE_REAL)
   {
-    // empty list
-    std::cout << "\n\nCondExprAbsVal list is empty!\n\n";
+    return false;
+  }
+
+  int negFactor;
+
+  switch (node->op)
+  {
+    case AP_TEXPR_ADD:
+      return collectLinearTerms(node->exprA, intdim, factor, terms, cst) &&
+        collectLinearTerms(node->exprB, intdim, factor, terms, cst);
+    case AP_TEXPR_SUB:
+      return multiplyCoefficients(factor, -1, &negFactor) &&
+        collectLinearTerms(node->exprA, intdim, factor, terms, cst) &&
+        collectLinearTerms(node->exprB, intdim, negFactor, terms, cst);
+    case AP_TEXPR_NEG:
+      return multiplyCoefficients(factor, -1, &negFactor) &&
+        collectLinearTerms(node->exprA, intdim, negFactor, terms, cst);
+    case AP_TEXPR_MUL:
+      // constant subexpressions are folded to one constant when statements
+      // are lowered, so a linear product has a constant operand
+      if (getIntegerOfTreeExpr(node->exprA, &value))
+      {
+        return multiplyCoefficients(factor, value, &factor) &&
+          collectLinearTerms(node->exprB, intdim, factor, terms, cst);
+      }
+
+      if (getIntegerOfTreeExpr(node->exprB, &value))
+      {
+        return multiplyCoefficients(factor, value, &factor) &&
+          collectLinearTerms(node->exprA, intdim, factor, terms, cst);
+      }
+
+      return false;
+    default:
+      // /, %, casts, etc. are not linear or round their result
+      return false;
   }
 }
 
-/// \brief get abstract domain choice and set empty environment
-void initApron()
+/// \brief Make linear expression of a tree expression
+/// @param expr - tree expression (not freed)
+/// @param intdim - number of integer dimensions of environment
+/// @return ap_linexpr0_t* - linear expression, NULL if expr is not affine
+///         over integer variables or a coefficient overflows int
+static ap_linexpr0_t* linearizeTreeExpr(ap_texpr0_t* expr, size_t intdim)
 {
-  // First get abstract domain
-  std::cout << "\nFollowing Numerical Abstract Domains are available:\n";
-  std::cout << "\n\tBox (Interval) - 1\n\tOctagon - 2\n\tPolyhedra - 3\n";
-  std::cout << "\n(These domains are provided by APRON library)\n";
-start:
-  std::cout << "\nPlease select a domain (1/2/3) to continue (or 0 to exit): ";
+  LinearTerms terms;
+  int cst = 0;
 
-  int abstract_domain;
-  std::cin >> abstract_domain;
+  if (!collectLinearTerms(expr, intdim, 1, terms, &cst))
+  {
+    return NULL;
+  }
 
-  std::cout << "\tYou have entered domain: " << abstract_domain << "\n";
+  size_t numTerms = 0;
+  LinearTerms::iterator it;
 
-  if (abstract_domain == 0)
+  for (it = terms.begin(); it != terms.end(); it++)
   {
-    std::cout << "\n[Done]\n";
-    return ;
+    if (it->second != 0)
+    {
+      numTerms++;
+    }
   }
 
-  if ((abstract_domain == 1) || (abstract_domain == 2) || (abstract_domain == 3))
+  ap_linexpr0_t* linexpr = ap_linexpr0_alloc(AP_LINEXPR_SPARSE, numTerms);
+  ap_linexpr0_set_cst_scalar_int(linexpr, cst);
+
+  // terms are in order of dimensions, as sparse expressions need them
+  for (it = terms.begin(); it != terms.end(); it++)
   {
-    // actually do nothing
+    if (it->second != 0)
+    {
+      ap_linexpr0_set_coeff_scalar_int(linexpr, it->first, it->second);
+    }
   }
-  else
+
+  return linexpr;
+}
+
+/// \brief Make linear expressions of tree expressions
+/// @param exprs - tree expressions (not freed)
+/// @param size - number of expressions
+/// @param intdim - number of integer dimensions of environment
+/// @param linexprs - linear expressions, caller has to free them
+/// @return bool - true if all expressions are linear, otherwise linexprs is
+///         left empty
+static bool linearizeTreeExprArray(ap_texpr0_t** exprs, size_t size,
+  size_t intdim, std::vector<ap_linexpr0_t *>& linexprs)
+{
+  for (size_t i = 0; i < size; i++)
+  {
+    ap_linexpr0_t* linexpr = linearizeTreeExpr(exprs[i], intdim);
+
+    if (linexpr == NULL)
+    {
+      for (size_t j = 0; j < linexprs.size(); j++)
+      {
+        ap_linexpr0_free(linexprs[j]);
+      }
+
+      linexprs.clear();
+      return false;
+    }
+
+    linexprs.push_back(linexpr);
+  }
+
+  return true;
+}
+
+/// \brief Make linear constraints of tree constraints
+/// @param cons - tree constraints
+/// @param intdim - number of integer dimensions of environment
+/// @param lincons - linear constraints, made only if all are linear
+/// @return bool - true if all constraints are linear
+static bool linearizeConsArray(ap_tcons0_array_t* cons, size_t intdim,
+  ap_lincons0_array_t* lincons)
+{
+  *lincons = ap_lincons0_array_make(cons->size);
+
+  for (size_t i = 0; i < cons->size; i++)
   {
-    // invalid domain, ask again
-    std::cout << "\tInvalid value for domain\n";
-    goto start;
+    ap_linexpr0_t* linexpr = NULL;
+
+    // modulo constraints (with scalar) are kept as tree constraints
+    if (cons->p[i].scalar == NULL)
+    {
+      linexpr = linearizeTreeExpr(cons->p[i].texpr0, intdim);
+    }
+
+    if (linexpr == NULL)
+    {
+      ap_lincons0_array_clear(lincons);
+      return false;
+    }
+
+    // constraint takes ownership of linexpr
+    lincons->p[i] = ap_lincons0_make(cons->p[i].constyp, linexpr, NULL);
+  }
+
+  return true;
+}
+
+/// \brief Make linear constraints of a CondExprCons kept for later visits
+/// of a block, if all its constraints are linear
+bool linearizeCondExprCons(CondExprCons* cons)
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  if (cons->isLinear)
+  {
+    return true;
   }
 
-  switch (abstract_domain)
+  size_t intdim = ctx->env.get()->intdim;
+
+  if (!linearizeConsArray(&(cons->condCons), intdim, &(cons->linCondCons)))
+  {
+    return false;
+  }
+
+  if (!linearizeConsArray(&(cons->negCondCons), intdim,
+        &(cons->linNegCondCons)))
+  {
+    ap_lincons0_array_clear(&(cons->linCondCons));
+    return false;
+  }
+
+  cons->isLinear = true;
+
+  return true;
+}
+
+/// \brief Apron managers of current thread, one per abstract domain.
+/// Managers are not thread-safe, so every analysis thread allocates its own
+/// and reuses it for every function it analyzes.
+static __thread ap_manager_t* managers[NUM_ABSTRACT_DOMAINS];
+
+/// \brief Allocate a new apron manager for an abstract domain
+/// @param domain - abstract domain (box / octagon / polyhedra)
+/// @return ap_manager_t* - apron manager, freed by the caller
+static ap_manager_t* allocApronManager(AbstractDomain domain)
+{
+  ap_manager_t* man = NULL;
+
+  switch (domain)
   {
     //Allocate appropriate manager for selected domain
-    case 1:
+    case DOMAIN_BOX:
+    case DOMAIN_DEFAULT:
       man = box_manager_alloc();
       break;
-    case 2:
+    case DOMAIN_OCTAGON:
       man = oct_manager_alloc();
       break;
-    case 3:
+    case DOMAIN_POLYHEDRA:
       man = pk_manager_alloc(true);
       break;
   }
 
+  return man;
+}
+
+/// \brief Get apron manager for an abstract domain
+ap_manager_t* getApronManager(AbstractDomain domain)
+{
+  if (domain == DOMAIN_DEFAULT)
+  {
+    domain = DOMAIN_BOX;
+  }
+
+  if (managers[domain] == NULL)
+  {
+    managers[domain] = allocApronManager(domain);
+  }
+
+  return managers[domain];
+}
+
+/// \brief Print abstract domain and Apron library providing it
+void printApronDomain(AbstractDomain domain, std::ostream& os)
+{
+  if (domain == DOMAIN_DEFAULT)
+  {
+    domain = DOMAIN_BOX;
+  }
+
+  // managers of analysis threads are not shared, a temporary one gives
+  // library name and version
+  ap_manager_t* man = allocApronManager(domain);
+
   const char* library;
   const char* version;
 
   library = ap_manager_get_library(man);
   version = ap_manager_get_version(man);
 
-  std::cout << "\n\tLibrary: " << library << "  Version: " << version << "\n";
+  os << "\n\tDomain: " << AnalysisOptions::getDomainName(domain);
+  os << "\n\tLibrary: " << library << "  Version: " << version << "\n";
+
+  ap_manager_free(man);
+}
+
+/// \brief Free apron managers of current thread
+void freeApronManagers()
+{
+  for (int i = 0; i < NUM_ABSTRACT_DOMAINS; i++)
+  {
+    if (managers[i] != NULL)
+    {
+      ap_manager_free(managers[i]);
+      managers[i] = NULL;
+    }
+  }
+}
+
+/// \brief Set environment of the function; transfer programs and condition
+/// constraints cached for blocks use dimensions of the old one (Apron sorts
+/// dimensions of an environment by variable name) and are dropped
+/// @param env - new environment, ownership is taken
+/// @return void (nothing)
+static void setEnvironment(ap_environment_t* env)
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  ctx->env.reset(env);
+  ctx->envVersion++;
+  ctx->clearCachedTransfers();
+}
+
+/// \brief Set apron manager for the abstract domain and set empty environment
+void initApron(AbstractDomain domain)
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  ctx->man = getApronManager(domain);
 
   // Allocate environment - initially empty
-  env = ap_environment_alloc_empty();
+  setEnvironment(ap_environment_alloc_empty());
+
+  ctx->AbsValPtr = (AbsVal *) new AbsVal;
+  ctx->AbsValPtr->abstract_value = ap_abstract1_top(ctx->man, ctx->env);
+
+  ctx->AbstractMemoryPtr = (AbstractMemory *) new AbstractMemory;
+  ctx->AbstractMemoryPtr->blockAbsVal.reset(ctx->man,
+    ap_abstract1_top(ctx->man, ctx->env));
+
+  getErrStream() << "initial abstract value:\n";
+  ap_abstract1_fprint(getErrFile(), ctx->man,
+    &(ctx->AbsValPtr->abstract_value));
+  getErrStream() << "\n";
+}
+
+/// \brief Replace current abstract value (AbsVal), old one is cleared
+void replaceAbsVal(AbstractValue absVal)
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  // AbsVal is empty after takeAbsVal()
+  if (ctx->AbsValPtr->abstract_value.abstract0 != NULL)
+  {
+    ap_abstract1_clear(ctx->man, &(ctx->AbsValPtr->abstract_value));
+  }
+
+  ctx->AbsValPtr->abstract_value = absVal.release();
+}
 
-  AbsValPtr = (AbsVal *) new AbsVal;
-  AbsValPtr->abstract_value = ap_abstract1_top(man, env);
+/// \brief Move current abstract value out of AbsVal
+AbstractValue takeAbsVal()
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  AbstractValue absVal(ctx->man, ctx->AbsValPtr->abstract_value);
 
-  AbstractMemoryPtr = (AbstractMemory *) new AbstractMemory;
-  AbstractMemoryPtr->blockAbsVal = ap_abstract1_top(man, env);
+  ctx->AbsValPtr->abstract_value.abstract0 = NULL;
+  ctx->AbsValPtr->abstract_value.env = NULL;
 
-  std::cout << "initial abstract value:\n";
-  ap_abstract1_fprint(stdout, man, &(AbsValPtr->abstract_value));
-  std::cout << "\n";
+  return absVal;
+}
+
+/// \brief Build environment of a function once with all its variables and
+/// temporaries, abstract values are set to top in the new environment
+void buildEnvironment(const std::vector<std::string>& intVarNames,
+  const std::vector<std::string>& realVarNames,
+  int numTemporaries)
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  // names of temporaries reserved for the function
+  TempVarPool& pool = ctx->tempVarPool;
+
+  pool.names.clear();
+  pool.numUsed = 0;
+
+  for (int i = 0; i < numTemporaries; i++)
+  {
+    std::stringstream ss;
+    ss << "__tmp_" << i;
+    pool.names.push_back(ss.str());
+  }
+
+  // environment copies variable names
+  std::vector<ap_var_t> intVars;
+  std::vector<ap_var_t> realVars;
+
+  for (int i = 0; i < intVarNames.size(); i++)
+  {
+    intVars.push_back((ap_var_t) intVarNames[i].c_str());
+  }
+
+  for (int i = 0; i < pool.names.size(); i++)
+  {
+    intVars.push_back((ap_var_t) pool.names[i].c_str());
+  }
+
+  for (int i = 0; i < realVarNames.size(); i++)
+  {
+    realVars.push_back((ap_var_t) realVarNames[i].c_str());
+  }
+
+  setEnvironment(ap_environment_alloc(intVars.empty() ? NULL : &intVars[0],
+    intVars.size(), realVars.empty() ? NULL : &realVars[0], realVars.size()));
+
+  updateVariableDims();
+  printGlobalVarList();
+
+  // one top value for the whole function instead of growing it variable
+  // by variable
+  ap_abstract1_clear(ctx->man, &(ctx->AbsValPtr->abstract_value));
+  ctx->AbsValPtr->abstract_value = ap_abstract1_top(ctx->man, ctx->env);
+
+  ctx->AbstractMemoryPtr->blockAbsVal.reset(ctx->man,
+    ap_abstract1_top(ctx->man, ctx->env));
+
+  getErrStream() << "\n Environment: " << intVarNames.size() << " int, ";
+  getErrStream() << realVarNames.size() << " real variables, ";
+  getErrStream() << numTemporaries << " temporaries\n";
 }
 
 /// \brief Get variable name and type for apron library and add to environment
 void getVarNameAndType(const char* varName, const char* varType)
 {
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  // variables of the function are added once by buildEnvironment(),
+  // a declaration visited again (e.g. in a loop) changes nothing
+  if (ap_environment_dim_of_var(ctx->env, (ap_var_t) varName) != AP_DIM_MAX)
+  {
+    return;
+  }
+
   const char* apronVarType = getApronDimType(varType);
 
   // Add int variable to apron environment
@@ -257,15 +718,18 @@ void getVarNameAndType(const char* varName, const char* varType)
     t_dim_int = (char **)new char*;
     t_dim_int[0] = strdup((char* )varName);
 
-    initCountForVar(varName);
-    printGlobalVarList();
+    setEnvironment(ap_environment_add(ctx->env, (ap_var_t* )t_dim_int, 1,
+      NULL, 0));
+    updateVariableDims();
 
-    env = ap_environment_add(env, (ap_var_t* )t_dim_int, 1, NULL, 0);
+    // ap_environment_add() copies the name
+    free(t_dim_int[0]);
 
-    std::cout << "abstract value:\n";
-    AbsValPtr->abstract_value = ap_abstract1_change_environment(man, true,
-      &(AbsValPtr->abstract_value), env, false);
-    ap_abstract1_fprint(stdout, man, &(AbsValPtr->abstract_value));
+    getOutStream() << "abstract value:\n";
+    ctx->AbsValPtr->abstract_value = ap_abstract1_change_environment(
+      ctx->man, true, &(ctx->AbsValPtr->abstract_value), ctx->env, false);
+    ap_abstract1_fprint(getOutFile(), ctx->man,
+      &(ctx->AbsValPtr->abstract_value));
 
 /*
     // while adding integers to environment, use MIN, MAX values from climits
@@ -319,10 +783,11 @@ void getVarNameAndType(const char* varName, const char* varType)
 
     //std::cerr << "\nUINT_MAX = " << UINT_MAX;
     //std::cerr << " ULONG_MAX = " << ULONG_MAX <<"\n";
-    ap_texpr1_t* t_texpr = ap_texpr1_cst_interval_int(env, inf, sup);
-    AbsValPtr->abstract_value = ap_abstract1_assign_texpr(man, true,
-      &(AbsValPtr->abstract_value), (char*) varName, t_texpr, NULL);
-    ap_abstract1_fprint(stdout, man, &(AbsValPtr->abstract_value));
+    ap_texpr1_t* t_texpr = ap_texpr1_cst_interval_int(ctx->env, inf, sup);
+    ctx->AbsValPtr->abstract_value = ap_abstract1_assign_texpr(ctx->man, true,
+      &(ctx->AbsValPtr->abstract_value), (char*) varName, t_texpr, NULL);
+    ap_abstract1_fprint(getOutFile(), ctx->man,
+      &(ctx->AbsValPtr->abstract_value));
 */
 
     delete t_dim_int;
@@ -335,15 +800,18 @@ void getVarNameAndType(const char* varName, const char* varType)
     t_dim_real = (char **)new char*;
     t_dim_real[0] = strdup((char* )varName);
 
-    initCountForVar(varName);
-    printGlobalVarList();
+    setEnvironment(ap_environment_add(ctx->env, NULL, 0,
+      (ap_var_t* )t_dim_real, 1));
+    updateVariableDims();
 
-    env = ap_environment_add(env, NULL, 0, (ap_var_t* )t_dim_real, 1);
+    // ap_environment_add() copies the name
+    free(t_dim_real[0]);
 
-    std::cout << "abstract value:\n";
-    AbsValPtr->abstract_value = ap_abstract1_change_environment(man, true,
-      &(AbsValPtr->abstract_value), env, false);
-    ap_abstract1_fprint(stdout, man, &(AbsValPtr->abstract_value));
+    getOutStream() << "abstract value:\n";
+    ctx->AbsValPtr->abstract_value = ap_abstract1_change_environment(
+      ctx->man, true, &(ctx->AbsValPtr->abstract_value), ctx->env, false);
+    ap_abstract1_fprint(getOutFile(), ctx->man,
+      &(ctx->AbsValPtr->abstract_value));
 
 /*
     // while adding real to environment, use MIN and MAX values from cfloat
@@ -365,18 +833,19 @@ void getVarNameAndType(const char* varName, const char* varType)
       sup = DBL_MAX;
     }
 
-    std::cerr << "\tFLT_MIN = " << FLT_MIN;
-    std::cerr << "\tFLT_MAX = " << FLT_MAX;
-    std::cerr << "\tDBL_MIN = " << DBL_MIN;
-    std::cerr << "\tDBL_MAX = " << DBL_MAX;
-    std::cerr << "\tLDBL_MIN = " << LDBL_MIN;
-    std::cerr << "\tLDBL_MAX = " << LDBL_MAX;
+    getErrStream() << "\tFLT_MIN = " << FLT_MIN;
+    getErrStream() << "\tFLT_MAX = " << FLT_MAX;
+    getErrStream() << "\tDBL_MIN = " << DBL_MIN;
+    getErrStream() << "\tDBL_MAX = " << DBL_MAX;
+    getErrStream() << "\tLDBL_MIN = " << LDBL_MIN;
+    getErrStream() << "\tLDBL_MAX = " << LDBL_MAX;
 
 
-    ap_texpr1_t* t_texpr = ap_texpr1_cst_interval_double(env, inf, sup);
-    AbsValPtr->abstract_value = ap_abstract1_assign_texpr(man, true,
-      &(AbsValPtr->abstract_value), (char*) varName, t_texpr, NULL);
-    ap_abstract1_fprint(stdout, man, &(AbsValPtr->abstract_value));
+    ap_texpr1_t* t_texpr = ap_texpr1_cst_interval_double(ctx->env, inf, sup);
+    ctx->AbsValPtr->abstract_value = ap_abstract1_assign_texpr(ctx->man, true,
+      &(ctx->AbsValPtr->abstract_value), (char*) varName, t_texpr, NULL);
+    ap_abstract1_fprint(getOutFile(), ctx->man,
+      &(ctx->AbsValPtr->abstract_value));
 */
 
     delete t_dim_real;
@@ -384,10 +853,502 @@ void getVarNameAndType(const char* varName, const char* varType)
 
 }
 
+/// \brief Get symbol of a variable declaration
+VariableCount* lookupVariable(const clang::ValueDecl* valueDecl)
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  VariableSymbolTable::const_iterator it = ctx->varSymbols.find(valueDecl);
+
+  if (it == ctx->varSymbols.end())
+  {
+    return NULL;
+  }
+
+  return it->second;
+}
+
+/// \brief Add symbol of a variable declaration
+VariableCount* addVariable(const clang::ValueDecl* valueDecl,
+  const char* varName, const char* varType)
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  VariableCount* var = lookupVariable(valueDecl);
+
+  if (var != NULL)
+  {
+    return var;
+  }
+
+  // once per name, e.g. a variable declared again in an inner scope is the
+  // same Apron variable
+  VariableCount*& named = ctx->varNames[varName];
+
+  if (named == NULL)
+  {
+    named = initCountForVar(varName, varType);
+  }
+
+  var = named;
+  ctx->varSymbols[valueDecl] = var;
+
+  return var;
+}
+
+/// \brief Set Apron dimension of every symbol
+void updateVariableDims()
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  for (int i = 0; i < ctx->globalVarList.size(); i++)
+  {
+    VariableCount* var = ctx->globalVarList[i];
+
+    var->dim = ap_environment_dim_of_var(ctx->env, (ap_var_t) var->varName);
+  }
+
+  TempVarPool& pool = ctx->tempVarPool;
+  pool.dims.resize(pool.names.size());
+
+  for (int i = 0; i < pool.names.size(); i++)
+  {
+    pool.dims[i] = ap_environment_dim_of_var(ctx->env,
+      (ap_var_t) pool.names[i].c_str());
+  }
+}
+
+/// \brief Get names of dimensions of environment of the function, for
+/// printing level-0 expressions and constraints
+char** getDimNames()
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  // variables of environment are C strings (default ap_var_operations)
+  return (char **) ctx->env.get()->var_of_dim;
+}
+
+/// \brief Print level-0 tree expression with names of variables
+void printTreeExpr(FILE* stream, ap_texpr0_t* expr)
+{
+  ap_texpr0_fprint(stream, expr, getDimNames());
+}
+
+/// \brief Check if current abstract value and expressions built by
+/// Apron.cpp are on the same environment, level-0 operations need it
+/// @return bool - true if level-0 operations can be used
+static bool isEnvironmentOfAbsVal()
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  // environments are shared by reference, no comparison of variables
+  return (ctx->AbsValPtr->abstract_value.env == ctx->env.get());
+}
+
+/// \brief Assign expressions to dimensions of current abstract value
+/// through level-0 API
+/// @param dims - dimensions of assigned variables
+/// @param exprs - expressions (not freed)
+/// @param size - number of assignments
+/// @return void (nothing)
+static void assignDimensions(ap_dim_t* dims, ap_texpr0_t** exprs,
+  size_t size)
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  ap_abstract1_t* absVal = &(ctx->AbsValPtr->abstract_value);
+
+  if (!isEnvironmentOfAbsVal())
+  {
+    *absVal = ap_abstract1_change_environment(ctx->man, true, absVal,
+      ctx->env, false);
+  }
+
+  // affine assignments are linearized once here, Apron does not have to
+  // linearize them again on this call and on runs of recorded program
+  std::vector<ap_linexpr0_t *> linexprs;
+
+  if (linearizeTreeExprArray(exprs, size, ctx->env.get()->intdim, linexprs))
+  {
+    // level-1 environment of value stays the same
+    absVal->abstract0 = ap_abstract0_assign_linexpr_array(ctx->man, true,
+      absVal->abstract0, dims, &linexprs[0], size, NULL);
+
+    if (ctx->recordingProgram)
+    {
+      ctx->recordingProgram->addLinearAssign(dims, &linexprs[0], size);
+    }
+
+    for (size_t i = 0; i < linexprs.size(); i++)
+    {
+      ap_linexpr0_free(linexprs[i]);
+    }
+
+    return;
+  }
+
+  // level-1 environment of value stays the same
+  absVal->abstract0 = ap_abstract0_assign_texpr_array(ctx->man, true,
+    absVal->abstract0, dims, exprs, size, NULL);
+
+  if (ctx->recordingProgram)
+  {
+    ctx->recordingProgram->addAssign(dims, exprs, size);
+  }
+}
+
+/// \brief Forget dimensions of current abstract value through level-0 API
+/// @param dims - dimensions of forgotten variables
+/// @param size - number of dimensions
+/// @return void (nothing)
+static void forgetDimensions(ap_dim_t* dims, size_t size)
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  ap_abstract1_t* absVal = &(ctx->AbsValPtr->abstract_value);
+
+  if (!isEnvironmentOfAbsVal())
+  {
+    *absVal = ap_abstract1_change_environment(ctx->man, true, absVal,
+      ctx->env, false);
+  }
+
+  absVal->abstract0 = ap_abstract0_forget_array(ctx->man, true,
+    absVal->abstract0, dims, size, false);
+
+  if (ctx->recordingProgram)
+  {
+    ctx->recordingProgram->addForget(dims, size);
+  }
+}
+
+/// \brief Record level-0 operations applied to current abstract value
+void startTransferRecording(TransferProgram* program)
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  ctx->recordingProgram = program;
+  ctx->recordingEnvVersion = ctx->envVersion;
+}
+
+/// \brief Dimensions assigned by a transfer program, mapped to their
+/// expressions over the values before the program (NULL - forgotten)
+typedef std::map<ap_dim_t, ap_texpr0_t *> DimSubstitution;
+
+/// \brief Largest fused expression (number of operators), fusing stops
+/// before expressions of e.g. x = x + x; x = x + x; ... blow up
+static const size_t MAX_FUSED_EXPR_SIZE = 64;
+
+/// \brief Replace dimensions of a tree expression simultaneously by their
+/// expressions of a substitution, forgotten ones by unknown value
+/// @param slot - tree expression, replaced in place
+/// @param subst - substitution of dimensions
+/// @return void (nothing)
+static void substituteDimensions(ap_texpr0_t** slot,
+  const DimSubstitution& subst)
+{
+  ap_texpr0_t* expr = *slot;
+
+  if (expr->discr == AP_TEXPR_NODE)
+  {
+    substituteDimensions(&(expr->val.node->exprA), subst);
+
+    if (expr->val.node->exprB != NULL)
+    {
+      substituteDimensions(&(expr->val.node->exprB), subst);
+    }
+
+    return;
+  }
+
+  if (expr->discr != AP_TEXPR_DIM)
+  {
+    return;
+  }
+
+  DimSubstitution::const_iterator it = subst.find(expr->val.dim);
+
+  if (it != subst.end())
+  {
+    ap_texpr0_free(expr);
+    *slot = (it->second != NULL) ?
+      ap_texpr0_copy(it->second) : ap_texpr0_cst_interval_top();
+  }
+}
+
+/// \brief Free expressions of a substitution
+/// @param subst - substitution of dimensions
+/// @return void (nothing)
+static void clearSubstitution(DimSubstitution& subst)
+{
+  DimSubstitution::iterator it;
+
+  for (it = subst.begin(); it != subst.end(); it++)
+  {
+    if (it->second != NULL)
+    {
+      ap_texpr0_free(it->second);
+    }
+  }
+
+  subst.clear();
+}
+
+/// \brief Compose operations of a straight-line transfer program into one
+/// parallel assignment (linear if possible) followed by one forget
+/// @param program - recorded program
+/// @param intdim - number of integer dimensions of environment
+/// @return TransferProgram* - fused program, NULL if an expression gets too
+///         large (program is not changed)
+static TransferProgram* fuseTransferProgram(const TransferProgram* program,
+  size_t intdim)
+{
+  DimSubstitution subst;
+
+  for (size_t i = 0; i < program->size(); i++)
+  {
+    const TransferOp& op = program->getOp(i);
+
+    if (op.kind == TRANSFER_FORGET)
+    {
+      for (size_t j = 0; j < op.dims.size(); j++)
+      {
+        DimSubstitution::iterator it = subst.find(op.dims[j]);
+
+        if (it != subst.end() && it->second != NULL)
+        {
+          ap_texpr0_free(it->second);
+        }
+
+        subst[op.dims[j]] = NULL;
+      }
+
+      continue;
+    }
+
+    // right hand sides of a parallel assignment all see values before it
+    std::vector<ap_texpr0_t *> exprs;
+
+    for (size_t j = 0; j < op.dims.size(); j++)
+    {
+      ap_texpr0_t* expr = (op.kind == TRANSFER_ASSIGN_LINEAR) ?
+        ap_texpr0_from_linexpr0(op.linexprs[j]) :
+        ap_texpr0_copy(op.exprs[j]);
+
+      substituteDimensions(&expr, subst);
+      exprs.push_back(expr);
+    }
+
+    for (size_t j = 0; j < op.dims.size(); j++)
+    {
+      DimSubstitution::iterator it = subst.find(op.dims[j]);
+
+      if (it != subst.end() && it->second != NULL)
+      {
+        ap_texpr0_free(it->second);
+      }
+
+      subst[op.dims[j]] = exprs[j];
+    }
+
+    for (size_t j = 0; j < exprs.size(); j++)
+    {
+      if (ap_texpr0_size(exprs[j]) > MAX_FUSED_EXPR_SIZE)
+      {
+        clearSubstitution(subst);
+        return NULL;
+      }
+    }
+  }
+
+  std::vector<ap_dim_t> assignDims, forgetDims;
+  std::vector<ap_texpr0_t *> assignExprs;
+  DimSubstitution::iterator it;
+
+  for (it = subst.begin(); it != subst.end(); it++)
+  {
+    if (it->second != NULL)
+    {
+      assignDims.push_back(it->first);
+      assignExprs.push_back(it->second);
+    }
+    else
+    {
+      forgetDims.push_back(it->first);
+    }
+  }
+
+  TransferProgram* fused = new TransferProgram();
+
+  if (!assignDims.empty())
+  {
+    std::vector<ap_linexpr0_t *> linexprs;
+
+    if (linearizeTreeExprArray(&assignExprs[0], assignExprs.size(), intdim,
+          linexprs))
+    {
+      fused->addLinearAssign(&assignDims[0], &linexprs[0], linexprs.size());
+
+      for (size_t i = 0; i < linexprs.size(); i++)
+      {
+        ap_linexpr0_free(linexprs[i]);
+      }
+    }
+    else
+    {
+      fused->addAssign(&assignDims[0], &assignExprs[0], assignExprs.size());
+    }
+  }
+
+  // assignment reads values before the program only, forgotten dimensions
+  // are not assigned, so forget can follow it
+  if (!forgetDims.empty())
+  {
+    fused->addForget(&forgetDims[0], forgetDims.size());
+  }
+
+  clearSubstitution(subst);
+
+  return fused;
+}
+
+/// \brief Stop recording of operations, the recorded assignments and
+/// forgets are fused into one parallel assignment and one forget
+TransferProgram* stopTransferRecording()
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  TransferProgram* program = ctx->recordingProgram;
+  ctx->recordingProgram = NULL;
+
+  // dimensions of recorded operations are not valid anymore
+  if (ctx->envVersion != ctx->recordingEnvVersion)
+  {
+    delete program;
+    return NULL;
+  }
+
+  // N assignments of a block become one domain operation per visit
+  if (program != NULL && program->size() > 1)
+  {
+    TransferProgram* fused = fuseTransferProgram(program,
+      ctx->env.get()->intdim);
+
+    if (fused != NULL)
+    {
+      if (ctx->options.verbosity > 1)
+      {
+        getErrStream() << "\n  fused " << program->size()
+          << " operations into ";
+        getErrStream() << fused->size() << "\n";
+      }
+
+      delete program;
+      program = fused;
+    }
+  }
+
+  return program;
+}
+
+/// \brief Run a recorded program on current abstract value
+void runTransferProgram(const TransferProgram* program)
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  ap_abstract1_t* absVal = &(ctx->AbsValPtr->abstract_value);
+
+  if (!isEnvironmentOfAbsVal())
+  {
+    *absVal = ap_abstract1_change_environment(ctx->man, true, absVal,
+      ctx->env, false);
+  }
+
+  program->run(ctx->man, absVal);
+}
+
+/// \brief Meet abstract value with constraints through level-0 API
+ap_abstract1_t meetConsArray(ap_abstract1_t* absVal,
+  ap_tcons0_array_t* cons)
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  ap_abstract1_t t_absVal;
+
+  if (absVal->env != ctx->env.get())
+  {
+    // value of another environment, bring it to the one of constraints
+    t_absVal = ap_abstract1_change_environment(ctx->man, false, absVal,
+      ctx->env, false);
+    t_absVal.abstract0 = ap_abstract0_meet_tcons_array(ctx->man, true,
+      t_absVal.abstract0, cons);
+
+    return t_absVal;
+  }
+
+  t_absVal.abstract0 = ap_abstract0_meet_tcons_array(ctx->man, false,
+    absVal->abstract0, cons);
+  t_absVal.env = ap_environment_copy(absVal->env);
+
+  return t_absVal;
+}
+
+/// \brief Meet abstract value with linear constraints through level-0 API
+ap_abstract1_t meetLinConsArray(ap_abstract1_t* absVal,
+  ap_lincons0_array_t* cons)
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  ap_abstract1_t t_absVal;
+
+  if (absVal->env != ctx->env.get())
+  {
+    // value of another environment, bring it to the one of constraints
+    t_absVal = ap_abstract1_change_environment(ctx->man, false, absVal,
+      ctx->env, false);
+    t_absVal.abstract0 = ap_abstract0_meet_lincons_array(ctx->man, true,
+      t_absVal.abstract0, cons);
+
+    return t_absVal;
+  }
+
+  t_absVal.abstract0 = ap_abstract0_meet_lincons_array(ctx->man, false,
+    absVal->abstract0, cons);
+  t_absVal.env = ap_environment_copy(absVal->env);
+
+  return t_absVal;
+}
+
+/// \brief Meet abstract value with constraints of a condition, linear
+/// constraints are used if they are made
+ap_abstract1_t meetCondExprCons(ap_abstract1_t* absVal, CondExprCons* cons,
+  bool negative)
+{
+  if (cons->isLinear)
+  {
+    return meetLinConsArray(absVal,
+      negative ? &(cons->linNegCondCons) : &(cons->linCondCons));
+  }
+
+  return meetConsArray(absVal,
+    negative ? &(cons->negCondCons) : &(cons->condCons));
+}
+
+/// \brief Create tree expression of a variable from its dimension
+ap_texpr0_t* createVariableExpr(const VariableCount* var)
+{
+  if (var == NULL || var->dim == AP_DIM_MAX)
+  {
+    return ap_texpr0_cst_interval_top();
+  }
+
+  return ap_texpr0_dim(var->dim);
+}
+
 /// \brief Get Apron dimension type (int or real) from const char* type
 const char* getApronDimType(const char* varType)
 {
-  const char* apronVarType;
+  const char* apronVarType = "";
 
   if ((strcmp(varType, "int") == 0) ||
       (strcmp(varType, "const int") == 0) ||
@@ -430,201 +1391,187 @@ const char* getApronDimType(const char* varType)
   return apronVarType;
 }
 
+/// \brief Assign expression to a variable, a variable not in environment
+/// (e.g. global variable) or no variable (e.g. array element) is not tracked
+/// @param var - variable symbol
+/// @param expr - tree expression
+/// @return void (nothing)
+static void assignVariable(const VariableCount* var, ap_texpr0_t* expr)
+{
+  if (var == NULL || var->dim == AP_DIM_MAX)
+  {
+    getErrStream() << "\tassigned variable is not in environment\n";
+    return;
+  }
+
+  ap_dim_t dim = var->dim;
+  assignDimensions(&dim, &expr, 1);
+}
+
 /// \brief Set value for integer literal for apron
-void setValueForIntegerLiteral(const char* varName, double dval,
+void setValueForIntegerLiteral(VariableCount* var, double dval,
   int numAssignment)
 {
-  ap_texpr1_t* t_tree_expr[1];
-  long int lival = (long int) dval;
-  t_tree_expr[0] = ap_texpr1_cst_scalar_int(env, lival);
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-  ap_texpr1_t* t_expr_ca;
-  t_expr_ca = ap_texpr1_var(env, (char *)varName);
+  long int lival = (long int) dval;
+  TreeExpr t_tree_expr(ap_texpr0_cst_scalar_int(lival));
 
   if (numAssignment > 1)
   {
-    addExpression(t_expr_ca, 0);
+    addExpression(createVariableExpr(var), 0);
   }
 
-  std::cout << "ap_texpr1_print() : ";
-  ap_texpr1_print(t_tree_expr[0]);
-  std::cout << "\n";
+  getOutStream() << "ap_texpr0_print() : ";
+  printTreeExpr(getOutFile(), t_tree_expr.get());
+  getOutStream() << "\n";
 
-  AbsValPtr->abstract_value = ap_abstract1_assign_texpr(man, true,
-    &(AbsValPtr->abstract_value), (char*) varName, t_tree_expr[0], NULL);
-  std::cout << "abstract value:\n";
-  ap_abstract1_fprint(stdout, man, &(AbsValPtr->abstract_value));
+  assignVariable(var, t_tree_expr.get());
+  getOutStream() << "abstract value:\n";
+  ap_abstract1_fprint(getOutFile(), ctx->man,
+    &(ctx->AbsValPtr->abstract_value));
 }
 
 /// \brief Set value for floating literal for apron
-void setValueForFloatingLiteral(const char* varName, double dval,
+void setValueForFloatingLiteral(VariableCount* var, double dval,
   int numAssignment)
 {
-  ap_texpr1_t* t_tree_expr[1];
-  t_tree_expr[0] = ap_texpr1_cst_scalar_double(env, dval);
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-  ap_texpr1_t* t_expr_ca;
-  t_expr_ca = ap_texpr1_var(env, (char *)varName);
+  TreeExpr t_tree_expr(ap_texpr0_cst_scalar_double(dval));
 
   if (numAssignment > 1)
   {
-    addExpression(t_expr_ca, 1);
+    addExpression(createVariableExpr(var), 1);
   }
 
-  std::cout << "ap_texpr1_print() : ";
-  ap_texpr1_print(t_tree_expr[0]);
-  std::cout << "\n";
+  getOutStream() << "ap_texpr0_print() : ";
+  printTreeExpr(getOutFile(), t_tree_expr.get());
+  getOutStream() << "\n";
 
-  AbsValPtr->abstract_value = ap_abstract1_assign_texpr(man, true,
-    &(AbsValPtr->abstract_value), (char*) varName, t_tree_expr[0], NULL);
-  std::cout << "abstract value:\n";
-  ap_abstract1_fprint(stdout, man, &(AbsValPtr->abstract_value));
+  assignVariable(var, t_tree_expr.get());
+  getOutStream() << "abstract value:\n";
+  ap_abstract1_fprint(getOutFile(), ctx->man,
+    &(ctx->AbsValPtr->abstract_value));
 }
 
 /// \brief Set value for variable on RHS for apron
-void setValueForRHSVariable(const char* varName, const char* rhsVarName,
-  const char* varType, int numAssignment)
+void setValueForRHSVariable(VariableCount* var, VariableCount* rhsVar,
+  int numAssignment)
 {
-  ap_texpr1_t* t_tree_expr[1];
-  t_tree_expr[0] = ap_texpr1_var(env, (char *) rhsVarName);
-
-  ap_texpr1_t* t_expr_ca;
-  t_expr_ca = ap_texpr1_var(env, (char *)varName);
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-  const char* apronVarType = getApronDimType(varType);
-  int exprType = 0;
-
-  // Add int variable to apron environment
-  if (strcmp(apronVarType, "int") == 0)
-  {
-    exprType = 0;
-  }
-  else
-  if (strcmp(apronVarType, "real") == 0)
-  {
-    exprType = 1;
-  }
+  TreeExpr t_tree_expr(createVariableExpr(rhsVar));
+
+  int exprType = rhsVar->isReal ? 1 : 0;
 
   if (numAssignment > 1)
   {
-    addExpression(t_expr_ca, exprType);
+    addExpression(createVariableExpr(var), exprType);
   }
 
-  std::cout << "ap_texpr1_print() : ";
-  ap_texpr1_print(t_tree_expr[0]);
-  std::cout << "\n";
+  getOutStream() << "ap_texpr0_print() : ";
+  printTreeExpr(getOutFile(), t_tree_expr.get());
+  getOutStream() << "\n";
 
-  AbsValPtr->abstract_value = ap_abstract1_assign_texpr(man, true,
-    &(AbsValPtr->abstract_value), (char*) varName, t_tree_expr[0], NULL);
-  std::cout << "abstract value:\n";
-  ap_abstract1_fprint(stdout, man, &(AbsValPtr->abstract_value));
+  assignVariable(var, t_tree_expr.get());
+  getOutStream() << "abstract value:\n";
+  ap_abstract1_fprint(getOutFile(), ctx->man,
+    &(ctx->AbsValPtr->abstract_value));
 }
 
 /// \brief Evaluate assignment for apron
-void evaluateAssignment(const char* lhsVarName, int numAssignment,
+void evaluateAssignment(VariableCount* lhsVar, int numAssignment,
   bool isLastStatement)
 {
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
   MyApronExpr* t_node;
   t_node = removeExpression();
-  ap_texpr1_t* t_expr;
-  t_expr = t_node->data;
 
-  ap_texpr1_t* t_expr_ca;
-  t_expr_ca = ap_texpr1_var(env, (ap_var_t)lhsVarName);
+  // expression removed from stack is freed once it is assigned
+  TreeExpr t_expr(t_node->data);
 
   if (numAssignment > 1)
   {
-    addExpression(t_expr_ca, t_node->expr_type);
+    addExpression(createVariableExpr(lhsVar), t_node->expr_type);
     showExpression();
-    std::cout << "\n";
+    getOutStream() << "\n";
   }
 
-  std::cout << "\n";
-  ap_texpr1_print(t_expr);
-  std::cout << "\n";
+  getOutStream() << "\n";
+  printTreeExpr(getOutFile(), t_expr.get());
+  getOutStream() << "\n";
 
-  AbsValPtr->abstract_value = ap_abstract1_assign_texpr(man, true,
-    &(AbsValPtr->abstract_value), (char*)lhsVarName, t_expr, NULL);
-  std::cout << " abstract value:\n";
-  ap_abstract1_fprint(stdout, man, &(AbsValPtr->abstract_value));
+  assignVariable(lhsVar, t_expr.get());
+  getOutStream() << " abstract value:\n";
+  ap_abstract1_fprint(getOutFile(), ctx->man,
+    &(ctx->AbsValPtr->abstract_value));
 
   // if assignment has happened, reset count for variable on LHS
-  resetCountForVarOnLHS(lhsVarName);
+  resetCountForVarOnLHS(lhsVar);
 
   updateAbsValFromGlobalVarList();
 
-  // if this is last statement of block, add current block abstract value
-  // in AbstractMemory->blockAbsVal to be added into MyCFGInfo->blockAbsVal
-  std::cerr << "\tisLastStatement = " << isLastStatement << "\n";
-
-  if (isLastStatement)
-  {
-    AbstractMemoryPtr->blockAbsVal = ap_abstract1_copy(man,
-      &(AbsValPtr->abstract_value));
-  }
+  // abstract value of last statement of block is stored in
+  // AbstractMemory->blockAbsVal by processBlock() at end of block, no copy
+  // here
+  getErrStream() << "\tisLastStatement = " << isLastStatement << "\n";
 }
 
 /// \brief Reset count for a variable on LHS
-void resetCountForVarOnLHS(const char* lhsVarName)
+void resetCountForVarOnLHS(VariableCount* lhsVar)
 {
-  VariableCount * newVar;
-
-  for (int i = 0; i < globalVarList.size(); i++)
+  if (lhsVar)
   {
-    newVar = globalVarList[i];
-
-    if (strcmp(lhsVarName, newVar->varName) == 0)
-    {
-      newVar->varCount = 0;
-    }
+    lhsVar->varCount = 0;
   }
 }
 
 /// \brief Get integer literal for apron
 void getIntegerLiteral(double dval)
 {
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
   long int lival = (long int) dval;
-  ap_texpr1_t* t_tree_expr = ap_texpr1_cst_scalar_int(env, lival);
+  ap_texpr0_t* t_tree_expr = ap_texpr0_cst_scalar_int(lival);
 
   addExpression(t_tree_expr, 0);
 
   showExpression();
-  std::cout << "\n";
+  getOutStream() << "\n";
 }
 
 /// \brief Get floating literal for apron
 void getFloatingLiteral(double dval)
 {
-  ap_texpr1_t* t_tree_expr = ap_texpr1_cst_scalar_double(env, dval);
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  ap_texpr0_t* t_tree_expr = ap_texpr0_cst_scalar_double(dval);
 
   addExpression(t_tree_expr, 1);
 
   showExpression();
-  std::cout << "\n";
+  getOutStream() << "\n";
 }
 
 /// \brief Get variable for apron
-void getVariable(const char* varName, const char* varType)
+void getVariable(VariableCount* var)
 {
-  int count;
-  ap_texpr1_t * my_tree_expr[3];
-
-  count = getCountForVar(varName);
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-  if (count != -1)
-  {
-    my_tree_expr[0] = ap_texpr1_cst_scalar_int(env, (long int)count);
-    my_tree_expr[1] = ap_texpr1_var(env, (ap_var_t)varName);
-    my_tree_expr[2] = ap_texpr1_binop(AP_TEXPR_ADD, my_tree_expr[1],
-      my_tree_expr[0], AP_RTYPE_INT, AP_RDIR_ZERO);
-  }
+  ap_texpr0_t * my_tree_expr[3];
 
-  ap_texpr1_t* t_tree_expr;
-  t_tree_expr = ap_texpr1_copy(my_tree_expr[2]);
+  // value of variable is its value plus pending count of increments
+  my_tree_expr[0] = ap_texpr0_cst_scalar_int((long int) var->varCount);
+  my_tree_expr[1] = createVariableExpr(var);
+  my_tree_expr[2] = ap_texpr0_binop(AP_TEXPR_ADD, my_tree_expr[1],
+    my_tree_expr[0], AP_RTYPE_INT, AP_RDIR_ZERO);
 
-  const char* apronVarType = getApronDimType(varType);
+  ap_texpr0_t* t_tree_expr;
+  t_tree_expr = my_tree_expr[2];
 
-  if (strcmp(apronVarType, "real") == 0)
+  if (var->isReal)
   {
     addExpression(t_tree_expr, 1);
   }
@@ -634,16 +1581,132 @@ void getVariable(const char* varName, const char* varType)
   }
 
   showExpression();
-  std::cout << "\n";
+  getOutStream() << "\n";
+}
+
+/// \brief Apron operator of a binary arithmetic operator, compound
+/// assignments apply the operator of their arithmetic counterpart
+typedef struct BinOpEntry
+{
+  /// \brief Clang operator
+  clang::BinaryOperatorKind opcode;
+
+  /// \brief Apron tree expression operator
+  ap_texpr_op_t apronOp;
+} BinOpEntry;
+
+/// \brief Table of binary arithmetic operators
+static const BinOpEntry binOpTable[] =
+{
+  { clang::BO_Add,       AP_TEXPR_ADD },
+  { clang::BO_AddAssign, AP_TEXPR_ADD },
+  { clang::BO_Sub,       AP_TEXPR_SUB },
+  { clang::BO_SubAssign, AP_TEXPR_SUB },
+  { clang::BO_Mul,       AP_TEXPR_MUL },
+  { clang::BO_MulAssign, AP_TEXPR_MUL },
+  { clang::BO_Div,       AP_TEXPR_DIV },
+  { clang::BO_DivAssign, AP_TEXPR_DIV },
+  { clang::BO_Rem,       AP_TEXPR_MOD },
+  { clang::BO_RemAssign, AP_TEXPR_MOD }
+};
+
+/// \brief Constraints of a relational operator (lhs relop rhs) and of its
+/// negation on e = (lhs - rhs): constraint is (e constyp 0) or, if
+/// isNegated, (-e constyp 0)
+typedef struct RelOpEntry
+{
+  /// \brief Clang operator
+  clang::BinaryOperatorKind opcode;
+
+  /// \brief Type of constraint of condition
+  ap_constyp_t constyp;
+
+  /// \brief Flag if constraint of condition is on -e
+  bool isNegated;
+
+  /// \brief Type of constraint of negation of condition
+  ap_constyp_t negConstyp;
+
+  /// \brief Flag if constraint of negation of condition is on -e
+  bool isNegNegated;
+} RelOpEntry;
+
+/// \brief Table of relational operators
+/// condition  : constraint    : negation
+/// -----------:---------------:---------------
+/// a >  b     : a - b >  0    : -(a - b) >= 0
+/// a >= b     : a - b >= 0    : -(a - b) >  0
+/// a <  b     : -(a - b) >  0 : a - b >= 0
+/// a <= b     : -(a - b) >= 0 : a - b >  0
+/// a == b     : a - b  = 0    : -(a - b) != 0
+/// a != b     : a - b != 0    : -(a - b)  = 0
+static const RelOpEntry relOpTable[] =
+{
+  { clang::BO_GT, AP_CONS_SUP,   false, AP_CONS_SUPEQ, true  },
+  { clang::BO_GE, AP_CONS_SUPEQ, false, AP_CONS_SUP,   true  },
+  { clang::BO_LT, AP_CONS_SUP,   true,  AP_CONS_SUPEQ, false },
+  { clang::BO_LE, AP_CONS_SUPEQ, true,  AP_CONS_SUP,   false },
+  { clang::BO_EQ, AP_CONS_EQ,    false, AP_CONS_DISEQ, true  },
+  { clang::BO_NE, AP_CONS_DISEQ, false, AP_CONS_EQ,    true  }
+};
+
+/// \brief Find entry of a binary arithmetic operator
+/// @param opcode - clang operator
+/// @return const BinOpEntry* - entry, NULL if operator has none
+static const BinOpEntry* findBinOp(clang::BinaryOperatorKind opcode)
+{
+  for (int i = 0; i < sizeof(binOpTable) / sizeof(binOpTable[0]); i++)
+  {
+    if (binOpTable[i].opcode == opcode)
+    {
+      return &binOpTable[i];
+    }
+  }
+
+  return NULL;
+}
+
+/// \brief Find entry of a relational operator
+/// @param opcode - clang operator
+/// @return const RelOpEntry* - entry, NULL if operator has none
+static const RelOpEntry* findRelOp(clang::BinaryOperatorKind opcode)
+{
+  for (int i = 0; i < sizeof(relOpTable) / sizeof(relOpTable[0]); i++)
+  {
+    if (relOpTable[i].opcode == opcode)
+    {
+      return &relOpTable[i];
+    }
+  }
+
+  return NULL;
+}
+
+/// \brief Get printable name of a binary operator (e.g. "+=")
+/// @param opcode - clang operator
+/// @return const char* - name of operator
+static const char* getOpcodeName(clang::BinaryOperatorKind opcode)
+{
+  return clang::BinaryOperator::getOpcodeStr(opcode);
+}
+
+/// \brief Get printable name of a unary operator (e.g. "-")
+/// @param opcode - clang operator
+/// @return const char* - name of operator
+static const char* getOpcodeName(clang::UnaryOperatorKind opcode)
+{
+  return clang::UnaryOperator::getOpcodeStr(opcode);
 }
 
 /// \brief Create single expression for binop for apron
-void createSingleExpressionForBinOp(const char* opcode)
+void createSingleExpressionForBinOp(clang::BinaryOperatorKind opcode)
 {
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
   // get both expressions
 
   MyApronExpr * t_node1, * t_node2;
-  ap_texpr1_t * texpr1, * texpr2;
+  ap_texpr0_t * texpr1, * texpr2;
   int exprType1, exprType2;
 
   // first removeExpression() gives rhs (or second operand)
@@ -655,183 +1718,115 @@ void createSingleExpressionForBinOp(const char* opcode)
   texpr1 = t_node2->data;
   texpr2 = t_node1->data;
 
-  // For unary incr/decr operators
-  int compare = ap_environment_compare(texpr1->env, texpr2->env);
-
-  if (compare == -1)
-  {
-    //env of lhs is a subset of env of rhs
-    texpr1 = ap_texpr1_extend_environment(texpr1, texpr2->env);
-  }
-  else
-  if (compare == 1)
-  {
-    //env of rhs is a subset of env of lhs
-    texpr2 = ap_texpr1_extend_environment(texpr2, texpr1->env);
-  }
+  // both operands are built on the environment of the function, which
+  // does not change during analysis (see buildEnvironment())
 
   // and find resultant expr_type
   exprType1 = t_node1->expr_type;
   exprType2 = t_node2->expr_type;
 
   if (exprType1 == 1 || exprType2 == 1)
-    expr_type = 1;
+    ctx->expr_type = 1;
   else
-    expr_type = 0;
+    ctx->expr_type = 0;
 
   // print opcode, lhs and rhs expr, expr_type
-  std::cout << " opcode : " << opcode;
-  std::cout << " \n";
-  std::cout << " o ap_texpr1_print() : ";
-  ap_texpr1_print(texpr1);
-  std::cout << " \n";
-  std::cout << " o ap_texpr1_print() : ";
-  ap_texpr1_print(texpr2);
-  std::cout << " \n";
-  std::cout << " expr_type : " << expr_type;
-  std::cout << " \n";
+  getOutStream() << " opcode : " << getOpcodeName(opcode);
+  getOutStream() << " \n";
+  getOutStream() << " o ap_texpr0_print() : ";
+  printTreeExpr(getOutFile(), texpr1);
+  getOutStream() << " \n";
+  getOutStream() << " o ap_texpr0_print() : ";
+  printTreeExpr(getOutFile(), texpr2);
+  getOutStream() << " \n";
+  getOutStream() << " expr_type : " << ctx->expr_type;
+  getOutStream() << " \n";
 
   // create a single expression from texpr1 and texpr2
   // for current opcode and expr_type
-  // Note:- both operands of ap_texpr1_binop i.e. texpr1 and texpr2
+  // Note:- both operands of ap_texpr0_binop i.e. texpr1 and texpr2
   // are memory managed - dereferenced after the function call
 
-  ap_texpr1_t* texpr_bo;
+  ap_texpr0_t* texpr_bo;
+  const BinOpEntry* entry = findBinOp(opcode);
 
-  if ((strcmp(opcode, "+") == 0) ||
-      (strcmp(opcode, "+=") == 0) )
-  {
-    if (expr_type == 1)
-    {
-      texpr_bo = ap_texpr1_binop(AP_TEXPR_ADD, texpr1, texpr2,
-        AP_RTYPE_SINGLE, AP_RDIR_ZERO);
-    }
-    else
-    {
-      texpr_bo = ap_texpr1_binop(AP_TEXPR_ADD, texpr1, texpr2,
-        AP_RTYPE_INT, AP_RDIR_ZERO);
-    }
-  }
-  else
-  if ((strcmp(opcode, "-") == 0) ||
-      (strcmp(opcode, "-=") == 0) )
+  if (entry == NULL ||
+      (entry->apronOp == AP_TEXPR_MOD && ctx->expr_type == 1))
   {
-    if (expr_type == 1)
-    {
-      texpr_bo = ap_texpr1_binop(AP_TEXPR_SUB, texpr1, texpr2,
-        AP_RTYPE_SINGLE, AP_RDIR_ZERO);
-    }
-    else
-    {
-      texpr_bo = ap_texpr1_binop(AP_TEXPR_SUB, texpr1, texpr2,
-        AP_RTYPE_INT, AP_RDIR_ZERO);
-    }
-  }
-  else
-  if ((strcmp(opcode, "*") == 0) ||
-      (strcmp(opcode, "*=") == 0) )
-  {
-    if (expr_type == 1)
-    {
-      texpr_bo = ap_texpr1_binop(AP_TEXPR_MUL, texpr1, texpr2,
-        AP_RTYPE_SINGLE, AP_RDIR_ZERO);
-    }
-    else
-    {
-      texpr_bo = ap_texpr1_binop(AP_TEXPR_MUL, texpr1, texpr2,
-        AP_RTYPE_INT, AP_RDIR_ZERO);
-    }
-  }
-  else
-  if ((strcmp(opcode, "/") == 0) ||
-      (strcmp(opcode, "/=") == 0) )
-  {
-    if (expr_type == 1)
-    {
-      texpr_bo = ap_texpr1_binop(AP_TEXPR_DIV, texpr1, texpr2,
-        AP_RTYPE_SINGLE, AP_RDIR_ZERO);
-    }
-    else
-    {
-      texpr_bo = ap_texpr1_binop(AP_TEXPR_DIV, texpr1, texpr2,
-        AP_RTYPE_INT, AP_RDIR_ZERO);
-    }
+    getErrStream() << "Error: no Apron operator for " << getOpcodeName(opcode);
+    getErrStream() << " with these operands\n";
+
+    // nothing known about the result
+    ap_texpr0_free(texpr1);
+    ap_texpr0_free(texpr2);
+    texpr_bo = ap_texpr0_cst_interval_top();
   }
   else
-  if ((strcmp(opcode, "%") == 0) ||
-      (strcmp(opcode, "%=") == 0) )
   {
-    if (expr_type == 1)
-    {
-      std::cerr << "Error: real operand found for %, ";
-      std::cerr << "binary operator mod cannot have real operands" << "\n";
-    }
-    else
-    {
-      texpr_bo = ap_texpr1_binop(AP_TEXPR_MOD, texpr1, texpr2,
-        AP_RTYPE_INT, AP_RDIR_ZERO);
-    }
+    texpr_bo = ap_texpr0_binop(entry->apronOp, texpr1, texpr2,
+      (ctx->expr_type == 1) ? AP_RTYPE_SINGLE : AP_RTYPE_INT, AP_RDIR_ZERO);
   }
 
-  std::cout << " +1 ap_texpr1_print() : ";
-  ap_texpr1_print(texpr_bo);
-  std::cout << "\n";
+  getOutStream() << " +1 ap_texpr0_print() : ";
+  printTreeExpr(getOutFile(), texpr_bo);
+  getOutStream() << "\n";
 
   // and now add this single apron expression to MyApronExpr list
-  addExpression(texpr_bo, expr_type);
+  addExpression(texpr_bo, ctx->expr_type);
 
   showExpression();
-  std::cout << "\n";
+  getOutStream() << "\n";
 }
 
 /// \brief Create constraint for binary relational operator for apron
-void createConstraintForBinRelOp(const char* opcode)
+void createConstraintForBinRelOp(clang::BinaryOperatorKind opcode)
 {
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
   // create expression of form (lhs - rhs) for (lhs relop rhs)
   // e.g. for condition (a > b), create (a - b)
-  createSingleExpressionForBinOp("-");
+  createSingleExpressionForBinOp(clang::BO_Sub);
 
   // get expressions: (lhs - rhs) and -(lhs - rhs)
   // e.g. for condition (a > b), t_texpr = (a - b) and t_texpr_neg = -(a - b)
   MyApronExpr * t_last_expr;
   t_last_expr = removeExpression();
 
-  ap_texpr1_t * t_texpr, * t_texpr_neg;
+  ap_texpr0_t * t_texpr, * t_texpr_neg;
   t_texpr = t_last_expr->data;
 
   // copy texpr and apply unary negative to negate the expression
-  t_texpr_neg = ap_texpr1_copy(t_texpr);
-  t_texpr_neg = ap_texpr1_unop(AP_TEXPR_NEG, t_texpr_neg, AP_RTYPE_INT,
+  t_texpr_neg = ap_texpr0_copy(t_texpr);
+  t_texpr_neg = ap_texpr0_unop(AP_TEXPR_NEG, t_texpr_neg, AP_RTYPE_INT,
     AP_RDIR_ZERO);
 
-  //if (int isScalar = ap_texpr1_is_scalar(t_texpr))
-  if (int isScalar = ap_texpr1_is_interval_cst(t_texpr))
+  //if (int isScalar = ap_texpr0_is_scalar(t_texpr))
+  if (int isScalar = ap_texpr0_is_interval_cst(t_texpr))
   {
-    std::cout << "\nconditional expression is scalar, treated as true\n";
+    getOutStream() << "\nconditional expression is scalar, treated as true\n";
   }
 
   // let's see what we've got so far
-  std::cout << " opcode : " << opcode << "\n";
+  getOutStream() << " opcode : " << getOpcodeName(opcode) << "\n";
 
-  std::cout << " o ap_texpr1_print() : ";
-  ap_texpr1_print(t_texpr);
-  std::cout << " \n";
+  getOutStream() << " o ap_texpr0_print() : ";
+  printTreeExpr(getOutFile(), t_texpr);
+  getOutStream() << " \n";
 
-  std::cout << " o ap_texpr1_print() : ";
-  ap_texpr1_print(t_texpr_neg);
-  std::cout << " \n";
+  getOutStream() << " o ap_texpr0_print() : ";
+  printTreeExpr(getOutFile(), t_texpr_neg);
+  getOutStream() << " \n";
 
-  std::cout << " abstract value: before " << opcode << "\n";
-  ap_abstract1_fprint(stdout, man, &(AbsValPtr->abstract_value));
-  std::cout << " \n";
+  getOutStream() << " abstract value: before " << getOpcodeName(opcode) << "\n";
+  ap_abstract1_fprint(getOutFile(), ctx->man,
+    &(ctx->AbsValPtr->abstract_value));
+  getOutStream() << " \n";
 
   // create tree constraints for t_texpr and t_texpr_neg
-  ap_tcons1_t t_tcons, t_tcons_neg;
-  int satisfy_texpr = 0;
-  int satisfy_texpr_neg = 0;
+  TreeCons t_tcons, t_tcons_neg;
 
   /* Note:-
-   * ap_tconst1_t ap_tcons1_make(ap_constyp_t constyp, ap_texpr1_t* expr,
+   * ap_tcons0_t ap_tcons0_make(ap_constyp_t constyp, ap_texpr0_t* expr,
    *      ap_scalar_t* scalar)
    * - creates a constraint of given type with the given expression.
    * enum ap_constyp_t    : type of constraints
@@ -841,193 +1836,101 @@ void createConstraintForBinRelOp(const char* opcode)
    *      AP_CONS_DISEQ   : disequality constraint
    */
 
-  if (strcmp(opcode, ">") == 0)
-  {
-    t_tcons = ap_tcons1_make(AP_CONS_SUP, t_texpr, NULL);
+  const RelOpEntry* entry = findRelOp(opcode);
 
-    t_tcons_neg = ap_tcons1_make(AP_CONS_SUPEQ, t_texpr_neg, NULL);
-  }
-  else
-  if (strcmp(opcode, ">=") == 0)
+  if (entry == NULL)
   {
-    t_tcons = ap_tcons1_make(AP_CONS_SUPEQ, t_texpr, NULL);
+    fprintf(getErrFile(), "Unknown operator %s", getOpcodeName(opcode));
 
-    t_tcons_neg = ap_tcons1_make(AP_CONS_SUP, t_texpr_neg, NULL);
+    // nothing known about the condition
+    ap_texpr0_free(t_texpr);
+    ap_texpr0_free(t_texpr_neg);
+    CondExprCons t_CondExprCons = makeCondExprCons(2);
+    addCondExprCons(t_CondExprCons.condCons, t_CondExprCons.negCondCons);
+    return;
   }
-  else
-  if (strcmp(opcode, "<") == 0)
-  {
-    t_tcons = ap_tcons1_make(AP_CONS_SUP, t_texpr_neg, NULL);
 
-    t_tcons_neg = ap_tcons1_make(AP_CONS_SUPEQ, t_texpr, NULL);
-  }
-  else
-  if (strcmp(opcode, "<=") == 0)
-  {
-    t_tcons = ap_tcons1_make(AP_CONS_SUPEQ, t_texpr_neg, NULL);
+  // each of t_texpr and t_texpr_neg is used by one constraint
+  t_tcons.reset(ap_tcons0_make(entry->constyp,
+    entry->isNegated ? t_texpr_neg : t_texpr, NULL));
 
-    t_tcons_neg = ap_tcons1_make(AP_CONS_SUP, t_texpr, NULL);
-  }
-  else
-  if (strcmp(opcode, "==") == 0)
-  {
-    t_tcons = ap_tcons1_make(AP_CONS_EQ, t_texpr, NULL);
+  t_tcons_neg.reset(ap_tcons0_make(entry->negConstyp,
+    entry->isNegNegated ? t_texpr_neg : t_texpr, NULL));
 
-    t_tcons_neg = ap_tcons1_make(AP_CONS_DISEQ, t_texpr_neg, NULL);
-  }
-  else
-  if (strcmp(opcode, "!=") == 0)
-  {
-    t_tcons = ap_tcons1_make(AP_CONS_DISEQ, t_texpr, NULL);
+  // what are t_tcons and t_tcons_neg? see relOpTable
 
-    t_tcons_neg = ap_tcons1_make(AP_CONS_EQ, t_texpr_neg, NULL);
-  }
-  else
-  {
-    fprintf(stderr, "Unknown operator %s", opcode);
-  }
-
-  // what are t_tcons and t_tcons_neg?
-  // condition  : t_tcons       : t_tcons_neg
-  // -----------:---------------:---------------
-  // a >  b     : a - b >  0    : -(a - b) >= 0
-  // a >= b     : a - b >= 0    : -(a - b) >  0
-  // a <  b     : -(a - b) >  0 : a - b >= 0
-  // a <= b     : -(a - b) >= 0 : a - b >  0
-  // a == b     : a - b  = 0    : a - b != 0
-  // a != b     : a - b != 0    : a - b  = 0
-  
-  std::cout << "\nt_tcons\n";
-  ap_tcons1_fprint(stdout, &t_tcons);
-  std::cout << "\nt_tcons_neg\n";
-  ap_tcons1_fprint(stdout, &t_tcons_neg);
-  std::cout << "\n";
+  getOutStream() << "\nt_tcons\n";
+  ap_tcons0_fprint(getOutFile(), t_tcons.get(), getDimNames());
+  getOutStream() << "\nt_tcons_neg\n";
+  ap_tcons0_fprint(getOutFile(), t_tcons_neg.get(), getDimNames());
+  getOutStream() << "\n";
 
   updateAbsValFromGlobalVarList();
 
-  // does the abstract value (before relational op) satisfy this constraint
-  satisfy_texpr = ap_abstract1_sat_tcons(man, &(AbsValPtr->abstract_value),
-    &t_tcons);
-  std::cout << "\nsatisfy_texpr = " << satisfy_texpr << "\n";
-
-  satisfy_texpr_neg = ap_abstract1_sat_tcons(man, &(AbsValPtr->abstract_value),
-    &t_tcons_neg);
-  std::cout << "\nsatisfy_texpr_neg = " << satisfy_texpr_neg << "\n";
- 
-  // fill tree constraints array with tree constraints
-  // in order to generate abstract value for debug purpose
-  // and deallocate tree constraints array
-  ap_tcons1_array_t t_consarray;
-  ap_abstract1_t t_abs_value;
-  ap_abstract1_t t_abs_value_neg;
-
-  // e.g. for condition (a > b), create tconsarray (a - b) == 0
-  t_consarray = ap_tcons1_array_make(env, 1);
-  ap_tcons1_array_set(&t_consarray, 0, &t_tcons);
-
-  t_abs_value = ap_abstract1_of_tcons_array(man, env, &t_consarray);
-  std::cout << " abstract value: t_abs_value\n";
-  ap_abstract1_fprint(stdout, man, &t_abs_value);
-  std::cout << " \n";
-
-  ap_tcons1_array_clear(&t_consarray);
-
-  // e.g. for condition (a > b), create tconsarray -(a - b) == 0
-  t_consarray = ap_tcons1_array_make(env, 1);
-  ap_tcons1_array_set(&t_consarray, 0, &t_tcons_neg);
-
-  t_abs_value_neg = ap_abstract1_of_tcons_array(man, env, &t_consarray);
-  std::cout << " abstract value: t_abs_value_neg\n";
-  ap_abstract1_fprint(stdout, man, &t_abs_value_neg);
-  std::cout << " \n";
-
-  ap_tcons1_array_clear(&t_consarray);
-
-  // set AbstractMemory - current abstract value for block, condition
-  // negation of condition
-
-  addCondExprAbsVal(t_abs_value, t_abs_value_neg);
-  showCondExprAbsVal();
+  // put constraints in arrays (array owns constraint set in it), they are
+  // met with the abstract value of the block by processBlock()
+  addCondExprCons(makeConsArray(t_tcons.release()),
+    makeConsArray(t_tcons_neg.release()));
+  showCondExprCons();
 }
 
-/// \brief Set abstract values for while(1) and while(0) cases
+/// \brief Set condition constraints for while(1) and while(0) cases
 void setAbstractMemory(int positive)
 {
-  // set AbstractMemory - current abstract value for block, condition,
-  // negation of condition
-
-  if (positive == 1)
-  {
-    // condition is: while (1)
-    AbstractMemoryPtr->blockAbsVal = ap_abstract1_copy(man,
-      &(AbsValPtr->abstract_value));
-    
-    addCondExprAbsVal(ap_abstract1_top(man, env),
-      ap_abstract1_bottom(man, env));
-  }
-  else
-  if (positive == 0)
-  {
-    // condition is: while (0)
-    AbstractMemoryPtr->blockAbsVal = ap_abstract1_copy(man,
-      &(AbsValPtr->abstract_value));
-
-    addCondExprAbsVal(ap_abstract1_bottom(man, env),
-      ap_abstract1_top(man, env));
-  }
-  else
-  if (positive == 2)
-  {
-    // condition is: while (x)
-    AbstractMemoryPtr->blockAbsVal = ap_abstract1_copy(man,
-      &(AbsValPtr->abstract_value));
-
-    addCondExprAbsVal(ap_abstract1_top(man, env),
-      ap_abstract1_top(man, env));
-  }
-
-  std::cerr << "\nAbstractMemory\n";
-  ap_abstract1_fprint(stderr, man, &(AbstractMemoryPtr->blockAbsVal));
-  showCondExprAbsVal();
-  std::cout << "\n";
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  // set constraints of condition, negation of condition; current
+  // abstract value is met with them for block by processBlock()
+  // positive 1 - while (1), 0 - while (0), 2 - while (x)
+  CondExprCons t_CondExprCons = makeCondExprCons(positive);
+  addCondExprCons(t_CondExprCons.condCons, t_CondExprCons.negCondCons);
+
+  getErrStream() << "\nAbstractMemory\n";
+  ap_abstract1_fprint(getErrFile(), ctx->man,
+    &(ctx->AbsValPtr->abstract_value));
+  showCondExprCons();
+  getOutStream() << "\n";
 }
 
-/// \brief Update abstract values for logical not
+/// \brief Update condition constraints for logical not
 void updateAbstractValuesForLNot()
 {
-  CondExprAbsVal* t_CondExprAbsVal;
-  t_CondExprAbsVal = removeCondExprAbsVal();
+  CondExprCons* t_CondExprCons;
+  t_CondExprCons = removeCondExprCons();
 
-  ap_abstract1_t t_absVal, t_negAbsVal;
-  t_absVal = t_CondExprAbsVal->condAbsVal;
-  t_negAbsVal = t_CondExprAbsVal->negCondAbsVal;
+  if (t_CondExprCons == NULL)
+  {
+    return;
+  }
 
-  addCondExprAbsVal(t_negAbsVal, t_absVal);
+  addCondExprCons(t_CondExprCons->negCondCons, t_CondExprCons->condCons);
 
-  std::cerr << "\n  after swapping condAbsVal and negCondAbsval for LNot !\n";
-  showCondExprAbsVal();
-  std::cout << "\n";
+  getErrStream() << "\n  after swapping condCons and negCondCons for LNot !\n";
+  showCondExprCons();
+  getOutStream() << "\n";
 }
 
 /// \brief Get integer literal (unary op) for apron
-void getIntegerLiteralUnaryOp(double dval, const char* opcode)
+void getIntegerLiteralUnaryOp(double dval, clang::UnaryOperatorKind opcode)
 {
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
   long int lival = (long int) dval;
 
-  ap_texpr1_t* t_tree_expr[1];
-  t_tree_expr[0] = ap_texpr1_cst_scalar_int(env, lival);
+  ap_texpr0_t* t_tree_expr[1];
+  t_tree_expr[0] = ap_texpr0_cst_scalar_int(lival);
 
-  ap_texpr1_t* t_texpr1;
+  ap_texpr0_t* t_texpr1;
 
   // add expression with integer expr_type 0
-  if (strcmp(opcode, "-") == 0)
+  if (opcode == clang::UO_Minus)
   {
-    t_texpr1 = ap_texpr1_unop(AP_TEXPR_NEG, t_tree_expr[0],
+    t_texpr1 = ap_texpr0_unop(AP_TEXPR_NEG, t_tree_expr[0],
       AP_RTYPE_INT, AP_RDIR_ZERO);
     addExpression(t_texpr1, 0);
   }
   else
-  if (strcmp(opcode, "+") == 0)
+  if (opcode == clang::UO_Plus)
   {
     addExpression(t_tree_expr[0], 0);
   }
@@ -1035,22 +1938,24 @@ void getIntegerLiteralUnaryOp(double dval, const char* opcode)
 }
 
 /// \brief Get floating literal (unary op) for apron
-void getFloatingLiteralUnaryOp(double dval, const char* opcode)
+void getFloatingLiteralUnaryOp(double dval, clang::UnaryOperatorKind opcode)
 {
-  ap_texpr1_t* t_tree_expr[1];
-  t_tree_expr[0] = ap_texpr1_cst_scalar_double(env, dval);
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-  ap_texpr1_t* t_texpr1;
+  ap_texpr0_t* t_tree_expr[1];
+  t_tree_expr[0] = ap_texpr0_cst_scalar_double(dval);
+
+  ap_texpr0_t* t_texpr1;
 
   // add expression with real expr_type 1
-  if (strcmp(opcode, "-") == 0)
+  if (opcode == clang::UO_Minus)
   {
-    t_texpr1 = ap_texpr1_unop(AP_TEXPR_NEG, t_tree_expr[0],
+    t_texpr1 = ap_texpr0_unop(AP_TEXPR_NEG, t_tree_expr[0],
       AP_RTYPE_SINGLE, AP_RDIR_ZERO);
     addExpression(t_texpr1, 1);
   }
   else
-  if (strcmp(opcode, "+") == 0)
+  if (opcode == clang::UO_Plus)
   {
     addExpression(t_tree_expr[0], 1);
   }
@@ -1058,28 +1963,26 @@ void getFloatingLiteralUnaryOp(double dval, const char* opcode)
 }
 
 /// \brief Get variable of unary op for apron
-void getVariableUnaryOp(const char* varName, const char* varType,
-  const char* opcode)
+void getVariableUnaryOp(VariableCount* var, clang::UnaryOperatorKind opcode)
 {
-  ap_texpr1_t* t_tree_expr[1];
-  t_tree_expr[0] = ap_texpr1_var(env, (char *) varName);
+  ap_texpr0_t* t_tree_expr[1];
+  t_tree_expr[0] = createVariableExpr(var);
 
-  ap_texpr1_t* t_texpr1;
+  ap_texpr0_t* t_texpr1;
   int exprType = 0;
-  const char* apronVarType = getApronDimType(varType);
 
   // add expression with appropriate expr_type
-  if (strcmp(opcode, "-") == 0)
+  if (opcode == clang::UO_Minus)
   {
-    if (strcmp(apronVarType, "real") == 0)
+    if (var->isReal)
     {
-      t_texpr1 = ap_texpr1_unop(AP_TEXPR_NEG, t_tree_expr[0],
+      t_texpr1 = ap_texpr0_unop(AP_TEXPR_NEG, t_tree_expr[0],
         AP_RTYPE_SINGLE, AP_RDIR_ZERO);
       exprType = 1;
     }
-    else if (strcmp(apronVarType, "int") == 0)
+    else
     {
-      t_texpr1 = ap_texpr1_unop(AP_TEXPR_NEG, t_tree_expr[0],
+      t_texpr1 = ap_texpr0_unop(AP_TEXPR_NEG, t_tree_expr[0],
         AP_RTYPE_INT, AP_RDIR_ZERO);
       exprType = 0;
     }
@@ -1087,16 +1990,9 @@ void getVariableUnaryOp(const char* varName, const char* varType,
     addExpression(t_texpr1, exprType);
   }
   else
-  if (strcmp(opcode, "+") == 0)
+  if (opcode == clang::UO_Plus)
   {
-    if (strcmp(apronVarType, "real") == 0)
-    {
-      exprType = 1;
-    }
-    else if (strcmp(apronVarType, "int") == 0)
-    {
-      exprType = 0;
-    }
+    exprType = var->isReal ? 1 : 0;
 
     addExpression(t_tree_expr[0], exprType);
   }
@@ -1104,7 +2000,7 @@ void getVariableUnaryOp(const char* varName, const char* varType,
 }
 
 /// \brief Create single expression for unary op for apron
-void createSingleExpressionForUnaryOp(const char* opcode)
+void createSingleExpressionForUnaryOp(clang::UnaryOperatorKind opcode)
 {
   // unary - : get the expression, negate it and add to MyApronExpr list
   // e.g -(x + 1)
@@ -1114,24 +2010,24 @@ void createSingleExpressionForUnaryOp(const char* opcode)
   MyApronExpr* t_node;
   t_node = removeExpression();
 
-  ap_texpr1_t* t_tree_expr[1];
+  ap_texpr0_t* t_tree_expr[1];
   t_tree_expr[0] = t_node->data;
 
-  ap_texpr1_t* t_texpr1;
+  ap_texpr0_t* t_texpr1;
   int exprType = 0;
 
   // add expression with appropriate expr_type
-  if (strcmp(opcode, "-") == 0)
+  if (opcode == clang::UO_Minus)
   {
     if (t_node->expr_type == 1)
     {
-      t_texpr1 = ap_texpr1_unop(AP_TEXPR_NEG, t_tree_expr[0],
+      t_texpr1 = ap_texpr0_unop(AP_TEXPR_NEG, t_tree_expr[0],
         AP_RTYPE_SINGLE, AP_RDIR_ZERO);
       exprType = 1;
     }
     else
     {
-      t_texpr1 = ap_texpr1_unop(AP_TEXPR_NEG, t_tree_expr[0],
+      t_texpr1 = ap_texpr0_unop(AP_TEXPR_NEG, t_tree_expr[0],
         AP_RTYPE_INT, AP_RDIR_ZERO);
       exprType = 0;
     }
@@ -1140,7 +2036,7 @@ void createSingleExpressionForUnaryOp(const char* opcode)
 
   }
   else
-  if (strcmp(opcode, "+") == 0)
+  if (opcode == clang::UO_Plus)
   {
     if (t_node->expr_type == 1)
     {
@@ -1155,40 +2051,32 @@ void createSingleExpressionForUnaryOp(const char* opcode)
 
   }
 
-  std::cerr << "\n unary expression:\n";
+  getErrStream() << "\n unary expression:\n";
   showExpression();
-  std::cerr << "\n";
+  getErrStream() << "\n";
 
 }
 
 /// \brief For PostIncrement, Increment the Value of a variable and create
 /// appropriate tree expression
-void doPostIncrement(const char* varName, int numAssignment)
+void doPostIncrement(VariableCount* var, int numAssignment)
 {
-  ap_texpr1_t* my_tree_expr[3];
-  int count;
-  long int lival = 1;
-  ap_texpr1_t* texpr1_uo = NULL;
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-  // count for variable in global var list
-  count = getCountForVar(varName);
+  ap_texpr0_t* my_tree_expr[3];
+  ap_texpr0_t* texpr1_uo = NULL;
 
-  my_tree_expr[0] = ap_texpr1_cst_scalar_int(env, (long int)count);
-  my_tree_expr[1] = ap_texpr1_var(env, (ap_var_t)varName);
-  my_tree_expr[2] = ap_texpr1_binop(AP_TEXPR_ADD, my_tree_expr[1],
+  my_tree_expr[0] = ap_texpr0_cst_scalar_int((long int)(var->varCount));
+  my_tree_expr[1] = createVariableExpr(var);
+  my_tree_expr[2] = ap_texpr0_binop(AP_TEXPR_ADD, my_tree_expr[1],
     my_tree_expr[0], AP_RTYPE_INT, AP_RDIR_ZERO);
 
   // push onto stack varName+count
-  texpr1_uo = ap_texpr1_copy(my_tree_expr[2]);
-
-  count = count +1;
+  texpr1_uo = my_tree_expr[2];
 
   // set count for variable
-  if (setCountForVar(varName, count) != -1)
-  {
-    printGlobalVarList();
-  }
-
+  setCountForVar(var, var->varCount + 1);
+  printGlobalVarList();
 
   // checking if the unary operator is a part of the binary assignment
   if (numAssignment > 0)
@@ -1196,32 +2084,31 @@ void doPostIncrement(const char* varName, int numAssignment)
     addExpression(texpr1_uo, 0);
     showExpression();
   }
+  else
+  {
+    ap_texpr0_free(texpr1_uo);
+  }
 }
 
 /// \brief For PreIncrement, Increment the Value of a variable and create
 /// appropriate tree expression
-void doPreIncrement(const char* varName, int numAssignment)
+void doPreIncrement(VariableCount* var, int numAssignment)
 {
-  ap_texpr1_t* my_tree_expr[3];
-  int count;
-  long int lival = 1;
-  ap_texpr1_t* texpr1_uo = NULL;
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-  count = getCountForVar(varName);
+  ap_texpr0_t* my_tree_expr[3];
+  ap_texpr0_t* texpr1_uo = NULL;
 
-  my_tree_expr[0] = ap_texpr1_cst_scalar_int(env, (long int)(count+1));
-  my_tree_expr[1] = ap_texpr1_var(env, (ap_var_t)varName);
-  my_tree_expr[2] = ap_texpr1_binop(AP_TEXPR_ADD, my_tree_expr[1],
+  my_tree_expr[0] = ap_texpr0_cst_scalar_int((long int)(var->varCount + 1));
+  my_tree_expr[1] = createVariableExpr(var);
+  my_tree_expr[2] = ap_texpr0_binop(AP_TEXPR_ADD, my_tree_expr[1],
     my_tree_expr[0], AP_RTYPE_INT, AP_RDIR_ZERO);
 
-  texpr1_uo = ap_texpr1_copy(my_tree_expr[2]);
-
-  count = count +1;
+  texpr1_uo = my_tree_expr[2];
 
-  if (setCountForVar(varName, count) != -1)
-  {
-    printGlobalVarList();
-  }
+  // set count for variable
+  setCountForVar(var, var->varCount + 1);
+  printGlobalVarList();
 
   // checking if the unary operator is a part of the binary assignment
   if (numAssignment > 0)
@@ -1229,31 +2116,30 @@ void doPreIncrement(const char* varName, int numAssignment)
     addExpression(texpr1_uo, 0);
     showExpression();
   }
+  else
+  {
+    ap_texpr0_free(texpr1_uo);
+  }
 }
 
 /// \brief PreDecrement Expression creation and value Update function
-void doPreDecrement(const char* varName, int numAssignment)
+void doPreDecrement(VariableCount* var, int numAssignment)
 {
-  ap_texpr1_t* my_tree_expr[3];
-  int count;
-  long int lival = 1;
-  ap_texpr1_t* texpr1_uo = NULL;
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-  count = getCountForVar(varName);
+  ap_texpr0_t* my_tree_expr[3];
+  ap_texpr0_t* texpr1_uo = NULL;
 
-  my_tree_expr[0] = ap_texpr1_cst_scalar_int(env, (long int)(count-1));
-  my_tree_expr[1] = ap_texpr1_var(env, (ap_var_t)varName);
-  my_tree_expr[2] = ap_texpr1_binop(AP_TEXPR_ADD, my_tree_expr[1],
+  my_tree_expr[0] = ap_texpr0_cst_scalar_int((long int)(var->varCount - 1));
+  my_tree_expr[1] = createVariableExpr(var);
+  my_tree_expr[2] = ap_texpr0_binop(AP_TEXPR_ADD, my_tree_expr[1],
     my_tree_expr[0], AP_RTYPE_INT, AP_RDIR_ZERO);
 
-  texpr1_uo = ap_texpr1_copy(my_tree_expr[2]);
+  texpr1_uo = my_tree_expr[2];
 
-  count = count -1;
-
-  if (setCountForVar(varName, count) != -1)
-  {
-    printGlobalVarList();
-  }
+  // set count for variable
+  setCountForVar(var, var->varCount - 1);
+  printGlobalVarList();
 
   // checking if the unary operator is a part of the binary assignment
   if (numAssignment > 0)
@@ -1261,31 +2147,30 @@ void doPreDecrement(const char* varName, int numAssignment)
     addExpression(texpr1_uo, 0);
     showExpression();
   }
+  else
+  {
+    ap_texpr0_free(texpr1_uo);
+  }
 }
 
 /// \brief PostDecrement Expression creation and value Update function
-void doPostDecrement(const char* varName, int numAssignment)
+void doPostDecrement(VariableCount* var, int numAssignment)
 {
-  ap_texpr1_t* my_tree_expr[3];
-  int count;
-  long int lival = 1;
-  ap_texpr1_t* texpr1_uo = NULL;
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-  count = getCountForVar(varName);
+  ap_texpr0_t* my_tree_expr[3];
+  ap_texpr0_t* texpr1_uo = NULL;
 
-  my_tree_expr[0] = ap_texpr1_cst_scalar_int(env, (long int)(count));
-  my_tree_expr[1] = ap_texpr1_var(env, (ap_var_t)varName);
-  my_tree_expr[2] = ap_texpr1_binop(AP_TEXPR_ADD, my_tree_expr[1],
+  my_tree_expr[0] = ap_texpr0_cst_scalar_int((long int)(var->varCount));
+  my_tree_expr[1] = createVariableExpr(var);
+  my_tree_expr[2] = ap_texpr0_binop(AP_TEXPR_ADD, my_tree_expr[1],
     my_tree_expr[0], AP_RTYPE_INT, AP_RDIR_ZERO);
 
-  texpr1_uo = ap_texpr1_copy(my_tree_expr[2]);
-
-  count = count -1;
+  texpr1_uo = my_tree_expr[2];
 
-  if (setCountForVar(varName, count) != -1)
-  {
-    printGlobalVarList();
-  }
+  // set count for variable
+  setCountForVar(var, var->varCount - 1);
+  printGlobalVarList();
 
   // checking if the unary operator is a part of the binary assignment
   if (numAssignment > 0)
@@ -1293,106 +2178,116 @@ void doPostDecrement(const char* varName, int numAssignment)
     addExpression(texpr1_uo, 0);
     showExpression();
   }
+  else
+  {
+    ap_texpr0_free(texpr1_uo);
+  }
 }
 
-/// \brief Function to add a new temporary variable, assign abstract value
-///  and return name of temporary variable added
-char * addTemporaryVariables(const char* varName, int a)
+/// \brief Take a temporary variable from pool of the function, the pool
+/// grows if every temporary is in use by current statement
+/// @return int - index of temporary variable in the pool
+static int acquireTemporaryIndex()
 {
-  // varName is the variable for which a temporary variable is being created
-  // and new temporary variable name is stored in newVarName as __tmp_<mycount>
-
-  // construct temporary variable name
-  std::stringstream ss;
-  ss  << "__tmp_" << mycount;
-
-  mycount++;
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-  std::string s = ss.str();
-  const char* newVarName = s.c_str();
+  TempVarPool& pool = ctx->tempVarPool;
 
-  char** unary_dummy;
-  unary_dummy = (char**) new char*;
-  unary_dummy[0] = strdup((char*) newVarName);
-
-  // add temporary variable to env
-  initCountForVar(*(unary_dummy));
-  printGlobalVarList();
+  if (pool.numUsed == pool.names.size())
+  {
+    // buildEnvironment() reserves a temporary for every shift operator of
+    // the function, this is only reached if that count was too low; a
+    // temporary in use is never given out twice
+    std::stringstream ss;
+    ss << "__tmp_" << pool.names.size();
+    pool.names.push_back(ss.str());
 
-  env = ap_environment_add(env, (ap_var_t*) unary_dummy, 1, NULL, 0);
+    ap_var_t var = (ap_var_t) pool.names.back().c_str();
+    setEnvironment(ap_environment_add(ctx->env, &var, 1, NULL, 0));
+    updateVariableDims();
 
-  AbsValPtr->abstract_value = ap_abstract1_change_environment(man, true,
-    &(AbsValPtr->abstract_value), env, false);
+    ctx->AbsValPtr->abstract_value = ap_abstract1_change_environment(
+      ctx->man, true, &(ctx->AbsValPtr->abstract_value), ctx->env, false);
+  }
 
-  ap_texpr1_t* t_tree_expr;
-  t_tree_expr = ap_texpr1_var(env, ((char *) varName));
-  ap_texpr1_print(t_tree_expr);
-  std::cout<<"\n";
+  return pool.numUsed++;
+}
 
-  // update abstract value
-  AbsValPtr->abstract_value = ap_abstract1_assign_texpr(man, true,
-    &(AbsValPtr->abstract_value), (char*)s.c_str(), t_tree_expr, NULL);
+/// \brief Take a temporary variable from pool of the function
+const char* acquireTemporaryVariable()
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-  std::cout << "abstract value:\n";
-  ap_abstract1_fprint(stdout, man, &(AbsValPtr->abstract_value));
+  int index = acquireTemporaryIndex();
 
-  // return name of temporary variable added
-  return (char*)newVarName;
+  return ctx->tempVarPool.names[index].c_str();
 }
 
-/// \brief Function to remove temp variables
-void removeTemporaryVariables()
+/// \brief Function to take a temporary variable from pool, assign value of
+/// a variable to it and return name of temporary variable
+char * addTemporaryVariables(const char* varName, int a)
 {
-  std::string str1 ("__tmp_");
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-  // get (initially) number of variables in env
-  int total_var = (env->intdim + env->realdim);
-  int i = 0;
+  // varName is the variable for which a temporary variable is taken
+  int index = acquireTemporaryIndex();
+  const char* newVarName = ctx->tempVarPool.names[index].c_str();
 
-  ap_var_t my_var;
+  ap_dim_t dim = ap_environment_dim_of_var(ctx->env, (ap_var_t) varName);
 
-  char* charptr;
+  ap_texpr0_t* t_tree_expr;
+  t_tree_expr = (dim == AP_DIM_MAX) ? ap_texpr0_cst_interval_top() :
+    ap_texpr0_dim(dim);
+  printTreeExpr(getOutFile(), t_tree_expr);
+  getOutStream()<<"\n";
 
-  while (i < total_var)
-  {
-    // get temporary variable name
-    my_var =  ap_environment_var_of_dim(env, i);
+  // update abstract value
+  assignDimensions(&ctx->tempVarPool.dims[index], &t_tree_expr, 1);
 
-    std::string str2;
-    charptr = (char *)my_var;
+  ap_texpr0_free(t_tree_expr);
 
-    if (memcmp(charptr, str1.data(), 6) == 0)
-    {
-      // remove variable from env and update abstract value
-      env = ap_environment_remove(env, &(my_var), 1);
+  getOutStream() << "abstract value:\n";
+  ap_abstract1_fprint(getOutFile(), ctx->man,
+    &(ctx->AbsValPtr->abstract_value));
 
-      AbsValPtr->abstract_value = ap_abstract1_change_environment(man, true,
-        &(AbsValPtr->abstract_value), env, false);
+  // return name of temporary variable
+  return (char*) newVarName;
+}
 
-      i =-1;
+/// \brief Function to give temporary variables used by a statement back to
+/// pool
+void removeTemporaryVariables()
+{
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-      // reset number of variables in env
-      total_var = (env->intdim + env->realdim);
-    }
+  TempVarPool& pool = ctx->tempVarPool;
 
-    i++;
+  if (pool.numUsed == 0)
+  {
+    // statement used no temporary
+    return;
   }
 
-  // re-initialize mycount - number of temporary variables
-  mycount = 0;
+  // forget all used temporaries at once, they stay in environment
+  forgetDimensions(&pool.dims[0], pool.numUsed);
+
+  pool.numUsed = 0;
 
-  std::cout << "abstract value:\n";
-  ap_abstract1_fprint(stdout, man, &(AbsValPtr->abstract_value));
+  getOutStream() << "abstract value:\n";
+  ap_abstract1_fprint(getOutFile(), ctx->man,
+    &(ctx->AbsValPtr->abstract_value));
 }
 
 /// \brief Create constraint for binary shift operator for apron
-void createSingleExpressionForBinShiftOp(const char* opcode,
+void createSingleExpressionForBinShiftOp(clang::BinaryOperatorKind opcode,
   int numAssignment)
 {
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
   // get both expressions
 
   MyApronExpr * t_node1, * t_node2;
-  ap_texpr1_t * texpr1, * texpr2;
+  ap_texpr0_t * texpr1, * texpr2;
   int exprType1, exprType2;
 
   // first removeExpression() gives rhs (or second operand)
@@ -1404,41 +2299,29 @@ void createSingleExpressionForBinShiftOp(const char* opcode,
   texpr1 = t_node2->data;
   texpr2 = t_node1->data;
 
-  // For unary incr/decr operators
-  int compare = ap_environment_compare(texpr1->env, texpr2->env);
-
-  if (compare == -1)
-  {
-    //env of lhs is a subset of env of rhs
-    texpr1 = ap_texpr1_extend_environment(texpr1, texpr2->env);
-  }
-  else
-  if (compare == 1)
-  {
-    //env of rhs is a subset of env of lhs
-    texpr2 = ap_texpr1_extend_environment(texpr2, texpr1->env);
-  }
+  // both operands are built on the environment of the function, which
+  // does not change during analysis (see buildEnvironment())
 
   // and find resultant expr_type
   exprType1 = t_node1->expr_type;
   exprType2 = t_node2->expr_type;
 
   if (exprType1 == 1 || exprType2 == 1)
-    expr_type = 1;
+    ctx->expr_type = 1;
   else
-    expr_type = 0;
+    ctx->expr_type = 0;
 
   // print opcode, lhs and rhs expr, expr_type
-  std::cout << " opcode : " << opcode;
-  std::cout << " \n";
-  std::cout << " o ap_texpr1_print() : ";
-  ap_texpr1_print(texpr1);
-  std::cout << " \n";
-  std::cout << " o ap_texpr1_print() : ";
-  ap_texpr1_print(texpr2);
-  std::cout << " \n";
-  std::cout << " expr_type : " << expr_type;
-  std::cout << " \n";
+  getOutStream() << " opcode : " << getOpcodeName(opcode);
+  getOutStream() << " \n";
+  getOutStream() << " o ap_texpr0_print() : ";
+  printTreeExpr(getOutFile(), texpr1);
+  getOutStream() << " \n";
+  getOutStream() << " o ap_texpr0_print() : ";
+  printTreeExpr(getOutFile(), texpr2);
+  getOutStream() << " \n";
+  getOutStream() << " expr_type : " << ctx->expr_type;
+  getOutStream() << " \n";
 
   // call to create temporary variable
   addPseudoVariableRel(numAssignment);
@@ -1447,34 +2330,23 @@ void createSingleExpressionForBinShiftOp(const char* opcode,
 /// \brief Creates a pseudo variable and puts this expression onto the stack
 void addPseudoVariableRel(int numAssignment)
 {
-  // construct temporary variable name
-  std::stringstream ss;
-  ss  << "__tmp_" << mycount;
-
-  mycount++;
-
-  std::string s = ss.str();
-  const char* newVarName = s.c_str();
-
-  char** unary_dummy;
-  unary_dummy = (char**) new char*;
-  unary_dummy[0] = strdup((char*) newVarName);
-
-  // add temporary variable to env
-  env = ap_environment_add(env, (ap_var_t*) unary_dummy, 1, NULL, 0);
-
-  AbsValPtr->abstract_value = ap_abstract1_change_environment(man, true,
-    &(AbsValPtr->abstract_value), env, false);
-
-  ap_texpr1_t* t_tree_expr;
-  t_tree_expr = ap_texpr1_var(env, ((char *) newVarName));
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
   // The expression is added onto the stack only when there is
   // a pending assignment to be done
-  if (numAssignment != 0)
+  if (numAssignment == 0)
   {
-    addExpression(t_tree_expr, 1);
+    return;
   }
+
+  // take temporary variable from pool of the function, temporaries are
+  // int dimensions (see buildEnvironment())
+  int index = acquireTemporaryIndex();
+
+  ap_texpr0_t* t_tree_expr;
+  t_tree_expr = ap_texpr0_dim(ctx->tempVarPool.dims[index]);
+
+  addExpression(t_tree_expr, 0);
 }
 
 /// \brief Evaluate return statement for apron - just remove expression
@@ -1486,82 +2358,71 @@ void evaluateReturn()
   //showExpression();
   //std::cout << "\n";
 
-  // as this is last statement of block, add current block abstract value
-  // in AbstractMemory->blockAbsVal to be added into MyCFGInfo->blockAbsVal
-  AbstractMemoryPtr->blockAbsVal = ap_abstract1_copy(man,
-    &(AbsValPtr->abstract_value));
-}
-
-/// \brief Get the count value for a particular variable
-int getCountForVar(const char * varName)
-{
-  int count = -1;
-
-  VariableCount * newVar;
-
-  for (int i = 0; i < globalVarList.size(); i++)
+  if (t_node)
   {
-    newVar = globalVarList[i];
-
-    if (strcmp(varName, newVar->varName) == 0)
-    {
-      return newVar->varCount;
-    }
+    ap_texpr0_free(t_node->data);
   }
 
-  return count;
+  // abstract value of the block is stored in AbstractMemory->blockAbsVal by
+  // processBlock() at end of block
 }
 
 /// \brief Set the count value for a particular variable
-/// Return -1 if variable not found
-int setCountForVar(const char * varName, int varCount)
+int setCountForVar(VariableCount* var, int varCount)
 {
-  int count = -1;
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
 
-  VariableCount * newVar;
+  var->varCount = varCount;
 
-  for (int i = 0; i < globalVarList.size(); i++)
+  if (!var->isPending)
   {
-    newVar = globalVarList[i];
-
-    if (strcmp(varName, newVar->varName) == 0)
-    {
-      newVar->varCount = varCount;
-      return 0;
-    }
+    var->isPending = true;
+    ctx->pendingCountVars.push_back(var);
   }
 
-  return count;
+  return 0;
 }
 
-/// \brief Initialize the count value for a particular variable
-/// Return -1 if variable already present
-int initCountForVar(const char* varName)
+/// \brief Initialize the count value for a new variable symbol
+VariableCount* initCountForVar(const char* varName, const char* varType)
 {
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
   VariableCount * newVar = (VariableCount *) new VariableCount;
 
   newVar->varName = strdup(varName);
+  newVar->varType = strdup(varType);
+  newVar->dim = AP_DIM_MAX;
+  newVar->isReal = (strcmp(getApronDimType(varType), "real") == 0);
   newVar->varCount = 0;
-  globalVarList.push_back(newVar);
+  newVar->isPending = false;
+  ctx->globalVarList.push_back(newVar);
 
-  return 0;
+  if (ctx->env)
+  {
+    newVar->dim = ap_environment_dim_of_var(ctx->env, (ap_var_t) varName);
+  }
+
+  return newVar;
 }
 
 /// \brief Prints the Global Var List
 int printGlobalVarList()
 {
-  std::cout << "\nPrinting globalVarList : \n";
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  getOutStream() << "\nPrinting globalVarList : \n";
 
   VariableCount * newVar;
 
-  for (int i = 0; i < globalVarList.size(); i++)
+  for (int i = 0; i < ctx->globalVarList.size(); i++)
   {
-    newVar = globalVarList[i];
-    std::cout << "Varname = " << newVar->varName;
-    std::cout << "\t\t Count = " << newVar->varCount << "\n";
+    newVar = ctx->globalVarList[i];
+    getOutStream() << "Varname = " << newVar->varName;
+    getOutStream() << "\t\t Count = " << newVar->varCount << "\n";
   }
 
-  std::cout << "\n\n";
+  getOutStream() << "\n\n";
   return 0;
 }
 
@@ -1569,39 +2430,64 @@ int printGlobalVarList()
 ///  according to the Global VarList
 int updateAbsValFromGlobalVarList()
 {
+  AnalysisContext* ctx = AnalysisContext::getCurrent();
+
+  if (ctx->pendingCountVars.empty())
+  {
+    // statement did not increment or decrement any variable
+    return 0;
+  }
+
   VariableCount * newVar;
-  ap_texpr1_t* my_tree_expr[3];
+  std::vector<ap_dim_t> dims;
+  std::vector<ap_texpr0_t *> exprs;
+  ap_texpr0_t* my_tree_expr[3];
   int count;
-  char * varName;
 
   //std::cout << "\nUpdating Abstract Values : \n";
 
-  for (int i = 0; i < globalVarList.size(); i++)
+  for (int i = 0; i < ctx->pendingCountVars.size(); i++)
   {
-    newVar = globalVarList[i];
-    varName = strdup(newVar->varName);
+    newVar = ctx->pendingCountVars[i];
     count = newVar->varCount;
 
-    if (count != 0)
+    // count may be back to 0 (e.g. reset by assignment to variable), a
+    // variable not in environment is not tracked
+    if (count != 0 && newVar->dim != AP_DIM_MAX)
     {
-      std::cout << "Updating Variable = " << newVar->varName;
-      std::cout << "\t\t with Count = " << newVar->varCount << "\n";
+      getOutStream() << "Updating Variable = " << newVar->varName;
+      getOutStream() << "\t\t with Count = " << newVar->varCount << "\n";
 
-      my_tree_expr[0] = ap_texpr1_cst_scalar_int(env, (long int)(count));
-      my_tree_expr[1] = ap_texpr1_var(env, (ap_var_t)varName);
-      my_tree_expr[2] = ap_texpr1_binop(AP_TEXPR_ADD, my_tree_expr[1],
+      my_tree_expr[0] = ap_texpr0_cst_scalar_int((long int)(count));
+      my_tree_expr[1] = createVariableExpr(newVar);
+      my_tree_expr[2] = ap_texpr0_binop(AP_TEXPR_ADD, my_tree_expr[1],
         my_tree_expr[0], AP_RTYPE_INT, AP_RDIR_ZERO);
 
-      AbsValPtr->abstract_value = ap_abstract1_assign_texpr(man, true,
-        &(AbsValPtr->abstract_value), (char*) varName, my_tree_expr[2], NULL);
-      std::cout << "abstract value:\n";
-      ap_abstract1_fprint(stdout, man, &(AbsValPtr->abstract_value));
+      dims.push_back(newVar->dim);
+      exprs.push_back(my_tree_expr[2]);
+    }
+
+    newVar->varCount = 0;
+    newVar->isPending = false;
+  }
+
+  ctx->pendingCountVars.clear();
 
-      newVar->varCount = 0;
+  if (!dims.empty())
+  {
+    // x := x + count_x for all variables at once, every expression only
+    // reads the variable it is assigned to
+    assignDimensions(&dims[0], &exprs[0], dims.size());
+    getOutStream() << "abstract value:\n";
+    ap_abstract1_fprint(getOutFile(), ctx->man,
+      &(ctx->AbsValPtr->abstract_value));
+
+    for (int i = 0; i < exprs.size(); i++)
+    {
+      ap_texpr0_free(exprs[i]);
     }
   }
 
-  std::cout << "\n\n";
+  getOutStream() << "\n\n";
   return 0;
 }
-
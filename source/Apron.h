@@ -5,7 +5,10 @@
 /// \file
 /// \brief Defines Apron related declarations and definitions
 ///
+#include <deque>
 #include <iostream>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #ifndef APRON_H
@@ -17,11 +20,17 @@
 #include <oct.h>
 #include <pk.h>
 
-/// \brief Apron manager
-extern ap_manager_t* man;
+#include "clang/AST/OperationKinds.h"
 
-/// \brief Apron environment
-extern ap_environment_t* env;
+#include "AnalysisOptions.h"
+#include "ApronWrappers.h"
+#include "StatementArena.h"
+#include "TransferProgram.h"
+
+namespace clang
+{
+  class ValueDecl;
+}
 
 /// \brief Structure to store abstract value
 typedef struct AbsVal
@@ -30,90 +39,138 @@ typedef struct AbsVal
   ap_abstract1_t abstract_value;
 } AbsVal;
 
-/// \brief Pointer to structre to hold abstract value
-extern AbsVal* AbsValPtr;
-
-/// \brief Structure to store Abstract Memory
+/// \brief Structure to store Abstract Memory of the block being processed,
+/// values are moved into MyCFGInfo when the block is done
 typedef struct AbstractMemory
 {
   /// \brief Abstract value of a CFGBlock
-  ap_abstract1_t blockAbsVal;
+  AbstractValue blockAbsVal;
 
-  /// \brief Abstract value of positive of condition
-  ap_abstract1_t condAbsVal;
+  /// \brief Abstract value of block met with condition
+  AbstractValue condAbsVal;
 
-  /// \brief Abstract value of negative of condition
-  ap_abstract1_t negCondAbsVal;
+  /// \brief Abstract value of block met with negation of condition
+  AbstractValue negCondAbsVal;
 } AbstractMemory;
 
-/// \brief Pointer to structure to store Abstract Memory
-extern AbstractMemory* AbstractMemoryPtr;
-
-/// \brief Apron type (int/real) of current expression
-extern int expr_type;
-
-/// \brief Structure to store apron type expressions (ap_texpr1_t*)
+/// \brief Structure to store apron type expressions (level-0 ap_texpr0_t*
+/// on dimensions of environment of the function)
 /// in the current clang statement (Stmt*) and expr_type can be
 /// 1 - DOUBLE or 0 - INT
 typedef struct MyApronExpr
 {
   /// \brief Apron type tree expression for an expression
-  ap_texpr1_t* data;
+  ap_texpr0_t* data;
 
   /// \brief expression type 0-int, 1-real
   int expr_type;
-
-  // \brief Pointer to next MyApronExpr
-  struct MyApronExpr* next;
 } MyApronExpr;
 
-/// \brief MyApronExpr list
-extern MyApronExpr* head;
+/// \brief Stack of MyApronExpr of current statement, storage is taken from
+/// the statement arena
+typedef std::vector<MyApronExpr, ArenaAllocator<MyApronExpr> >
+  MyApronExprStack;
 
-/// \brief Structure to store abstract values - condAbsVal, negCondAbsVal
-/// for conditional expressions
-typedef struct CondExprAbsVal
+/// \brief Structure to store tree constraints of a conditional expression
+/// and of its negation, arrays are owned by the stack until removed from it.
+/// An empty array is condition true, an array holding an unsatisfiable
+/// constraint is condition false.
+typedef struct CondExprCons
 {
-  /// \brief Abstract value of positive of condition
-  ap_abstract1_t condAbsVal;
+  /// \brief Tree constraints of positive of condition
+  ap_tcons0_array_t condCons;
+
+  /// \brief Tree constraints of negative of condition
+  ap_tcons0_array_t negCondCons;
 
-  /// \brief Abstract value of negative of condition
-  ap_abstract1_t negCondAbsVal;
+  /// \brief Linear forms of condCons and negCondCons are made (see
+  /// linearizeCondExprCons())
+  bool isLinear;
 
-  /// \brief Pointer to next CondExprAbsVal
-  struct CondExprAbsVal* next;
-} CondExprAbsVal;
+  /// \brief Linear constraints of positive of condition, valid if isLinear
+  ap_lincons0_array_t linCondCons;
 
-/// \brief Pointer to CondExprAbsVal list
-extern CondExprAbsVal* absval_head;
+  /// \brief Linear constraints of negative of condition, valid if isLinear
+  ap_lincons0_array_t linNegCondCons;
+} CondExprCons;
+
+/// \brief Stack of CondExprCons of current statement, storage is taken
+/// from the statement arena
+typedef std::vector<CondExprCons, ArenaAllocator<CondExprCons> >
+  CondExprConsStack;
 
 /// \brief Structure to hold the current count of a particular variable
 /// to ensure the correct expression goes onto the stack in the case of
-/// increment/decrement operators
+/// increment/decrement operators, it is also the symbol of the variable
+/// (one per Apron variable, see VariableSymbolTable)
 typedef struct VariableCount
 {
-  /// brief varName
+  /// brief varName (interned, Apron variable of the symbol)
   const char * varName;
 
-  /// \brief count of ??
+  /// \brief C type of variable (e.g. unsigned int)
+  const char * varType;
+
+  /// \brief Apron dimension of variable, AP_DIM_MAX if variable is not in
+  /// environment (e.g. global variable)
+  ap_dim_t dim;
+
+  /// \brief Flag if variable is a real dimension
+  bool isReal;
+
+  /// \brief Net number of increments (negative for decrements) of the
+  /// variable in current statement, applied to its abstract value once the
+  /// statement is processed (see updateAbsValFromGlobalVarList())
   int varCount;
+
+  /// \brief Flag if variable is in list of pending counts of the context
+  bool isPending;
 } VariableCount;
 
 /// \brief Vector containg pointers to VariableCount Structure
 typedef std::vector <VariableCount * > VariableCountList;
 
-extern VariableCountList globalVarList;
+/// \brief Symbols of variable declarations of a function, declarations
+/// with the same name share one symbol
+typedef std::unordered_map<const clang::ValueDecl *, VariableCount *>
+  VariableSymbolTable;
+
+/// \brief Symbols of a function by variable name
+typedef std::unordered_map<std::string, VariableCount *> VariableNameTable;
+
+/// \brief Pool of temporary variables __tmp_0 .. __tmp_<n - 1> reserved in
+/// environment of a function, a statement takes temporaries from the pool
+/// and removeTemporaryVariables() gives them back
+typedef struct TempVarPool
+{
+  /// \brief Names of temporaries (deque keeps names at the same address)
+  std::deque<std::string> names;
+
+  /// \brief Apron dimension of every temporary (see updateVariableDims())
+  std::vector<ap_dim_t> dims;
+
+  /// \brief Number of temporaries taken since pool was last cleared
+  int numUsed;
+} TempVarPool;
+
+/// \brief Clear MyApronExpr and CondExprCons stacks (constraints left on
+/// CondExprCons stack are cleared) and give back all memory of the
+/// statement arena, called after every statement
+/// @param none
+/// @return void (nothing)
+void resetStatementArena();
 
 /// \brief Add apron type expression to MyApronExpr list
 /// @param expression - Apron type expression
 /// @param expr_type - type of expression int(0) or real(1)
 /// @return void (nothing)
-void addExpression(ap_texpr1_t* expression,
+void addExpression(ap_texpr0_t* expression,
   int expr_type);
 
 /// \brief Remove apron type expression from MyApronExpr list
 /// @param none
-/// @return MyApronExpr* - Apron type expression with expression type
+/// @return MyApronExpr* - Apron type expression with expression type,
+///         valid until resetStatementArena(), NULL if list is empty
 MyApronExpr* removeExpression();
 
 /// \brief Show apron type expressions of MyApronExpr list
@@ -121,81 +178,228 @@ MyApronExpr* removeExpression();
 /// @return void (nothing)
 void showExpression();
 
-/// \brief Add condAbsVal and negCondAbsVal to CondExprAbsVal list
-/// @param absVal - Abstract value of positive of condition
-/// @param negAbsVal - Abstract value of negative of condition
+/// \brief Add constraints of condition and of its negation to CondExprCons
+/// list
+/// @param condCons - Tree constraints of positive of condition
+/// @param negCondCons - Tree constraints of negative of condition
 /// @return void (nothing)
-void addCondExprAbsVal(ap_abstract1_t absVal,
-  ap_abstract1_t negAbsVal);
+void addCondExprCons(ap_tcons0_array_t condCons,
+  ap_tcons0_array_t negCondCons);
 
-/// \brief Remove condAbsVal and negCondAbsVal from CondExprAbsVal list
+/// \brief Remove constraints of condition and of its negation from
+/// CondExprCons list
 /// @param none
-/// @return CondExprAbsVal* - Abstract value of positive and
-///         negative of condition
-CondExprAbsVal* removeCondExprAbsVal();
+/// @return CondExprCons* - Tree constraints of positive and negative of
+///         condition, valid until resetStatementArena(), NULL if list is
+///         empty; caller owns the constraint arrays
+CondExprCons* removeCondExprCons();
+
+/// \brief Show constraints of condition and of its negation from
+/// CondExprCons list
+/// @param none
+/// @return void (nothing)
+void showCondExprCons();
+
+/// \brief Make constraints of a condition known to be true / false
+/// @param positive - condition is non-zero scalar (1), zero (0) or
+///        unknown (2)
+/// @return CondExprCons - Tree constraints of positive and negative of
+///         condition, caller owns the constraint arrays
+CondExprCons makeCondExprCons(int positive);
+
+/// \brief Clear constraint arrays of a CondExprCons
+/// @param cons - constraints of condition
+/// @return void (nothing)
+void clearCondExprCons(CondExprCons* cons);
+
+/// \brief Make linear constraints of a CondExprCons kept for later visits
+/// of a block, if all its constraints are linear
+/// @param cons - constraints of condition
+/// @return bool - true if linear constraints are made (cons->isLinear)
+bool linearizeCondExprCons(CondExprCons* cons);
+
+/// \brief Get apron manager for an abstract domain, manager is allocated on
+/// first use and reused afterwards by the calling (analysis) thread, which
+/// frees it with freeApronManagers() before it exits
+/// @param domain - abstract domain (box / octagon / polyhedra)
+/// @return ap_manager_t* - apron manager
+ap_manager_t* getApronManager(AbstractDomain domain);
+
+/// \brief Print abstract domain and name and version of Apron library
+/// providing it, printed once per analyzed file by the driver
+/// @param domain - abstract domain (box / octagon / polyhedra)
+/// @param os - output stream
+/// @return void (nothing)
+void printApronDomain(AbstractDomain domain, std::ostream& os);
 
-/// \brief Show condAbsVal and negCondAbsVal from CondExprAbsVal list
+/// \brief Free apron managers of the calling thread, called by analysis
+/// threads before they exit
 /// @param none
 /// @return void (nothing)
-void showCondExprAbsVal();
+void freeApronManagers();
 
-/// \brief get abstract domain choice and set empty environment
+/// \brief Set apron manager for the abstract domain and set empty environment
+/// @param domain - abstract domain (box / octagon / polyhedra)
+/// @return void (nothing)
+void initApron(AbstractDomain domain);
+
+/// \brief Replace current abstract value (AbsVal), old one is cleared
+/// @param absVal - new abstract value, moved into AbsVal
+/// @return void (nothing)
+void replaceAbsVal(AbstractValue absVal);
+
+/// \brief Move current abstract value out of AbsVal, AbsVal is empty until
+/// next replaceAbsVal()
 /// @param none
+/// @return AbstractValue - current abstract value
+AbstractValue takeAbsVal();
+
+/// \brief Build environment of a function once with all its variables and
+/// temporaries __tmp_0 .. __tmp_<numTemporaries - 1>, abstract values are
+/// set to top in the new environment
+/// @param intVarNames - names of int variables (parameters and locals)
+/// @param realVarNames - names of real variables (parameters and locals)
+/// @param numTemporaries - number of temporary variables to reserve
 /// @return void (nothing)
-void initApron();
+void buildEnvironment(const std::vector<std::string>& intVarNames,
+  const std::vector<std::string>& realVarNames,
+  int numTemporaries);
 
 /// \brief Get variable name and type for apron library and add to environment
+/// if it is not in environment already (see buildEnvironment())
 /// @param varName - variable name
 /// @param varType - variable type
 /// @return void (nothing)
 void getVarNameAndType(const char* varName,
   const char* varType);
 
+/// \brief Get symbol of a variable declaration
+/// @param valueDecl - variable declaration
+/// @return VariableCount* - symbol, NULL if declaration has no symbol yet
+VariableCount* lookupVariable(const clang::ValueDecl* valueDecl);
+
+/// \brief Add symbol of a variable declaration, a declaration with the name
+/// of an existing symbol gets that symbol
+/// @param valueDecl - variable declaration
+/// @param varName - variable name
+/// @param varType - variable type
+/// @return VariableCount* - symbol of declaration
+VariableCount* addVariable(const clang::ValueDecl* valueDecl,
+  const char* varName,
+  const char* varType);
+
+/// \brief Set Apron dimension of every symbol, called whenever environment
+/// changes
+/// @param none
+/// @return void (nothing)
+void updateVariableDims();
+
+/// \brief Create tree expression of a variable from its dimension, a
+/// variable not in environment (or NULL) can have any value (top)
+/// @param var - variable symbol
+/// @return ap_texpr0_t* - tree expression
+ap_texpr0_t* createVariableExpr(const VariableCount* var);
+
+/// \brief Get names of dimensions of environment of the function, for
+/// printing level-0 expressions and constraints
+/// @param none
+/// @return char** - name of every dimension, owned by the environment
+char** getDimNames();
+
+/// \brief Print level-0 tree expression with names of variables
+/// @param stream - output file
+/// @param expr - tree expression
+/// @return void (nothing)
+void printTreeExpr(FILE* stream, ap_texpr0_t* expr);
+
+/// \brief Meet abstract value with constraints through level-0 API (no
+/// environment checks when value is on environment of the function)
+/// @param absVal - abstract value (not changed)
+/// @param cons - constraints on dimensions of environment of the function
+/// @return ap_abstract1_t - new abstract value, caller has to clear it
+ap_abstract1_t meetConsArray(ap_abstract1_t* absVal,
+  ap_tcons0_array_t* cons);
+
+/// \brief Meet abstract value with linear constraints through level-0 API
+/// @param absVal - abstract value (not changed)
+/// @param cons - constraints on dimensions of environment of the function
+/// @return ap_abstract1_t - new abstract value, caller has to clear it
+ap_abstract1_t meetLinConsArray(ap_abstract1_t* absVal,
+  ap_lincons0_array_t* cons);
+
+/// \brief Meet abstract value with constraints of a condition, linear
+/// constraints are used if they are made
+/// @param absVal - abstract value (not changed)
+/// @param cons - constraints of condition
+/// @param negative - meet with negation of condition
+/// @return ap_abstract1_t - new abstract value, caller has to clear it
+ap_abstract1_t meetCondExprCons(ap_abstract1_t* absVal, CondExprCons* cons,
+  bool negative);
+
+/// \brief Record level-0 operations applied to current abstract value
+/// (assignments and forgets) into a program until stopTransferRecording()
+/// @param program - program to record into, owned by the caller
+/// @return void (nothing)
+void startTransferRecording(TransferProgram* program);
+
+/// \brief Stop recording of operations, the recorded assignments and
+/// forgets are fused into one parallel assignment and one forget
+/// @param none
+/// @return TransferProgram* - recorded program, NULL if it cannot be run
+///         again (environment changed while recording, program is deleted)
+TransferProgram* stopTransferRecording();
+
+/// \brief Run a recorded program on current abstract value
+/// @param program - transfer program of a block
+/// @return void (nothing)
+void runTransferProgram(const TransferProgram* program);
+
 /// \brief Get Apron dimension type (int or real) from const char* type
 /// @param varType - variable type
-/// @return const char* - Apron dimension type - int / real
+/// @return const char* - Apron dimension type - int / real, empty string
+///         for other types
 const char* getApronDimType(const char* varType);
 
 /// \brief Set value for integer literal for apron
-/// @param varName - variable name
+/// @param var - variable symbol
 /// @param dval - integer literal value
 /// @param numAssignment - reference count for number of assignments
 /// @return void (nothing)
-void setValueForIntegerLiteral(const char* varName,
+void setValueForIntegerLiteral(VariableCount* var,
   double dval,
   int numAssignment);
 
 /// \brief Set value for floating literal for apron
-/// @param varName - variable name
+/// @param var - variable symbol
 /// @param dval - floating literal value
 /// @param numAssignment - reference count for number of assignments
 /// @return void (nothing)
-void setValueForFloatingLiteral(const char* varName,
+void setValueForFloatingLiteral(VariableCount* var,
   double dval,
   int numAssignment);
 
 /// \brief Set value for variable on RHS for apron
-/// @param varName - variable name
-/// @param rhsVarName - variable name on rhs
-/// @param varType - variable type
+/// @param var - variable symbol
+/// @param rhsVar - symbol of variable on rhs
 /// @param numAssignment - reference count for number of assignments
 /// @return void (nothing)
-void setValueForRHSVariable(const char* varName,
-  const char* rhsVarName,
-  const char* varType,
+void setValueForRHSVariable(VariableCount* var,
+  VariableCount* rhsVar,
   int numAssignment);
 
 /// \brief Evaluate assignment for apron
-/// @param lhsVarName - variable name on lhs
+/// @param lhsVar - symbol of variable on lhs
 /// @param numAssignment - reference count for number of assignments
 /// @param isLastStatement - is current statement last statement of the block
 /// @return void (nothing)
-void evaluateAssignment(const char* lhsVarName,
+void evaluateAssignment(VariableCount* lhsVar,
   int numAssignment,
   bool isLastStatement);
 
 /// \brief Reset count for a variable on LHS
-void resetCountForVarOnLHS(const char* lhsVarName);
+/// @param lhsVar - symbol of variable on lhs
+/// @return void (nothing)
+void resetCountForVarOnLHS(VariableCount* lhsVar);
 
 /// \brief Get integer literal for apron
 /// @param dval - integer literal value
@@ -208,28 +412,27 @@ void getIntegerLiteral(double dval);
 void getFloatingLiteral(double dval);
 
 /// \brief Get variable for apron
-/// @param varName - variable name
-/// @param varType - variable type
+/// @param var - variable symbol
 /// @return void (nothing)
-void getVariable(const char* varName,
-  const char* varType);
+void getVariable(VariableCount* var);
 
 /// \brief Create single expression for binop for apron
 /// @param opcode - binary arithmetic opcode
 /// @return void (nothing)
-void createSingleExpressionForBinOp(const char* opcode);
+void createSingleExpressionForBinOp(clang::BinaryOperatorKind opcode);
 
 /// \brief Create constraint for binary relational operator for apron
 /// @param opcode - binary relational opcode
 /// @return void (nothing)
-void createConstraintForBinRelOp(const char* opcode);
+void createConstraintForBinRelOp(clang::BinaryOperatorKind opcode);
 
-/// \brief Set abstract values for while(1) and while(0) cases
-/// @param positive - condition is non-zero scalar (1) or zero (0)
+/// \brief Set condition constraints for while(1) and while(0) cases
+/// @param positive - condition is non-zero scalar (1), zero (0) or
+///        unknown (2)
 /// @return void (nothing)
 void setAbstractMemory(int positive);
 
-/// \brief Update abstract values for logical not
+/// \brief Update condition constraints for logical not
 /// @param none
 /// @return void (nothing)
 void updateAbstractValuesForLNot();
@@ -239,66 +442,71 @@ void updateAbstractValuesForLNot();
 /// @param opcode - unary opcode
 /// @return void (nothing)
 void getIntegerLiteralUnaryOp(double dval,
-  const char* opcode);
+  clang::UnaryOperatorKind opcode);
 
 /// \brief Get floating literal (unary op) for apron
 /// @param dval - floating literal value
 /// @param opcode - unary opcode
 /// @return void (nothing)
 void getFloatingLiteralUnaryOp(double dval,
-  const char* opcode);
+  clang::UnaryOperatorKind opcode);
 
 /// \brief Get variable of unary op for apron
-/// @param varName - variable name
-/// @param varType - variable type
+/// @param var - variable symbol
 /// @param opcode - unary opcode
 /// @return void (nothing)
-void getVariableUnaryOp(const char* varName,
-  const char* varType,
-  const char* opcode);
+void getVariableUnaryOp(VariableCount* var,
+  clang::UnaryOperatorKind opcode);
 
 /// \brief Create single expression for unary op for apron
 /// @param opcode - unary opcode
 /// @return void (nothing)
-void createSingleExpressionForUnaryOp(const char* opcode);
+void createSingleExpressionForUnaryOp(clang::UnaryOperatorKind opcode);
 
 /// \brief PostIncrement Expression creation and value Update function
-/// @param varName - variable name
+/// @param var - variable symbol
 /// @param numAssignment - reference count for number of assignments
 /// @return void (nothing)
-void doPostIncrement(const char* varName,
+void doPostIncrement(VariableCount* var,
   int numAssignment);
 
 /// \brief PreIncrement Expression creation and value Update function
-/// @param varName - variable name
+/// @param var - variable symbol
 /// @param numAssignment - reference count for number of assignments
 /// @return void (nothing)
-void doPreIncrement(const char* varName,
+void doPreIncrement(VariableCount* var,
   int numAssignment);
 
 /// \brief PostDecrement Expression creation and value Update function
-/// @param varName - variable name
+/// @param var - variable symbol
 /// @param numAssignment - reference count for number of assignments
 /// @return void (nothing)
-void doPostDecrement(const char* varName,
+void doPostDecrement(VariableCount* var,
   int numAssignment);
 
 /// \brief PreDecrement Expression creation and value Update function
-/// @param varName - variable name
+/// @param var - variable symbol
 /// @param numAssignment - reference count for number of assignments
 /// @return void (nothing)
-void doPreDecrement(const char* varName,
+void doPreDecrement(VariableCount* var,
   int numAssignment);
 
-/// \brief Function to add a new temporary variable, assign abstract value
-///  and return name of temporary variable added
+/// \brief Take a temporary variable from pool of the function, it has no
+/// constraints (see TempVarPool)
+/// @param none
+/// @return const char* - name of temporary variable, owned by the pool
+const char* acquireTemporaryVariable();
+
+/// \brief Function to take a temporary variable from pool, assign value of
+/// a variable to it and return name of temporary variable
 /// @param varName - variable name
-/// @param a - 
-/// @return char* - 
+/// @param a - unused
+/// @return char* - name of temporary variable, owned by the pool
 char* addTemporaryVariables(const char* varName,
   int a);
 
-/// \brief Function to remove temp variables
+/// \brief Function to give temporary variables used by a statement back to
+/// pool, their values are forgotten with one call, environment stays same
 /// @param none
 /// @return void (nothing)
 void removeTemporaryVariables();
@@ -307,11 +515,12 @@ void removeTemporaryVariables();
 /// @param opcode - binary shift opcode
 /// @param numAssignment - reference count for number of assignments
 /// @return void (nothing)
-void createSingleExpressionForBinShiftOp(const char* opcode,
+void createSingleExpressionForBinShiftOp(clang::BinaryOperatorKind opcode,
   int numAssignment);
 
 /// \brief Creates a pseudo variable and puts this expression onto the stack
-/// depending on the value of numAssignment
+/// depending on the value of numAssignment, pseudo variable is taken from
+/// pool of temporaries
 /// @param numAssignment - reference count for number of assignments
 /// @return void (nothing)
 void addPseudoVariableRel(int numAssignment);
@@ -321,24 +530,20 @@ void addPseudoVariableRel(int numAssignment);
 /// @return void (nothing)
 void evaluateReturn();
 
-/// \brief Get the count value for a particular variable
-/// @param varName - variable name
-/// @return int - 
-int getCountForVar(const char * varName);
-
-/// \brief Set the count value for a particular variable
-/// Return -1 if variable not found
-/// @param varName - variable name
+/// \brief Set the count value for a particular variable, variable is added
+/// to list of pending counts (applied by updateAbsValFromGlobalVarList())
+/// @param var - variable symbol
 /// @param varCount - 
 /// @return int - 
-int setCountForVar(const char * varName,
+int setCountForVar(VariableCount* var,
   int varCount);
 
-/// \brief Initialize the count value for a particular variable
-/// Return -1 if variable already present
+/// \brief Initialize the count value for a new variable symbol
 /// @param varName - variable name
-/// @return int - 
-int initCountForVar(const char * varName);
+/// @param varType - variable type
+/// @return VariableCount* - new symbol
+VariableCount* initCountForVar(const char * varName,
+  const char * varType);
 
 /// \brief Prints the Global Var List
 /// @param none
@@ -346,7 +551,8 @@ int initCountForVar(const char * varName);
 int printGlobalVarList();
 
 /// \brief Updates all Variables in the environment
-///  according to the Global VarList
+///  according to the Global VarList, pending counts are applied with one
+///  parallel assignment, nothing is done if there is no pending count
 /// @param none
 /// @return int - 
 int updateAbsValFromGlobalVarList();
@@ -0,0 +1,296 @@
+//
+// ApronWrappers.cpp
+//
+
+/// \file
+/// \brief Defines move-only owners of Apron values - AbstractValue,
+/// TreeExpr, TreeCons and Environment
+///
+#include "ApronWrappers.h"
+
+/// \brief Create empty abstract value
+AbstractValue::AbstractValue()
+{
+  m_man = NULL;
+  m_value.abstract0 = NULL;
+  m_value.env = NULL;
+}
+
+/// \brief Take ownership of an abstract value
+AbstractValue::AbstractValue(ap_manager_t* man, ap_abstract1_t value)
+{
+  m_man = man;
+  m_value = value;
+}
+
+/// \brief Take abstract value of other, other is left empty
+AbstractValue::AbstractValue(AbstractValue&& other)
+{
+  m_man = other.m_man;
+  m_value = other.release();
+}
+
+/// \brief Clear held abstract value and take the one of other
+AbstractValue& AbstractValue::operator=(AbstractValue&& other)
+{
+  if (this != &other)
+  {
+    ap_manager_t* man = other.m_man;
+    reset(man, other.release());
+  }
+
+  return *this;
+}
+
+/// \brief Clear held abstract value
+AbstractValue::~AbstractValue()
+{
+  clear();
+}
+
+/// \brief Make owned copy of an abstract value
+AbstractValue AbstractValue::copyOf(ap_manager_t* man,
+  const ap_abstract1_t* value)
+{
+  return AbstractValue(man,
+    ap_abstract1_copy(man, (ap_abstract1_t *) value));
+}
+
+/// \brief Clear held abstract value and take ownership of another one
+void AbstractValue::reset(ap_manager_t* man, ap_abstract1_t value)
+{
+  clear();
+
+  m_man = man;
+  m_value = value;
+}
+
+/// \brief Store result of a destructive Apron operation on held abstract
+/// value
+void AbstractValue::update(ap_abstract1_t value)
+{
+  m_value = value;
+}
+
+/// \brief Clear held abstract value, it becomes empty
+void AbstractValue::clear()
+{
+  if (m_value.abstract0 != NULL)
+  {
+    ap_abstract1_clear(m_man, &m_value);
+  }
+
+  m_value.abstract0 = NULL;
+  m_value.env = NULL;
+}
+
+/// \brief Give up ownership of held abstract value, it becomes empty
+ap_abstract1_t AbstractValue::release()
+{
+  ap_abstract1_t value = m_value;
+
+  m_value.abstract0 = NULL;
+  m_value.env = NULL;
+
+  return value;
+}
+
+/// \brief Get held abstract value (still owned)
+ap_abstract1_t* AbstractValue::get()
+{
+  return &m_value;
+}
+
+/// \brief Get held abstract value (still owned)
+const ap_abstract1_t* AbstractValue::get() const
+{
+  return &m_value;
+}
+
+/// \brief Check if no abstract value is held
+bool AbstractValue::isEmpty() const
+{
+  return (m_value.abstract0 == NULL);
+}
+
+/// \brief Take ownership of a tree expression
+TreeExpr::TreeExpr(ap_texpr0_t* expr)
+{
+  m_expr = expr;
+}
+
+/// \brief Take tree expression of other, other is left empty
+TreeExpr::TreeExpr(TreeExpr&& other)
+{
+  m_expr = other.release();
+}
+
+/// \brief Free held tree expression and take the one of other
+TreeExpr& TreeExpr::operator=(TreeExpr&& other)
+{
+  if (this != &other)
+  {
+    reset(other.release());
+  }
+
+  return *this;
+}
+
+/// \brief Free held tree expression
+TreeExpr::~TreeExpr()
+{
+  reset();
+}
+
+/// \brief Free held tree expression and take ownership of another one
+void TreeExpr::reset(ap_texpr0_t* expr)
+{
+  if (m_expr != NULL && m_expr != expr)
+  {
+    ap_texpr0_free(m_expr);
+  }
+
+  m_expr = expr;
+}
+
+/// \brief Give up ownership of held tree expression
+ap_texpr0_t* TreeExpr::release()
+{
+  ap_texpr0_t* expr = m_expr;
+  m_expr = NULL;
+
+  return expr;
+}
+
+/// \brief Get held tree expression (still owned)
+ap_texpr0_t* TreeExpr::get() const
+{
+  return m_expr;
+}
+
+/// \brief Create empty tree constraint
+TreeCons::TreeCons()
+{
+  m_cons.texpr0 = NULL;
+  m_cons.scalar = NULL;
+}
+
+/// \brief Take ownership of a tree constraint
+TreeCons::TreeCons(ap_tcons0_t cons)
+{
+  m_cons = cons;
+}
+
+/// \brief Take tree constraint of other, other is left empty
+TreeCons::TreeCons(TreeCons&& other)
+{
+  m_cons = other.release();
+}
+
+/// \brief Clear held tree constraint and take the one of other
+TreeCons& TreeCons::operator=(TreeCons&& other)
+{
+  if (this != &other)
+  {
+    reset(other.release());
+  }
+
+  return *this;
+}
+
+/// \brief Clear held tree constraint
+TreeCons::~TreeCons()
+{
+  if (!isEmpty())
+  {
+    ap_tcons0_clear(&m_cons);
+  }
+}
+
+/// \brief Clear held tree constraint and take ownership of another one
+void TreeCons::reset(ap_tcons0_t cons)
+{
+  if (!isEmpty())
+  {
+    ap_tcons0_clear(&m_cons);
+  }
+
+  m_cons = cons;
+}
+
+/// \brief Give up ownership of held tree constraint
+ap_tcons0_t TreeCons::release()
+{
+  ap_tcons0_t cons = m_cons;
+
+  m_cons.texpr0 = NULL;
+  m_cons.scalar = NULL;
+
+  return cons;
+}
+
+/// \brief Get held tree constraint (still owned)
+ap_tcons0_t* TreeCons::get()
+{
+  return &m_cons;
+}
+
+/// \brief Check if no tree constraint is held
+bool TreeCons::isEmpty() const
+{
+  return (m_cons.texpr0 == NULL);
+}
+
+/// \brief Take ownership of a reference to an environment
+Environment::Environment(ap_environment_t* env)
+{
+  m_env = env;
+}
+
+/// \brief Take environment of other, other is left empty
+Environment::Environment(Environment&& other)
+{
+  m_env = other.m_env;
+  other.m_env = NULL;
+}
+
+/// \brief Free held environment and take the one of other
+Environment& Environment::operator=(Environment&& other)
+{
+  if (this != &other)
+  {
+    reset(other.m_env);
+    other.m_env = NULL;
+  }
+
+  return *this;
+}
+
+/// \brief Free held environment
+Environment::~Environment()
+{
+  reset();
+}
+
+/// \brief Free held environment and take ownership of another one
+void Environment::reset(ap_environment_t* env)
+{
+  if (m_env != NULL && m_env != env)
+  {
+    ap_environment_free(m_env);
+  }
+
+  m_env = env;
+}
+
+/// \brief Get held environment (still owned)
+ap_environment_t* Environment::get() const
+{
+  return m_env;
+}
+
+/// \brief Get held environment (still owned)
+Environment::operator ap_environment_t*() const
+{
+  return m_env;
+}
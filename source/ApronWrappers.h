@@ -0,0 +1,223 @@
+//
+// ApronWrappers.h
+//
+
+/// \file
+/// \brief Defines move-only owners of Apron values - AbstractValue,
+/// TreeExpr, TreeCons and Environment - which free the value they hold
+///
+#include <stddef.h>
+
+#ifndef APRONWRAPPERS_H
+# define APRONWRAPPERS_H
+
+#include <ap_global1.h>
+
+/// \brief Owner of an abstract value (ap_abstract1_t)
+///
+/// An empty AbstractValue holds nothing (abstract0 is NULL). Values are
+/// moved, not copied; copyOf() makes an explicit copy with
+/// ap_abstract1_copy().
+class AbstractValue
+{
+  public:
+
+    /// \brief Create empty abstract value
+    AbstractValue();
+
+    /// \brief Take ownership of an abstract value
+    /// @param man - Apron manager of value
+    /// @param value - abstract value (e.g. result of ap_abstract1_join())
+    AbstractValue(ap_manager_t* man, ap_abstract1_t value);
+
+    /// \brief Take abstract value of other, other is left empty
+    AbstractValue(AbstractValue&& other);
+
+    /// \brief Clear held abstract value and take the one of other
+    AbstractValue& operator=(AbstractValue&& other);
+
+    /// \brief Clear held abstract value
+    ~AbstractValue();
+
+    /// \brief Make owned copy of an abstract value
+    /// @param man - Apron manager of value
+    /// @param value - abstract value to copy (not owned)
+    /// @return AbstractValue - copy of value
+    static AbstractValue copyOf(ap_manager_t* man,
+      const ap_abstract1_t* value);
+
+    /// \brief Clear held abstract value and take ownership of another one
+    /// @param man - Apron manager of value
+    /// @param value - abstract value
+    /// @return void (nothing)
+    void reset(ap_manager_t* man, ap_abstract1_t value);
+
+    /// \brief Store result of a destructive Apron operation on held
+    /// abstract value (e.g. ap_abstract1_join(man, true, get(), ...)), held
+    /// value was consumed by the operation and is not cleared
+    /// @param value - result of the operation
+    /// @return void (nothing)
+    void update(ap_abstract1_t value);
+
+    /// \brief Clear held abstract value, it becomes empty
+    /// @return void (nothing)
+    void clear();
+
+    /// \brief Give up ownership of held abstract value, it becomes empty
+    /// @return ap_abstract1_t - abstract value, caller has to clear it
+    ap_abstract1_t release();
+
+    /// \brief Get held abstract value (still owned)
+    /// @return ap_abstract1_t* - abstract value
+    ap_abstract1_t* get();
+    const ap_abstract1_t* get() const;
+
+    /// \brief Check if no abstract value is held
+    /// @return bool - true if empty
+    bool isEmpty() const;
+
+  private:
+
+    /// \brief Apron manager of held value
+    ap_manager_t* m_man;
+
+    /// \brief Held abstract value
+    ap_abstract1_t m_value;
+
+    AbstractValue(const AbstractValue&);
+    AbstractValue& operator=(const AbstractValue&);
+};
+
+/// \brief Owner of a level-0 tree expression (ap_texpr0_t*)
+class TreeExpr
+{
+  public:
+
+    /// \brief Take ownership of a tree expression
+    /// @param expr - tree expression, may be NULL
+    explicit TreeExpr(ap_texpr0_t* expr = NULL);
+
+    /// \brief Take tree expression of other, other is left empty
+    TreeExpr(TreeExpr&& other);
+
+    /// \brief Free held tree expression and take the one of other
+    TreeExpr& operator=(TreeExpr&& other);
+
+    /// \brief Free held tree expression
+    ~TreeExpr();
+
+    /// \brief Free held tree expression and take ownership of another one
+    /// @param expr - tree expression, may be NULL
+    /// @return void (nothing)
+    void reset(ap_texpr0_t* expr = NULL);
+
+    /// \brief Give up ownership of held tree expression (e.g. when it is
+    /// pushed on expression stack or put in a constraint)
+    /// @return ap_texpr0_t* - tree expression, caller has to free it
+    ap_texpr0_t* release();
+
+    /// \brief Get held tree expression (still owned)
+    /// @return ap_texpr0_t* - tree expression, NULL if empty
+    ap_texpr0_t* get() const;
+
+  private:
+
+    /// \brief Held tree expression
+    ap_texpr0_t* m_expr;
+
+    TreeExpr(const TreeExpr&);
+    TreeExpr& operator=(const TreeExpr&);
+};
+
+/// \brief Owner of a level-0 tree constraint (ap_tcons0_t)
+class TreeCons
+{
+  public:
+
+    /// \brief Create empty tree constraint
+    TreeCons();
+
+    /// \brief Take ownership of a tree constraint
+    /// @param cons - tree constraint (e.g. result of ap_tcons0_make())
+    explicit TreeCons(ap_tcons0_t cons);
+
+    /// \brief Take tree constraint of other, other is left empty
+    TreeCons(TreeCons&& other);
+
+    /// \brief Clear held tree constraint and take the one of other
+    TreeCons& operator=(TreeCons&& other);
+
+    /// \brief Clear held tree constraint
+    ~TreeCons();
+
+    /// \brief Clear held tree constraint and take ownership of another one
+    /// @param cons - tree constraint
+    /// @return void (nothing)
+    void reset(ap_tcons0_t cons);
+
+    /// \brief Give up ownership of held tree constraint (e.g. when it is
+    /// set in a constraint array)
+    /// @return ap_tcons0_t - tree constraint, caller has to clear it
+    ap_tcons0_t release();
+
+    /// \brief Get held tree constraint (still owned)
+    /// @return ap_tcons0_t* - tree constraint
+    ap_tcons0_t* get();
+
+    /// \brief Check if no tree constraint is held
+    /// @return bool - true if empty
+    bool isEmpty() const;
+
+  private:
+
+    /// \brief Held tree constraint
+    ap_tcons0_t m_cons;
+
+    TreeCons(const TreeCons&);
+    TreeCons& operator=(const TreeCons&);
+};
+
+/// \brief Owner of a reference to an environment (ap_environment_t*)
+///
+/// Converts to ap_environment_t* so it can be passed to Apron functions
+/// directly; functions returning a new environment (e.g.
+/// ap_environment_add()) are stored with reset(), which frees the old one.
+class Environment
+{
+  public:
+
+    /// \brief Take ownership of a reference to an environment
+    /// @param env - environment, may be NULL
+    explicit Environment(ap_environment_t* env = NULL);
+
+    /// \brief Take environment of other, other is left empty
+    Environment(Environment&& other);
+
+    /// \brief Free held environment and take the one of other
+    Environment& operator=(Environment&& other);
+
+    /// \brief Free held environment
+    ~Environment();
+
+    /// \brief Free held environment and take ownership of another one
+    /// @param env - environment, may be NULL
+    /// @return void (nothing)
+    void reset(ap_environment_t* env = NULL);
+
+    /// \brief Get held environment (still owned)
+    /// @return ap_environment_t* - environment, NULL if empty
+    ap_environment_t* get() const;
+
+    /// \brief Get held environment (still owned)
+    operator ap_environment_t*() const;
+
+  private:
+
+    /// \brief Held environment
+    ap_environment_t* m_env;
+
+    Environment(const Environment&);
+    Environment& operator=(const Environment&);
+};
+
+#endif // APRONWRAPPERS_H
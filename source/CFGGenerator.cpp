@@ -10,14 +10,22 @@
 /// CAnalyzer uses LLVM frontend Clang v3.1 for CFG generation and traversal.
 
 /// \file
-/// \brief Driver program to get input C program, set compiler instance options
-///   and invoke parser by calling ParseAST()
+/// \brief Driver program to get input C program(s), set compiler instance
+///   options and invoke parser by calling ParseAST()
 ///
+#include <algorithm>
+#include <dirent.h>
+#include <errno.h>
+#include <fstream>
 #include <iostream>
+#include <set>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
 #include <vector>
 
+#include "llvm/ADT/IntrusiveRefCntPtr.h"
 #include "llvm/Support/Host.h"
 
 #include "clang/Basic/FileManager.h"
@@ -26,6 +34,18 @@
 #include "MyASTConsumer.h"
 
 #define HEADER_SEARCH_PATH "HEADER_SEARCH_PATH"
+#define BATCH_OPTION "--batch"
+
+/// \brief Frontend objects shared by all translation units analyzed in one
+/// run - target info, file manager and header search paths are set up once
+/// and reused for every input file
+typedef struct FrontendSetup
+{
+  clang::TargetOptions targetOptions;
+  llvm::IntrusiveRefCntPtr<clang::TargetInfo> targetInfo;
+  llvm::IntrusiveRefCntPtr<clang::FileManager> fileManager;
+  std::vector<std::string> headerPaths;
+} FrontendSetup;
 
 /// \brief Split a string for a given delimiter character
 /// and return a vector of split-strings
@@ -52,114 +72,165 @@ std::vector<std::string> split(const char *str, char c = ':')
   return result;
 }
 
-/// \brief main program that invokes parser by calling ParseAST()
-/// @param argc - number of arguments
-/// @param argv - command line arguments to main()
-/// @return int - return value
-int main(int argc, const char** argv)
+/// \brief Print usage of CAnalyzer
+void printUsage()
 {
-  // Check for arguments and print usage if arguments not provided
-  if (argc < 3)
-  {
-    std::cout << "\n\nUsage:\n\n"
-      << "./CAnalyzer <.c_file_to_analyze> <dump_file_to_be_created>\n\n"
-      << "e.g.\n" << "./CAnalyzer prg1.c prg1.txt\n\n"
-      << "./CAnalyzer testdata/prg1.c output/prg1.txt\n\n";
-
-    return 1;
-  }
+  std::cout << "\n\nUsage:\n\n"
+    << "./CAnalyzer [options] <.c_file_to_analyze> <dump_file_to_be_created>\n\n"
+    << "./CAnalyzer [options] " << BATCH_OPTION
+    << " <file_list_or_directory> <dump_directory>\n\n"
+    << "e.g.\n" << "./CAnalyzer prg1.c prg1.txt\n\n"
+    << "./CAnalyzer --domain=oct testdata/prg1.c output/prg1.txt\n\n"
+    << "./CAnalyzer " << BATCH_OPTION << " testdata output\n\n"
+    << "./CAnalyzer --config=analyzer.cfg " << BATCH_OPTION
+    << " files.lst output\n\n"
+    << "In batch mode the first argument is either a directory (all .c files\n"
+    << "in it are analyzed) or a text file with one .c file path per line.\n"
+    << "Dump for <dir>/<name>.c is written to <dump_directory>/<dir>_<name>.txt\n"
+    << "(with a number appended if two paths give the same name)\n\n";
+
+  AnalysisOptions::printHelp(std::cout);
+}
 
-  // Dump CFG to a file instead of console
-  // Get dump file name from command line argument
-  // - this file will be created in path specified
-  const char* DumpFile = argv[2];
+/// \brief Set up target information, file manager and header search paths
+/// once for all translation units
+/// @param setup - frontend setup to be filled
+/// @return bool - true on success, false otherwise
+bool initFrontendSetup(FrontendSetup& setup)
+{
+  // Add header search options
+  // - get environment variable HEADER_SEARCH_PATH
+  // - split HEADER_SEARCH_PATH into paths, these are added to header search
+  //   path of every compiler instance
+  const char* header_path = getenv(HEADER_SEARCH_PATH);
 
-  freopen(DumpFile, "w", stderr);
+  if (header_path == NULL)
+  {
+    std::cout << "\n HEADER_SEARCH_PATH is invalid! \n\n";
 
-  // CompilerIntance manages various objects - preprocessor, target information,
-  // ASTContext, etc. and provides utility function to manage clang objects
-  clang::CompilerInstance ci;
+    return false;
+  }
+  else
+  {
+    std::cout << "\n HEADER_SEARCH_PATH = " << header_path << "\n";
+  }
 
-  // Create Diagnostics - compiler instance must have Diagnostics created
-  ci.createDiagnostics(0, NULL);
+  setup.headerPaths = split(header_path);
 
   // Get default target triple
   // (Target triple is a string in the format of:
   // CPU_TYPE-VENDOR-KERNEL-OPERATING_SYSTEM
   // e.g. "i386-pc-linux-gnu")
-  clang::TargetOptions to;
+  setup.targetOptions.Triple = llvm::sys::getDefaultTargetTriple();
 
-  to.Triple = llvm::sys::getDefaultTargetTriple();
+  // TargetInfo needs Diagnostics to report an invalid triple, use a compiler
+  // instance only for creating it
+  clang::CompilerInstance setupCI;
 
-  // Set Target - compiler instance must have a Target set
-  clang::TargetInfo *ti;
-
-  ti = clang::TargetInfo::CreateTargetInfo(ci.getDiagnostics(), to);
-  ci.setTarget(ti);
+  setupCI.createDiagnostics(0, NULL);
 
-  // Set language default options
-  ci.getInvocation().setLangDefaults(clang::IK_C);
+  setup.targetInfo = clang::TargetInfo::CreateTargetInfo(
+    setupCI.getDiagnostics(), setup.targetOptions);
 
-  // Add header search options
-  // - get environment variable HEADER_SEARCH_PATH
-  // - split HEADER_SEARCH_PATH into paths and add to header search path
-  const char* header_path = getenv(HEADER_SEARCH_PATH);
-  
-  if (header_path == NULL)
+  if (setup.targetInfo.getPtr() == NULL)
   {
-    std::cout << "\n HEADER_SEARCH_PATH is invalid! \n\n";
+    std::cout << "\n Could not create target info for triple "
+      << setup.targetOptions.Triple << "\n\n";
 
-    return 1;
+    return false;
   }
-  else
+
+  // File manager caches lookups of header files, share it across
+  // translation units
+  setup.fileManager = new clang::FileManager(clang::FileSystemOptions());
+
+  return true;
+}
+
+/// \brief Parse and analyze one translation unit, dump goes to DumpFile
+/// @param setup - frontend setup shared by all translation units
+/// @param options - analysis options
+/// @param InputFile - C file to be analyzed
+/// @param DumpFile - dump file to be created
+/// @return bool - true on success, false otherwise
+bool analyzeFile(FrontendSetup& setup, const AnalysisOptions& options,
+  const char* InputFile, const char* DumpFile)
+{
+  // Dump CFG to a file instead of console
+  // - this file will be created in path specified
+  if (freopen(DumpFile, "w", stderr) == NULL)
   {
-    std::cout << "\n HEADER_SEARCH_PATH = " << header_path << "\n";
+    std::cout << "\n Could not create dump file " << DumpFile << "\n";
+
+    return false;
   }
 
-  std::vector <std::string> paths = split(header_path);
+  std::cout << "\n Analyzing " << InputFile << " -> " << DumpFile << "\n";
+
+  // printed here and not when a thread allocates its Apron manager, so
+  // output does not depend on the number of threads
+  printApronDomain(options.getDomain(), std::cout);
+
+  // CompilerIntance manages various objects - preprocessor, target information,
+  // ASTContext, etc. and provides utility function to manage clang objects
+  clang::CompilerInstance ci;
+
+  // Create Diagnostics - compiler instance must have Diagnostics created
+  ci.createDiagnostics(0, NULL);
+
+  // Set Target - compiler instance must have a Target set
+  ci.setTarget(setup.targetInfo.getPtr());
+
+  // Set language default options
+  ci.getInvocation().setLangDefaults(clang::IK_C);
 
   llvm::StringRef headerLoc;
 
-  for (int i = 0; i < paths.size(); i++)
+  for (int i = 0; i < setup.headerPaths.size(); i++)
   {
-    headerLoc = paths[i];
+    headerLoc = setup.headerPaths[i];
 
     ci.getHeaderSearchOpts().AddPath(headerLoc, clang::frontend::System,
       false, false, false);
   }
-  
-  // Get input file to be parsed from command line argument
-  // and add to path
-  const char* InputFile = argv[1];
 
+  // Add input file to be parsed to path
   llvm::StringRef FileToParse = InputFile;
 
   ci.getHeaderSearchOpts().AddPath(FileToParse, clang::frontend::System,
     false, false, false);
 
-  // Create file manager and source manager - for file management
-  ci.createFileManager();
+  // Set shared file manager and create source manager - for file management
+  ci.setFileManager(setup.fileManager.getPtr());
   ci.createSourceManager(ci.getFileManager());
 
+  // FileEntry - holds information about a file including file descriptor
+  const clang::FileEntry *pFile;
+
+  pFile = ci.getFileManager().getFile(FileToParse);
+
+  if (pFile == NULL)
+  {
+    std::cout << "\n Could not open input file " << InputFile << "\n";
+    std::cerr << "\n Could not open input file " << InputFile << "\n";
+
+    fflush(stderr);
+
+    return false;
+  }
+
   // Create preprocessor
   ci.createPreprocessor();
 
   // Create ASTContext - holds AST node types and declarations
-  clang::ASTContext *astContext;
-
   ci.createASTContext();
-  astContext = & ci.getASTContext();
 
   // Create AST reader
   MyASTConsumer *astConsumer;
 
-  astConsumer = new MyASTConsumer(&ci);
+  astConsumer = new MyASTConsumer(&ci, &options);
   ci.setASTConsumer(astConsumer);
 
-  // FileEntry - holds information about a file including file descriptor
-  const clang::FileEntry *pFile;
-
-  pFile = ci.getFileManager().getFile(FileToParse);
   ci.getSourceManager().createMainFileID(pFile);
   ci.getDiagnosticClient().BeginSourceFile(ci.getLangOpts(),
      &ci.getPreprocessor());
@@ -171,8 +242,247 @@ int main(int argc, const char** argv)
 
   ci.getDiagnosticClient().EndSourceFile();
 
-  fclose(stderr);
+  fflush(stderr);
 
-  return 0;
+  return true;
 }
 
+/// \brief Check if given string ends with suffix
+/// @param str - string to check
+/// @param suffix - suffix to look for
+/// @return bool - true if str ends with suffix, false otherwise
+bool endsWith(const std::string& str, const char* suffix)
+{
+  size_t len = strlen(suffix);
+
+  return str.size() >= len && str.compare(str.size() - len, len, suffix) == 0;
+}
+
+/// \brief Collect C files to be analyzed in batch mode
+/// @param batchInput - directory with .c files or file with one path per line
+///   (empty lines and lines starting with '#' are skipped)
+/// @param files - collected file paths
+/// @return bool - true on success, false otherwise
+bool collectInputFiles(const char* batchInput, std::vector<std::string>& files)
+{
+  struct stat st;
+
+  if (stat(batchInput, &st) != 0)
+  {
+    std::cout << "\n Batch input " << batchInput << " does not exist\n";
+
+    return false;
+  }
+
+  if (S_ISDIR(st.st_mode))
+  {
+    DIR* dir = opendir(batchInput);
+
+    if (dir == NULL)
+    {
+      std::cout << "\n Could not open directory " << batchInput << "\n";
+
+      return false;
+    }
+
+    std::string dirPath = batchInput;
+
+    if (!endsWith(dirPath, "/"))
+    {
+      dirPath += "/";
+    }
+
+    struct dirent* entry;
+
+    while ((entry = readdir(dir)) != NULL)
+    {
+      std::string name = entry->d_name;
+
+      if (endsWith(name, ".c"))
+      {
+        files.push_back(dirPath + name);
+      }
+    }
+
+    closedir(dir);
+
+    // readdir() order is not defined, keep runs reproducible
+    std::sort(files.begin(), files.end());
+  }
+  else
+  {
+    std::ifstream listFile(batchInput);
+    std::string line;
+
+    while (std::getline(listFile, line))
+    {
+      // Trim trailing white space (and '\r' of DOS line endings)
+      size_t last = line.find_last_not_of(" \t\r");
+
+      if (last == std::string::npos || line[0] == '#')
+      {
+        continue;
+      }
+
+      files.push_back(line.substr(0, last + 1));
+    }
+  }
+
+  return true;
+}
+
+/// \brief Get dump file name for an input file in batch mode, built from
+/// the whole path so that files of the same name in different directories
+/// do not overwrite each other's dump
+/// e.g. testdata/prg1.c -> <dumpDir>/testdata_prg1.txt
+/// @param dumpDir - directory for dump files
+/// @param inputFile - C file to be analyzed
+/// @param usedNames - names given to earlier files, a number is appended to
+/// a name already used (e.g. for a_b/c.c and a/b_c.c)
+/// @return std::string - dump file path
+std::string getDumpFileName(const std::string& dumpDir,
+  const std::string& inputFile, std::set<std::string>& usedNames)
+{
+  // Skip leading "/" and "./" of the path
+  size_t start = 0;
+
+  while (start < inputFile.size())
+  {
+    if (inputFile[start] == '/')
+    {
+      start++;
+    }
+    else
+    if (inputFile.compare(start, 2, "./") == 0)
+    {
+      start += 2;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  std::string baseName = inputFile.substr(start);
+
+  if (endsWith(baseName, ".c"))
+  {
+    baseName = baseName.substr(0, baseName.size() - 2);
+  }
+
+  std::replace(baseName.begin(), baseName.end(), '/', '_');
+
+  std::string name = baseName;
+
+  for (int i = 2; !usedNames.insert(name).second; i++)
+  {
+    name = baseName + "_" + std::to_string(i);
+  }
+
+  return dumpDir + "/" + name + ".txt";
+}
+
+/// \brief main program that invokes parser by calling ParseAST()
+/// @param argc - number of arguments
+/// @param argv - command line arguments to main()
+/// @return int - return value
+int main(int argc, const char** argv)
+{
+  // Analysis options are created once and used for every function of every
+  // translation unit
+  AnalysisOptions options;
+
+  bool batchMode = false;
+  std::vector<const char*> args;
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], BATCH_OPTION) == 0)
+    {
+      batchMode = true;
+    }
+    else
+    if (strncmp(argv[i], "--", 2) == 0)
+    {
+      if (!options.parseArgument(argv[i]))
+      {
+        printUsage();
+
+        return 1;
+      }
+    }
+    else
+    {
+      args.push_back(argv[i]);
+    }
+  }
+
+  // Check for arguments and print usage if arguments not provided
+  if (args.size() < 2)
+  {
+    printUsage();
+
+    return 1;
+  }
+
+  options.print(std::cout);
+
+  FrontendSetup setup;
+
+  if (!initFrontendSetup(setup))
+  {
+    return 1;
+  }
+
+  if (!batchMode)
+  {
+    // Get input file and dump file name from command line arguments
+    const char* InputFile = args[0];
+    const char* DumpFile = args[1];
+
+    bool ok = analyzeFile(setup, options, InputFile, DumpFile);
+
+    fclose(stderr);
+
+    return ok ? 0 : 1;
+  }
+
+  // Batch mode - analyze every translation unit in this process,
+  // each one gets its own dump file in dump directory
+  std::vector<std::string> files;
+
+  if (!collectInputFiles(args[0], files))
+  {
+    return 1;
+  }
+
+  std::string dumpDir = args[1];
+
+  if (mkdir(dumpDir.c_str(), 0755) != 0 && errno != EEXIST)
+  {
+    std::cout << "\n Could not create dump directory " << dumpDir << ": "
+      << strerror(errno) << "\n";
+
+    return 1;
+  }
+
+  int numFailed = 0;
+  std::set<std::string> usedNames;
+
+  for (int i = 0; i < files.size(); i++)
+  {
+    std::string dumpFile = getDumpFileName(dumpDir, files[i], usedNames);
+
+    if (!analyzeFile(setup, options, files[i].c_str(), dumpFile.c_str()))
+    {
+      numFailed++;
+    }
+  }
+
+  fclose(stderr);
+
+  std::cout << "\n Batch done: " << files.size() << " file(s), "
+    << numFailed << " failed\n\n";
+
+  return (numFailed == 0) ? 0 : 1;
+}
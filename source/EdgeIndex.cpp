@@ -0,0 +1,179 @@
+//
+// EdgeIndex.cpp
+//
+
+/// \file
+/// \brief Defines EdgeIndex - compressed sparse row (CSR) successor and
+/// predecessor index of CFG edges, indexed by block id
+///
+#include "EdgeIndex.h"
+
+/// \brief Stable counting sort of edges by block id
+/// @param edges - edges to sort
+/// @param numBlocks - number of block ids
+/// @param bySource - sort by source block id if true, destination otherwise
+/// @param offsets - filled with start of every block id, numBlocks + 1 entries
+/// @param sorted - filled with sorted edges
+/// @return void (nothing)
+static void sortEdges(const edgeStructList& edges, unsigned numBlocks,
+  bool bySource, std::vector<unsigned>& offsets, edgeStructList& sorted)
+{
+  offsets.assign(numBlocks + 1, 0);
+
+  for (int i = 0; i < edges.size(); i++)
+  {
+    clang::CFGBlock* block =
+      bySource ? edges[i]->sourceBlock : edges[i]->destBlock;
+    offsets[block->getBlockID() + 1]++;
+  }
+
+  for (unsigned b = 0; b < numBlocks; b++)
+  {
+    offsets[b + 1] += offsets[b];
+  }
+
+  std::vector<unsigned> next(offsets.begin(), offsets.end() - 1);
+  sorted.resize(edges.size());
+
+  for (int i = 0; i < edges.size(); i++)
+  {
+    clang::CFGBlock* block =
+      bySource ? edges[i]->sourceBlock : edges[i]->destBlock;
+    sorted[next[block->getBlockID()]++] = edges[i];
+  }
+}
+
+/// \brief Create empty index
+EdgeIndex::EdgeIndex()
+{
+  m_succOffsets.assign(1, 0);
+  m_predOffsets.assign(1, 0);
+}
+
+/// \brief Build index from edges of a CFG
+void EdgeIndex::build(unsigned numBlocks, const edgeStructList& edges)
+{
+  std::vector<unsigned> offsets;
+  edgeStructList bySource;
+
+  // Sorting by source, then stable by destination and again stable by
+  // source orders predecessors by source id and successors by
+  // destination id, the order of a row / column scan of a matrix
+  sortEdges(edges, numBlocks, true, offsets, bySource);
+  sortEdges(bySource, numBlocks, false, m_predOffsets, m_predEdges);
+  sortEdges(m_predEdges, numBlocks, true, m_succOffsets, m_succEdges);
+
+  m_backEdgeFrom.assign(numBlocks, NULL);
+  m_backEdgeTo.assign(numBlocks, NULL);
+  m_backEdges.clear();
+
+  for (int i = 0; i < m_succEdges.size(); i++)
+  {
+    if (m_succEdges[i]->isABackEdge)
+    {
+      markBackEdge(m_succEdges[i]);
+    }
+  }
+}
+
+/// \brief Get number of block ids the index was built for
+unsigned EdgeIndex::getNumBlocks() const
+{
+  return m_succOffsets.size() - 1;
+}
+
+/// \brief Find edge between two blocks
+edgeStruct* EdgeIndex::findEdge(unsigned sourceId, unsigned destId) const
+{
+  if (sourceId >= getNumBlocks())
+  {
+    return NULL;
+  }
+
+  // CFG blocks have few successors, a linear scan of the row is enough
+  for (unsigned i = m_succOffsets[sourceId];
+       i < m_succOffsets[sourceId + 1];
+       i++)
+  {
+    if (m_succEdges[i]->destBlock->getBlockID() == destId)
+    {
+      return m_succEdges[i];
+    }
+  }
+
+  return NULL;
+}
+
+/// \brief Get number of edges leaving a block
+unsigned EdgeIndex::getNumSuccEdges(unsigned blockId) const
+{
+  return m_succOffsets[blockId + 1] - m_succOffsets[blockId];
+}
+
+/// \brief Get i-th edge leaving a block
+edgeStruct* EdgeIndex::getSuccEdge(unsigned blockId, unsigned i) const
+{
+  return m_succEdges[m_succOffsets[blockId] + i];
+}
+
+/// \brief Get number of edges entering a block
+unsigned EdgeIndex::getNumPredEdges(unsigned blockId) const
+{
+  return m_predOffsets[blockId + 1] - m_predOffsets[blockId];
+}
+
+/// \brief Get i-th edge entering a block
+edgeStruct* EdgeIndex::getPredEdge(unsigned blockId, unsigned i) const
+{
+  return m_predEdges[m_predOffsets[blockId] + i];
+}
+
+/// \brief Mark edge as back edge and record it for its source and
+/// destination blocks
+void EdgeIndex::markBackEdge(edgeStruct* edge)
+{
+  unsigned sourceId = edge->sourceBlock->getBlockID();
+  unsigned destId = edge->destBlock->getBlockID();
+
+  edge->isABackEdge = true;
+  m_backEdges.push_back(edge);
+
+  // keep the edge a row / column scan would have found first
+  edgeStruct* from = m_backEdgeFrom[sourceId];
+
+  if (!from || destId < from->destBlock->getBlockID())
+  {
+    m_backEdgeFrom[sourceId] = edge;
+  }
+
+  edgeStruct* to = m_backEdgeTo[destId];
+
+  if (!to || sourceId < to->sourceBlock->getBlockID())
+  {
+    m_backEdgeTo[destId] = edge;
+  }
+}
+
+/// \brief Get back edge leaving a block
+edgeStruct* EdgeIndex::getBackEdgeFrom(unsigned blockId) const
+{
+  return blockId < m_backEdgeFrom.size() ? m_backEdgeFrom[blockId] : NULL;
+}
+
+/// \brief Get back edge entering a block
+edgeStruct* EdgeIndex::getBackEdgeTo(unsigned blockId) const
+{
+  return blockId < m_backEdgeTo.size() ? m_backEdgeTo[blockId] : NULL;
+}
+
+/// \brief Get number of back edges
+unsigned EdgeIndex::getNumBackEdges() const
+{
+  return m_backEdges.size();
+}
+
+/// \brief Get i-th back edge in the order they were marked
+edgeStruct* EdgeIndex::getBackEdge(unsigned i) const
+{
+  return m_backEdges[i];
+}
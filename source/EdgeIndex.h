@@ -0,0 +1,121 @@
+//
+// EdgeIndex.h
+//
+
+/// \file
+/// \brief Defines EdgeIndex - compressed sparse row (CSR) successor and
+/// predecessor index of CFG edges, indexed by block id
+///
+#include <vector>
+
+#ifndef EDGEINDEX_H
+# define EDGEINDEX_H
+
+#include "MyASTVisitor.h"
+
+/// \brief Successor and predecessor edges of every block of a CFG
+///
+/// Edges of block id b are succEdges[succOffsets[b] .. succOffsets[b+1])
+/// (b is source) and predEdges[predOffsets[b] .. predOffsets[b+1])
+/// (b is destination), so memory is O(V+E) instead of the V*V of an
+/// adjacency matrix. The back edge leaving and entering every block is
+/// recorded by markBackEdge(), so back-edge queries take constant time.
+class EdgeIndex
+{
+  public:
+
+    /// \brief Create empty index
+    EdgeIndex();
+
+    /// \brief Build index from edges of a CFG
+    /// @param numBlocks - number of block ids of CFG
+    /// @param edges - edges of CFG, edge records are not owned by index
+    /// @return void (nothing)
+    void build(unsigned numBlocks, const edgeStructList& edges);
+
+    /// \brief Get number of block ids the index was built for
+    /// @return unsigned - number of block ids
+    unsigned getNumBlocks() const;
+
+    /// \brief Find edge between two blocks
+    /// @param sourceId - block id of source block
+    /// @param destId - block id of destination block
+    /// @return edgeStruct* - edge if present otherwise NULL
+    edgeStruct* findEdge(unsigned sourceId, unsigned destId) const;
+
+    /// \brief Get number of edges leaving a block
+    /// @param blockId - block id
+    /// @return unsigned - number of successor edges
+    unsigned getNumSuccEdges(unsigned blockId) const;
+
+    /// \brief Get i-th edge leaving a block
+    /// @param blockId - block id
+    /// @param i - index of edge, less than getNumSuccEdges(blockId)
+    /// @return edgeStruct* - successor edge
+    edgeStruct* getSuccEdge(unsigned blockId, unsigned i) const;
+
+    /// \brief Get number of edges entering a block
+    /// @param blockId - block id
+    /// @return unsigned - number of predecessor edges
+    unsigned getNumPredEdges(unsigned blockId) const;
+
+    /// \brief Get i-th edge entering a block
+    /// @param blockId - block id
+    /// @param i - index of edge, less than getNumPredEdges(blockId)
+    /// @return edgeStruct* - predecessor edge
+    edgeStruct* getPredEdge(unsigned blockId, unsigned i) const;
+
+    /// \brief Mark edge as back edge and record it for its source and
+    /// destination blocks
+    /// @param edge - edge of the index
+    /// @return void (nothing)
+    void markBackEdge(edgeStruct* edge);
+
+    /// \brief Get back edge leaving a block
+    /// @param blockId - block id
+    /// @return edgeStruct* - back edge with lowest destination id,
+    /// NULL if there is none
+    edgeStruct* getBackEdgeFrom(unsigned blockId) const;
+
+    /// \brief Get back edge entering a block
+    /// @param blockId - block id
+    /// @return edgeStruct* - back edge with lowest source id,
+    /// NULL if there is none
+    edgeStruct* getBackEdgeTo(unsigned blockId) const;
+
+    /// \brief Get number of back edges
+    /// @return unsigned - number of edges marked by markBackEdge()
+    unsigned getNumBackEdges() const;
+
+    /// \brief Get i-th back edge in the order they were marked
+    /// @param i - index of back edge, less than getNumBackEdges()
+    /// @return edgeStruct* - back edge
+    edgeStruct* getBackEdge(unsigned i) const;
+
+  private:
+
+    /// \brief Start of successor edges of every block id, numBlocks + 1
+    /// entries
+    std::vector<unsigned> m_succOffsets;
+
+    /// \brief Successor edges grouped by source block id, in order of
+    /// destination block id
+    std::vector<edgeStruct *> m_succEdges;
+
+    /// \brief Start of predecessor edges of every block id, numBlocks + 1
+    /// entries
+    std::vector<unsigned> m_predOffsets;
+
+    /// \brief Predecessor edges grouped by destination block id, in order
+    /// of source block id
+    std::vector<edgeStruct *> m_predEdges;
+
+    /// \brief Back edge leaving / entering every block id, NULL if none
+    std::vector<edgeStruct *> m_backEdgeFrom;
+    std::vector<edgeStruct *> m_backEdgeTo;
+
+    /// \brief Back edges in the order they were marked (DFS order)
+    std::vector<edgeStruct *> m_backEdges;
+};
+
+#endif // EDGEINDEX_H
@@ -0,0 +1,353 @@
+//
+// LoopForest.cpp
+//
+
+/// \file
+/// \brief Defines LoopForest - loop-nesting forest of a CFG computed with an
+/// iterative Tarjan's algorithm
+///
+#include <utility>
+
+#include "LoopForest.h"
+
+/// \brief Create new loop and add it to its parent
+/// @param header - loop header
+/// @param parent - enclosing loop, NULL for the function
+/// @return t_loopStruct* - new loop
+static t_loopStruct* createLoop(clang::CFGBlock* header, t_loopStruct* parent)
+{
+  t_loopStruct* loop = new t_loopStruct;
+
+  loop->loopStart = header;
+  loop->loopEnd = NULL;
+  loop->parent = parent;
+  loop->depth = 0;
+
+  if (parent)
+  {
+    loop->depth = parent->depth + 1;
+    parent->children.push_back(loop);
+  }
+
+  return loop;
+}
+
+/// \brief Create empty forest
+LoopForest::LoopForest()
+{
+  m_edgeIndex = NULL;
+}
+
+/// \brief Free all loops
+LoopForest::~LoopForest()
+{
+  for (int i = 0; i < m_loops.size(); i++)
+  {
+    delete m_loops[i];
+  }
+}
+
+/// \brief Build forest of a CFG
+void LoopForest::build(clang::CFG* cfg, const EdgeIndex& edgeIndex)
+{
+  unsigned numBlocks = cfg->getNumBlockIDs();
+
+  m_edgeIndex = &edgeIndex;
+  m_blocks.assign(numBlocks, NULL);
+
+  for (clang::CFG::iterator block_it = cfg->begin();
+       block_it != cfg->end();
+       block_it++)
+  {
+    m_blocks[(*block_it)->getBlockID()] = *block_it;
+  }
+
+  m_headerLoop.assign(numBlocks, NULL);
+  m_latchLoop.assign(numBlocks, NULL);
+  m_innermostLoop.assign(numBlocks, NULL);
+  m_preorder.assign(numBlocks, -1);
+  m_mark.assign(numBlocks, 0);
+  m_index.assign(numBlocks, -1);
+  m_lowlink.assign(numBlocks, -1);
+  m_onStack.assign(numBlocks, false);
+  m_stack.clear();
+
+  clang::CFGBlock* entryBlock = *(cfg->rbegin());
+  clang::CFGBlock* exitBlock = *(--(cfg->rend()));
+
+  // root of the forest is the whole function
+  t_loopStruct* root = createLoop(entryBlock, NULL);
+  root->loopEnd = exitBlock;
+  m_loops.push_back(root);
+  m_headerLoop[entryBlock->getBlockID()] = root;
+
+  // DFS starts from entry block, then from blocks not reachable from it
+  std::vector<unsigned> nodes;
+  nodes.push_back(entryBlock->getBlockID());
+
+  for (unsigned b = 0; b < numBlocks; b++)
+  {
+    if (m_blocks[b] && b != entryBlock->getBlockID())
+    {
+      nodes.push_back(b);
+    }
+  }
+
+  for (int i = 0; i < nodes.size(); i++)
+  {
+    root->body.push_back(m_blocks[nodes[i]]);
+    m_innermostLoop[nodes[i]] = root;
+  }
+
+  // subgraphs still to be decomposed, with the loop enclosing them
+  std::vector<std::pair<t_loopStruct *, std::vector<unsigned> > > work;
+  work.push_back(std::make_pair(root, nodes));
+
+  int markCount = 0;
+
+  while (!work.empty())
+  {
+    t_loopStruct* parent = work.back().first;
+    nodes.swap(work.back().second);
+    work.pop_back();
+
+    int subgraphMark = ++markCount;
+
+    for (int i = 0; i < nodes.size(); i++)
+    {
+      m_mark[nodes[i]] = subgraphMark;
+    }
+
+    std::vector<std::vector<unsigned> > sccs;
+    findSCCs(nodes, subgraphMark, sccs);
+
+    for (int i = 0; i < sccs.size(); i++)
+    {
+      std::vector<unsigned>& scc = sccs[i];
+
+      // a single block is a loop only if it has an edge to itself
+      if (scc.size() == 1 && !edgeIndex.findEdge(scc[0], scc[0]))
+      {
+        continue;
+      }
+
+      // header is the block DFS entered the component with
+      unsigned header = scc[0];
+
+      for (int j = 1; j < scc.size(); j++)
+      {
+        if (m_preorder[scc[j]] < m_preorder[header])
+        {
+          header = scc[j];
+        }
+      }
+
+      int sccMark = ++markCount;
+
+      for (int j = 0; j < scc.size(); j++)
+      {
+        m_mark[scc[j]] = sccMark;
+      }
+
+      t_loopStruct* loop = createLoop(m_blocks[header], parent);
+      m_loops.push_back(loop);
+      m_headerLoop[header] = loop;
+
+      // loop end is source of first back edge to header found by DFS
+      for (int j = 0; j < edgeIndex.getNumBackEdges(); j++)
+      {
+        edgeStruct* edge = edgeIndex.getBackEdge(j);
+
+        if (edge->destBlock->getBlockID() == header &&
+            m_mark[edge->sourceBlock->getBlockID()] == sccMark)
+        {
+          loop->loopEnd = edge->sourceBlock;
+          break;
+        }
+      }
+
+      for (int j = 0; j < edgeIndex.getNumPredEdges(header); j++)
+      {
+        edgeStruct* edge = edgeIndex.getPredEdge(header, j);
+
+        if (m_mark[edge->sourceBlock->getBlockID()] == sccMark)
+        {
+          m_latchLoop[edge->sourceBlock->getBlockID()] = loop;
+
+          // irreducible loop, DFS did not enter it through header
+          if (loop->loopEnd == NULL)
+          {
+            loop->loopEnd = edge->sourceBlock;
+          }
+        }
+      }
+
+      std::vector<unsigned> innerNodes;
+      loop->body.push_back(m_blocks[header]);
+
+      for (int j = 0; j < scc.size(); j++)
+      {
+        unsigned b = scc[j];
+
+        if (b != header)
+        {
+          loop->body.push_back(m_blocks[b]);
+          innerNodes.push_back(b);
+        }
+
+        m_innermostLoop[b] = loop;
+
+        for (int k = 0; k < edgeIndex.getNumSuccEdges(b); k++)
+        {
+          edgeStruct* edge = edgeIndex.getSuccEdge(b, k);
+
+          if (m_mark[edge->destBlock->getBlockID()] != sccMark)
+          {
+            loop->exitEdges.push_back(edge);
+          }
+        }
+      }
+
+      // loops nested in this one are components of its body without header
+      if (!innerNodes.empty())
+      {
+        work.push_back(std::make_pair(loop, innerNodes));
+      }
+    }
+  }
+}
+
+/// \brief Find strongly connected components of subgraph of blocks
+/// marked with m_mark == mark, edges leaving it are ignored
+void LoopForest::findSCCs(const std::vector<unsigned>& nodes, int mark,
+  std::vector<std::vector<unsigned> >& sccs)
+{
+  for (int i = 0; i < nodes.size(); i++)
+  {
+    m_index[nodes[i]] = -1;
+    m_onStack[nodes[i]] = false;
+  }
+
+  int indexCount = 0;
+
+  // DFS stack of blocks with index of next successor edge to follow
+  std::vector<std::pair<unsigned, unsigned> > frames;
+
+  for (int i = 0; i < nodes.size(); i++)
+  {
+    if (m_index[nodes[i]] != -1)
+    {
+      continue;
+    }
+
+    frames.push_back(std::make_pair(nodes[i], 0u));
+
+    while (!frames.empty())
+    {
+      unsigned v = frames.back().first;
+      unsigned next = frames.back().second;
+
+      if (next == 0 && m_index[v] == -1)
+      {
+        // first time on v
+        m_index[v] = indexCount;
+        m_lowlink[v] = indexCount;
+        indexCount++;
+
+        if (m_preorder[v] == -1)
+        {
+          m_preorder[v] = m_index[v];
+        }
+
+        m_stack.push_back(v);
+        m_onStack[v] = true;
+      }
+
+      if (next < m_edgeIndex->getNumSuccEdges(v))
+      {
+        frames.back().second++;
+
+        unsigned w = m_edgeIndex->getSuccEdge(v, next)->destBlock->getBlockID();
+
+        if (m_mark[w] != mark)
+        {
+          continue;
+        }
+
+        if (m_index[w] == -1)
+        {
+          frames.push_back(std::make_pair(w, 0u));
+        }
+        else
+        if (m_onStack[w] && m_index[w] < m_lowlink[v])
+        {
+          m_lowlink[v] = m_index[w];
+        }
+
+        continue;
+      }
+
+      // all successors of v done
+      if (m_lowlink[v] == m_index[v])
+      {
+        std::vector<unsigned> scc;
+        unsigned w;
+
+        do
+        {
+          w = m_stack.back();
+          m_stack.pop_back();
+          m_onStack[w] = false;
+          scc.push_back(w);
+        } while (w != v);
+
+        sccs.push_back(scc);
+      }
+
+      frames.pop_back();
+
+      if (!frames.empty())
+      {
+        unsigned u = frames.back().first;
+
+        if (m_lowlink[v] < m_lowlink[u])
+        {
+          m_lowlink[u] = m_lowlink[v];
+        }
+      }
+    }
+  }
+}
+
+/// \brief Get root of forest, the function
+t_loopStruct* LoopForest::getRoot() const
+{
+  return m_loops.empty() ? NULL : m_loops[0];
+}
+
+/// \brief Get all loops, root first, every loop before its children
+const t_loopStructList& LoopForest::getLoops() const
+{
+  return m_loops;
+}
+
+/// \brief Get loop with given header
+t_loopStruct* LoopForest::getLoopOfHeader(clang::CFGBlock* header) const
+{
+  unsigned id = header->getBlockID();
+  return id < m_headerLoop.size() ? m_headerLoop[id] : NULL;
+}
+
+/// \brief Get loop closed by a back edge from given block
+t_loopStruct* LoopForest::getLoopOfLatch(clang::CFGBlock* latch) const
+{
+  unsigned id = latch->getBlockID();
+  return id < m_latchLoop.size() ? m_latchLoop[id] : NULL;
+}
+
+/// \brief Get innermost loop containing given block
+t_loopStruct* LoopForest::getInnermostLoop(clang::CFGBlock* block) const
+{
+  unsigned id = block->getBlockID();
+  return id < m_innermostLoop.size() ? m_innermostLoop[id] : getRoot();
+}
@@ -0,0 +1,107 @@
+//
+// LoopForest.h
+//
+
+/// \file
+/// \brief Defines LoopForest - loop-nesting forest of a CFG computed with an
+/// iterative Tarjan's algorithm
+///
+#include <vector>
+
+#ifndef LOOPFOREST_H
+# define LOOPFOREST_H
+
+#include "MyASTVisitor.h"
+#include "EdgeIndex.h"
+
+/// \brief Loop-nesting forest of a CFG
+///
+/// Loops are the strongly connected components of the CFG. The header of a
+/// loop is the block of the component found first by depth first search
+/// from entry block; loops nested in it are the components of its body
+/// without the header (Bourdoncle). The forest has a root t_loopStruct for
+/// the whole function, outermost loops are its children.
+class LoopForest
+{
+  public:
+
+    /// \brief Create empty forest
+    LoopForest();
+
+    /// \brief Free all loops
+    ~LoopForest();
+
+    /// \brief Build forest of a CFG
+    /// @param cfg - CFG of the function
+    /// @param edgeIndex - edges of cfg, back edges already marked
+    /// @return void (nothing)
+    void build(clang::CFG* cfg, const EdgeIndex& edgeIndex);
+
+    /// \brief Get root of forest, the function
+    /// @return t_loopStruct* - root loop, NULL before build()
+    t_loopStruct* getRoot() const;
+
+    /// \brief Get all loops, root first, every loop before its children
+    /// @return const t_loopStructList& - loops
+    const t_loopStructList& getLoops() const;
+
+    /// \brief Get loop with given header
+    /// @param header - header block, entry block for the root
+    /// @return t_loopStruct* - loop, NULL if block is no header
+    t_loopStruct* getLoopOfHeader(clang::CFGBlock* header) const;
+
+    /// \brief Get loop closed by a back edge from given block
+    /// @param latch - source of back edge
+    /// @return t_loopStruct* - loop, NULL if block is no source of a back
+    /// edge to a loop header
+    t_loopStruct* getLoopOfLatch(clang::CFGBlock* latch) const;
+
+    /// \brief Get innermost loop containing given block
+    /// @param block - CFG block
+    /// @return t_loopStruct* - innermost loop, root if block is in no loop
+    t_loopStruct* getInnermostLoop(clang::CFGBlock* block) const;
+
+  private:
+
+    // Forest owns its loops, it must not be copied
+    LoopForest(const LoopForest&);
+    LoopForest& operator=(const LoopForest&);
+
+    /// \brief Find strongly connected components of subgraph of blocks
+    /// marked with m_mark == mark, edges leaving it are ignored
+    /// @param nodes - block ids of subgraph in order DFS starts from them
+    /// @param mark - mark of subgraph
+    /// @param sccs - filled with components
+    /// @return void (nothing)
+    void findSCCs(const std::vector<unsigned>& nodes, int mark,
+      std::vector<std::vector<unsigned> >& sccs);
+
+    /// \brief Edges of CFG
+    const EdgeIndex* m_edgeIndex;
+
+    /// \brief Blocks of CFG by block id
+    std::vector<clang::CFGBlock *> m_blocks;
+
+    /// \brief Loops, root first
+    t_loopStructList m_loops;
+
+    /// \brief Loop of every block id as header / latch / innermost loop
+    std::vector<t_loopStruct *> m_headerLoop;
+    std::vector<t_loopStruct *> m_latchLoop;
+    std::vector<t_loopStruct *> m_innermostLoop;
+
+    /// \brief DFS preorder number of every block id from entry block
+    std::vector<int> m_preorder;
+
+    /// \brief Subgraph mark of every block id, see findSCCs()
+    std::vector<int> m_mark;
+
+    /// \brief Tarjan's algorithm - index, lowlink, stack of block ids and
+    /// bitset of block ids on stack
+    std::vector<int> m_index;
+    std::vector<int> m_lowlink;
+    std::vector<unsigned> m_stack;
+    std::vector<bool> m_onStack;
+};
+
+#endif // LOOPFOREST_H
@@ -6,18 +6,104 @@
 /// \brief Defines AST reader class MyASTConsumer inherited from
 /// clang::ASTConsumer
 ///
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
+#include <thread>
 
 #include "MyASTConsumer.h"
+#include "AnalysisOutput.h"
 
-/// \brief Set compiler instance for MyASTConsumer and MyASTVisitor
-MyASTConsumer::MyASTConsumer(clang::CompilerInstance* ci)
+/// \brief Top-level declaration to be analyzed by an analysis thread
+typedef struct AnalysisJob
+{
+  /// \brief Top-level declaration
+  clang::Decl* decl;
+
+  /// \brief Function definition of decl, NULL if decl is not one
+  clang::FunctionDecl* functionDecl;
+
+  /// \brief CFG of functionDecl built before threads start
+  clang::CFG* cfg;
+
+  /// \brief Output of the job, printed after output of all previous jobs
+  OutputBuffer* output;
+
+  /// \brief Set by analysis thread once the job is done
+  bool isDone;
+} AnalysisJob;
+
+/// \brief Jobs of a translation unit shared by analysis threads
+typedef struct AnalysisQueue
+{
+  /// \brief Jobs in source order
+  std::vector<AnalysisJob> jobs;
+
+  /// \brief Index of next job to be taken by a thread
+  std::atomic<int> nextJob;
+
+  /// \brief Guards isDone of jobs
+  std::mutex mutex;
+
+  /// \brief Signalled when a job is done
+  std::condition_variable jobDone;
+} AnalysisQueue;
+
+/// \brief Analysis thread - take jobs from queue until it is empty
+/// @param queue - jobs of translation unit
+/// @param astVisitor - visitor to copy, every thread needs its own
+/// @return void (nothing)
+static void runAnalysisThread(AnalysisQueue* queue,
+  const MyASTVisitor* astVisitor)
+{
+  MyASTVisitor visitor = *astVisitor;
+
+  while (true)
+  {
+    int i = queue->nextJob++;
+
+    if (i >= (int) queue->jobs.size())
+    {
+      break;
+    }
+
+    AnalysisJob& job = queue->jobs[i];
+
+    {
+      OutputRedirect redirect(job.output);
+
+      visitor.setPrebuiltCFG(job.functionDecl, job.cfg);
+
+      // Call TraverseDecl(clang::Decl* ) on this thread's MyASTVisitor
+      visitor.TraverseDecl(job.decl);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(queue->mutex);
+      job.isDone = true;
+    }
+
+    queue->jobDone.notify_one();
+  }
+
+  // Apron managers are per thread, see getApronManager()
+  freeApronManagers();
+}
+
+/// \brief Set compiler instance and analysis options for MyASTConsumer
+/// and MyASTVisitor
+MyASTConsumer::MyASTConsumer(clang::CompilerInstance* ci,
+  const AnalysisOptions* options)
 {
   m_complierInstance = ci;
+  m_options = options;
 
   m_astVisitor = MyASTVisitor();
 
   m_astVisitor.setCompilerInstance(ci);
+  m_astVisitor.setAnalysisOptions(options);
 }
 
 /// \brief Implement HandleTopLevelDecl and call TraverseDecl()
@@ -38,9 +124,97 @@ bool MyASTConsumer::HandleTopLevelDecl(clang::DeclGroupRef declGroupRef)
       std::cerr << ND->getNameAsString() << "\n";
     }
 */
+    if (m_options->getNumJobs() > 1)
+    {
+      // AST is still being built, analyze once the whole file is parsed
+      m_decls.push_back(*it);
+      continue;
+    }
+
     // Call TraverseDecl(clang::Decl* ) on instance of MyASTVisitor
     this->m_astVisitor.TraverseDecl(*it);
   }
 
   return true;
 }
+
+/// \brief Implement HandleTranslationUnit, analyze collected declarations
+void MyASTConsumer::HandleTranslationUnit(clang::ASTContext& context)
+{
+  if (!m_decls.empty())
+  {
+    analyzeInParallel();
+  }
+}
+
+/// \brief Analyze collected top-level declarations with a pool of threads
+void MyASTConsumer::analyzeInParallel()
+{
+  AnalysisQueue queue;
+
+  queue.jobs.resize(m_decls.size());
+  queue.nextJob = 0;
+
+  clang::SourceManager& sm = m_complierInstance->getSourceManager();
+
+  // Build CFGs here - CFG builder may add to ASTContext, which is not
+  // thread-safe. Functions in system headers are not analyzed, skip them.
+  for (int i = 0; i < m_decls.size(); i++)
+  {
+    AnalysisJob& job = queue.jobs[i];
+
+    job.decl = m_decls[i];
+    job.functionDecl = NULL;
+    job.cfg = NULL;
+    job.output = new OutputBuffer;
+    job.isDone = false;
+
+    clang::FunctionDecl* FD = llvm::dyn_cast<clang::FunctionDecl>(job.decl);
+
+    if (FD && FD->isThisDeclarationADefinition() &&
+        !sm.isInSystemHeader(FD->getLocation()))
+    {
+      clang::CFG::BuildOptions buildOpts;
+
+      job.functionDecl = FD;
+      job.cfg = clang::CFG::buildCFG(FD, FD->getBody(),
+        &(m_complierInstance->getASTContext()), buildOpts);
+    }
+  }
+
+  int numThreads = std::min(m_options->getNumJobs(), (int) queue.jobs.size());
+
+  std::vector<std::thread> threads;
+
+  for (int i = 0; i < numThreads; i++)
+  {
+    threads.push_back(std::thread(runAnalysisThread, &queue, &m_astVisitor));
+  }
+
+  // Print output of jobs in source order as soon as they are done
+  for (int i = 0; i < queue.jobs.size(); i++)
+  {
+    AnalysisJob& job = queue.jobs[i];
+
+    {
+      std::unique_lock<std::mutex> lock(queue.mutex);
+
+      while (!job.isDone)
+      {
+        queue.jobDone.wait(lock);
+      }
+    }
+
+    job.output->flush();
+
+    delete job.output;
+    delete job.cfg;
+  }
+
+  for (int i = 0; i < threads.size(); i++)
+  {
+    threads[i].join();
+  }
+
+  m_decls.clear();
+}
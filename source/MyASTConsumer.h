@@ -6,6 +6,8 @@
 /// \brief Defines AST reader class MyASTConsumer inherited from
 /// clang::ASTConsumer
 ///
+#include <vector>
+
 #include "clang/AST/ASTConsumer.h"
 #include "clang/Frontend/CompilerInstance.h"
 
@@ -19,22 +21,42 @@ class MyASTConsumer : public clang::ASTConsumer
 {
   public:
 
-    /// \brief Set compiler instance for MyASTConsumer and MyASTVisitor
+    /// \brief Set compiler instance and analysis options for MyASTConsumer
+    /// and MyASTVisitor
     /// @param ci - compiler instance
-    MyASTConsumer(clang::CompilerInstance* ci);
+    /// @param options - analysis options
+    MyASTConsumer(clang::CompilerInstance* ci, const AnalysisOptions* options);
 
     /// \brief Implement HandleTopLevelDecl and call TraverseDecl()
     /// @param declGroupRef - declarations
     /// @return bool - return value true
     virtual bool HandleTopLevelDecl(clang::DeclGroupRef declGroupRef);
 
+    /// \brief Implement HandleTranslationUnit, called once the whole file is
+    /// parsed - analyze collected declarations in parallel (--jobs=N)
+    /// @param context - ASTContext of translation unit
+    /// @return void (nothing)
+    virtual void HandleTranslationUnit(clang::ASTContext& context);
+
   private:
 
+    /// \brief Analyze collected top-level declarations with a pool of
+    /// threads and print their output in source order
+    /// @param none
+    /// @return void (nothing)
+    void analyzeInParallel();
+
     /// \brief CompilerInstance handle
     clang::CompilerInstance* m_complierInstance;
 
     /// \brief MyASTVisitor handle
     MyASTVisitor m_astVisitor;
+
+    /// \brief Analysis options
+    const AnalysisOptions* m_options;
+
+    /// \brief Top-level declarations collected to be analyzed in parallel
+    std::vector<clang::Decl*> m_decls;
 };
 
 #endif // MYASTCONSUMER_H
@@ -6,66 +6,90 @@
 /// \brief Defines AST node visitor class MyASTVisitor inherited from
 /// clang::RecursiveASTVisitor
 ///
+#include <functional>
 #include <iostream>
+#include <queue>
+#include <set>
 #include <string>
-#include <iomanip>
+#include <utility>
 
 #include "MyASTVisitor.h"
 #include "MyProcessStmt.h"
+#include "AnalysisContext.h"
+#include "AnalysisOutput.h"
 
-/// \brief Vector of MyCFGInfo records
-MyCFGInfoList myCFGInfoList;
-
-/// \brief List of edges in the top-down flow graph
-edgeStructList myEdgeStructList;
+/// \brief Mutex serializing lookups in clang::SourceManager
+std::mutex& getSourceManagerMutex()
+{
+  static std::mutex sourceManagerMutex;
 
-/// \brief source and destination block pointers to keep track of callee
-/// and called root nodes in the DFS
-CFGBlock * currentSourceBlock;
-CFGBlock * currentDestBlock;
+  return sourceManagerMutex;
+}
 
-/// \brief 2d array to hold the adjacency matrix
-std::vector <std::vector <int> > adjacencyMatrix;
-std::vector <std::vector <edgeStruct*> > edgeMatrix;
+/// \brief Mutex serializing queries of clang::ASTContext
+std::mutex& getASTContextMutex()
+{
+  static std::mutex astContextMutex;
 
-/// \brief Keep track of blocks to visit
-int* blocksToVisit;
+  return astContextMutex;
+}
 
-/// \brief Number of times loop unrolling to be done to delay widening
-int NumUnrollings = 5;
+/// \brief Set compiler instance
+void MyASTVisitor::setCompilerInstance(clang::CompilerInstance* ci)
+{
+  m_compilerInstance = ci;
+  m_context = NULL;
+  m_prebuiltFunction = NULL;
+  m_prebuiltCFG = NULL;
+}
 
-// add brief description for all declarations
-int myNumBlocks;
-t_blockStructList globalBlockList;
-t_loopStructList loopStructList;
+/// \brief Set analysis options
+void MyASTVisitor::setAnalysisOptions(const AnalysisOptions* options)
+{
+  m_options = options;
+}
 
-/// \brief CFG block list to traverse
-std::vector<clang::CFGBlock *> blockList;
-std::vector<clang::CFGBlock *> tempblockList;
-std::vector<clang::CFGBlock *> myTempBlockList;
+/// \brief Set CFG built before analysis for a function definition
+void MyASTVisitor::setPrebuiltCFG(const clang::FunctionDecl* functionDecl,
+  clang::CFG* cfg)
+{
+  m_prebuiltFunction = functionDecl;
+  m_prebuiltCFG = cfg;
+}
 
-t_loopStruct * currentLoop;
-clang::CFGBlock* exit_block;
-int * myBlocksToVisit;
+/// \brief Get printable name of a terminator kind
+const char* getTerminatorName(TerminatorKind kind)
+{
+  switch (kind)
+  {
+    case TERM_IF:
+      return "If";
+    case TERM_WHILE:
+      return "While";
+    case TERM_DOWHILE:
+      return "DoWhile";
+    case TERM_FOR:
+      return "For";
+    case TERM_GOTO:
+      return "Goto";
+    case TERM_EMPTY:
+      return "Empty";
+    case TERM_NONE:
+      break;
+  }
 
-std::vector<int > myindex;
-std::vector<int > lowlink;
-std::vector<clang::CFGBlock *> S;
-int indexcount;
-std::vector<bool > blocked;
-int se;
+  return "None";
+}
 
-/// \brief Set compiler instance
-void MyASTVisitor::setCompilerInstance(clang::CompilerInstance* ci)
+/// \brief Is terminator a condition (If / While / DoWhile / For)
+bool isConditionTerminator(TerminatorKind kind)
 {
-  m_compilerInstance = ci;
-
-  // Pointer to list of structure MySuccOfPredInfo
-  SuccOfPredInfo = NULL;
+  return (kind == TERM_IF || kind == TERM_WHILE ||
+          kind == TERM_DOWHILE || kind == TERM_FOR);
 }
 
-/// \brief Get terminator type (If/While/Do/For/None) for basic block
-std::string MyASTVisitor::getTerminatorType(clang::CFGBlock* cfg_block)
+/// \brief Get terminator type (If/While/Do/For/Goto/None) for basic block
+TerminatorKind MyASTVisitor::getTerminatorType(clang::CFGBlock* cfg_block)
 {
   // Get CFGTerminator object
   clang::CFGTerminator terminator = cfg_block->getTerminator();
@@ -73,41 +97,29 @@ std::string MyASTVisitor::getTerminatorType(clang::CFGBlock* cfg_block)
   // Get statement of Terminator
   clang::Stmt* s = terminator.getStmt();
 
-  // Note:- ENTRY and EXIT block of CFG will have terminator type as "Empty"
-
-  std::string terminator_type = "None";
+  // Note:- ENTRY and EXIT block of CFG will have terminator type as "Empty",
+  // set by createBlockList()
 
   if (s)
   {
-    std::string termStmtClass = s->getStmtClassName();
-
-    if (strcmp(termStmtClass.c_str(), "IfStmt") == 0)
-    {
-      terminator_type = "If";
-    }
-    else
-    if (strcmp(termStmtClass.c_str(), "WhileStmt") == 0)
-    {
-      terminator_type = "While";
-    }
-    else
-    if (strcmp(termStmtClass.c_str(), "DoStmt") == 0)
-    {
-      terminator_type = "DoWhile";
-    }
-    else
-    if (strcmp(termStmtClass.c_str(), "ForStmt") == 0)
-    {
-      terminator_type = "For";
-    }
-    else
-    if (strcmp(termStmtClass.c_str(), "GotoStmt") == 0)
-    {
-      terminator_type = "Goto";
+    switch (s->getStmtClass())
+    {
+      case clang::Stmt::IfStmtClass:
+        return TERM_IF;
+      case clang::Stmt::WhileStmtClass:
+        return TERM_WHILE;
+      case clang::Stmt::DoStmtClass:
+        return TERM_DOWHILE;
+      case clang::Stmt::ForStmtClass:
+        return TERM_FOR;
+      case clang::Stmt::GotoStmtClass:
+        return TERM_GOTO;
+      default:
+        break;
     }
   }
 
-  return terminator_type;
+  return TERM_NONE;
 }
 
 /// \brief Override VisitDecl (for declarations outside FunctionDecl)
@@ -116,13 +128,19 @@ bool MyASTVisitor::VisitDecl(clang::Decl *decl)
   clang::SourceLocation sLoc = decl->getLocation();
   clang::SourceManager & sm = m_compilerInstance->getSourceManager();
 
+  // SourceManager caches its last lookup, serialize lookups when
+  // functions are analyzed in parallel
+  std::unique_lock<std::mutex> lock(getSourceManagerMutex());
+
   clang::FileID fId= sm.getFileID(sLoc);
   const clang::FileEntry *fe = sm.getFileEntryForID(fId);
+  bool isSystemHeader = fe ? sm.isInSystemHeader(sLoc) : false;
+
+  lock.unlock();
 
   if(fe)
   {
     const char* fileName = fe->getName();
-    bool isSystemHeader = sm.isInSystemHeader(sLoc);
 
     // Do not dump system header files.
     if(!isSystemHeader)
@@ -132,15 +150,18 @@ bool MyASTVisitor::VisitDecl(clang::Decl *decl)
       // Take care of my global Variables
       if (strcmp(decl->getDeclKindName(), "Var") == 0)
       {
-        decl->dump();
-        std::cerr << "\n";
+        FileRawOstream errStream(getErrFile());
+        std::unique_lock<std::mutex> astLock(getASTContextMutex());
+        decl->print(errStream);
+        astLock.unlock();
+        getErrStream() << "\n";
 
         const NamedDecl *namedDecl = dyn_cast<NamedDecl>(decl);
 
         if (namedDecl)
         {
           std::string varName = namedDecl->getNameAsString();
-          std::cerr << "\tidentifier name = " << varName << "\n";
+          getErrStream() << "\tidentifier name = " << varName << "\n";
         }
 
         const ValueDecl *valueDecl = dyn_cast<ValueDecl>(decl);
@@ -153,8 +174,10 @@ bool MyASTVisitor::VisitDecl(clang::Decl *decl)
           // Now call clang::QualType.getAsString(PrintingPolicy &Policy)
           clang::ASTContext &context = this->m_compilerInstance->getASTContext();
 
+          std::unique_lock<std::mutex> lock(getASTContextMutex());
           std::string varType = declQT.getAsString(context.getPrintingPolicy());
-          std::cerr << "\ttype = " << varType << "\n";
+          lock.unlock();
+          getErrStream() << "\ttype = " << varType << "\n";
         }
 
       }  // Var ends
@@ -166,13 +189,193 @@ bool MyASTVisitor::VisitDecl(clang::Decl *decl)
   return false;
 }
 
+/// \brief Collects variables declared in a function body and the number of
+/// shift operators (every one needs a temporary variable)
+class FunctionVarCollector
+  : public clang::RecursiveASTVisitor<FunctionVarCollector>
+{
+  public:
+
+    FunctionVarCollector()
+    {
+      numShiftOps = 0;
+    }
+
+    bool VisitVarDecl(clang::VarDecl* varDecl)
+    {
+      varDecls.push_back(varDecl);
+      return true;
+    }
+
+    bool VisitBinaryOperator(clang::BinaryOperator* E)
+    {
+      switch (E->getOpcode())
+      {
+        case clang::BO_Shl:
+        case clang::BO_Shr:
+        case clang::BO_ShlAssign:
+        case clang::BO_ShrAssign:
+          numShiftOps++;
+          break;
+        default:
+          break;
+      }
+
+      return true;
+    }
+
+    /// \brief Variables in order of declaration
+    std::vector<clang::VarDecl *> varDecls;
+
+    /// \brief Number of shift operators (also compound assignments)
+    int numShiftOps;
+};
+
+/// \brief Check if constraints of condition of a terminator can be built
+/// once and reused by every visit of its block: condition must have no side
+/// effects (e.g. i++ or a call) and no shift operator (it takes a temporary
+/// variable)
+static bool isConditionCacheable(clang::Stmt* s, clang::ASTContext& context)
+{
+  clang::Expr* cond = NULL;
+
+  switch (s->getStmtClass())
+  {
+    case clang::Stmt::IfStmtClass:
+      cond = llvm::cast<clang::IfStmt>(s)->getCond();
+      break;
+    case clang::Stmt::WhileStmtClass:
+      cond = llvm::cast<clang::WhileStmt>(s)->getCond();
+      break;
+    case clang::Stmt::DoStmtClass:
+      cond = llvm::cast<clang::DoStmt>(s)->getCond();
+      break;
+    case clang::Stmt::ForStmtClass:
+      cond = llvm::cast<clang::ForStmt>(s)->getCond();
+      break;
+    default:
+      return false;
+  }
+
+  // for (;;)
+  if (cond == NULL)
+  {
+    return true;
+  }
+
+  {
+    // ASTContext is shared by analysis threads
+    std::lock_guard<std::mutex> lock(getASTContextMutex());
+
+    if (cond->HasSideEffects(context))
+    {
+      return false;
+    }
+  }
+
+  FunctionVarCollector collector;
+  collector.TraverseStmt(cond);
+
+  return (collector.numShiftOps == 0);
+}
+
+/// \brief Build Apron environment of a function in one pre-pass
+void MyASTVisitor::buildFunctionEnvironment(clang::FunctionDecl* functionDecl)
+{
+  std::vector<const clang::ValueDecl *> decls;
+
+  for (clang::FunctionDecl::param_iterator pit = functionDecl->param_begin();
+       pit != functionDecl->param_end();
+       pit++)
+  {
+    decls.push_back(*pit);
+  }
+
+  FunctionVarCollector collector;
+
+  if (functionDecl->getBody())
+  {
+    collector.TraverseStmt(functionDecl->getBody());
+  }
+
+  for (int i = 0; i < collector.varDecls.size(); i++)
+  {
+    decls.push_back(collector.varDecls[i]);
+  }
+
+  // scalar variables by Apron dimension type, a name declared again in an
+  // inner scope is the same Apron variable
+  std::vector<std::string> intVarNames;
+  std::vector<std::string> realVarNames;
+  std::set<std::string> names;
+
+  clang::ASTContext &context = m_compilerInstance->getASTContext();
+
+  for (int i = 0; i < decls.size(); i++)
+  {
+    std::string varName = decls[i]->getNameAsString();
+    std::unique_lock<std::mutex> lock(getASTContextMutex());
+    std::string varType =
+      decls[i]->getType().getAsString(context.getPrintingPolicy());
+    lock.unlock();
+
+    if (varName.empty())
+    {
+      continue;
+    }
+
+    // every declaration gets a symbol, statements look variables up by
+    // declaration instead of by name
+    addVariable(decls[i], varName.c_str(), varType.c_str());
+
+    if (!names.insert(varName).second)
+    {
+      continue;
+    }
+
+    const char* apronVarType = getApronDimType(varType.c_str());
+
+    if (strcmp(apronVarType, "int") == 0)
+    {
+      intVarNames.push_back(varName);
+    }
+    else
+    if (strcmp(apronVarType, "real") == 0)
+    {
+      realVarNames.push_back(varName);
+    }
+  }
+
+  buildEnvironment(intVarNames, realVarNames, collector.numShiftOps);
+}
+
 /// \brief Override VisitFunctionDecl() to traverse every FunctionDecl
 bool MyASTVisitor::VisitFunctionDecl(clang::FunctionDecl *functionDecl)
 {
+  // Get function name and options to analyze this function with
+  std::string functionName = functionDecl->getNameInfo().getAsString();
+
+  FunctionOptions functionOptions = m_options->getFunctionOptions(functionName);
+
+  // All state of the analysis of this function lives in context,
+  // it is freed when the function is done
+  AnalysisContext context(functionOptions);
+  AnalysisContextScope contextScope(&context);
+
+  m_context = &context;
+
   // Print function first
-  std::cerr << "\n------------------------------------------------------------";
-  std::cerr << "--------------------\n\n Print function:\n\n";
-  functionDecl->dump();
+  getErrStream()
+    << "\n------------------------------------------------------------";
+  getErrStream() << "--------------------\n\n Print function:\n\n";
+
+  if (functionOptions.verbosity > 0)
+  {
+    // printing uses ASTContext, which is shared by analysis threads
+    std::lock_guard<std::mutex> lock(getASTContextMutex());
+    FileRawOstream errStream(getErrFile());
+    functionDecl->print(errStream);
+  }
 
   // Check storage class specifier - only extern and static allowed in C
   switch (functionDecl->getStorageClassAsWritten())
@@ -181,10 +384,10 @@ bool MyASTVisitor::VisitFunctionDecl(clang::FunctionDecl *functionDecl)
       // no storage class specifier
       break;
     case SC_Extern:
-      std::cerr << "extern ";
+      getErrStream() << "extern ";
       break;
     case SC_Static:
-      std::cerr << "static ";
+      getErrStream() << "static ";
       break;
     case SC_Auto:
     case SC_Register:
@@ -193,25 +396,33 @@ bool MyASTVisitor::VisitFunctionDecl(clang::FunctionDecl *functionDecl)
     case SC_PrivateExtern:
     case SC_OpenCLWorkGroupLocal:
       // not needed for functions in C language
-      std::cerr << "Invalid storage class for functions";
+      getErrStream() << "Invalid storage class for functions";
       return false;
   }
 
-  // initialize apron manager and environment (see Apron.cpp)
-  initApron();
+  // set apron manager for selected domain and initialize environment
+  // (see Apron.cpp)
+  initApron(functionOptions.domain);
 
-  // Get function name
-  std::string functionName = functionDecl->getNameInfo().getAsString();
-  std::cerr << "\n Function Name: " << functionName << "\n";
+  getErrStream() << "\n Function Name: " << functionName << "\n";
+  getErrStream() << " Domain: ";
+  getErrStream() << AnalysisOptions::getDomainName(functionOptions.domain);
+  getErrStream() << "  NumUnrollings: " << m_context->NumUnrollings << "\n";
+
+  // add parameters, locals and temporaries of the function to environment
+  // at once, declarations found later are already in it
+  buildFunctionEnvironment(functionDecl);
 
   // Get return type of function
   clang::QualType QT = functionDecl->getResultType();
+  std::unique_lock<std::mutex> astLock(getASTContextMutex());
   std::string returnType = QT.getAsString();
-  std::cerr << "\n Function Return Type: " << returnType << "\n";
+  astLock.unlock();
+  getErrStream() << "\n Function Return Type: " << returnType << "\n";
 
   // Get function arguments
   clang::FunctionDecl::param_iterator pit;
-  std::cerr << "\n Function Arguments: \n";
+  getErrStream() << "\n Function Arguments: \n";
 
   for (pit  = functionDecl->param_begin();
        pit != functionDecl->param_end();
@@ -226,7 +437,7 @@ bool MyASTVisitor::VisitFunctionDecl(clang::FunctionDecl *functionDecl)
     if (namedDecl)
     {
       varName = namedDecl->getNameAsString();
-      std::cerr << "\tparam name = " << varName << "\n";
+      getErrStream() << "\tparam name = " << varName << "\n";
     }
 
     const ValueDecl *valueDecl = dyn_cast<ValueDecl>(param);
@@ -236,8 +447,10 @@ bool MyASTVisitor::VisitFunctionDecl(clang::FunctionDecl *functionDecl)
       QualType declQT = valueDecl->getType();
       clang::ASTContext &context = param->getASTContext();
 
+      std::unique_lock<std::mutex> lock(getASTContextMutex());
       varType = declQT.getAsString(context.getPrintingPolicy());
-      std::cerr << "\ttype = " << varType << "\n";
+      lock.unlock();
+      getErrStream() << "\ttype = " << varType << "\n";
     }
 
     getVarNameAndType(varName.c_str(), varType.c_str());
@@ -267,14 +480,32 @@ bool MyASTVisitor::VisitFunctionDecl(clang::FunctionDecl *functionDecl)
       MyCFG my_cfg;
 
       my_cfg.setCompilerInstance(this->m_compilerInstance);
-      my_cfg.cfg = my_cfg.getCFG(functionDecl, body,
-        &(this->m_compilerInstance->getASTContext()), buildOpts);
+      my_cfg.setAnalysisContext(m_context);
+
+      if (functionDecl == m_prebuiltFunction)
+      {
+        my_cfg.cfg = m_prebuiltCFG;
+      }
+      else
+      {
+        my_cfg.cfg = my_cfg.getCFG(functionDecl, body,
+          &(this->m_compilerInstance->getASTContext()), buildOpts);
+      }
 
-      std::cerr << "\n--------------------------------------------------------";
-      std::cerr << "------------------------\n\n Print Control Flow Graph:\n\n";
+      getErrStream()
+        << "\n--------------------------------------------------------";
+      getErrStream()
+        << "------------------------\n\n Print Control Flow Graph:\n\n";
 
       unsigned NumberOfBlocks = my_cfg.cfg->getNumBlockIDs();
-      std::cerr << " Number of blocks in CFG: " << NumberOfBlocks << "\n";
+      getErrStream() << " Number of blocks in CFG: " << NumberOfBlocks << "\n";
+
+      if (functionOptions.verbosity > 1)
+      {
+        std::lock_guard<std::mutex> lock(getASTContextMutex());
+        FileRawOstream errStream(getErrFile());
+        my_cfg.cfg->print(errStream, languageOptions);
+      }
 
       // get Entry block (topmost block)
       clang::CFGBlock* cfg_entry_block = *(my_cfg.cfg->rbegin());
@@ -283,613 +514,828 @@ bool MyASTVisitor::VisitFunctionDecl(clang::FunctionDecl *functionDecl)
       clang::CFGBlock* cfg_exit_block = *(--(my_cfg.cfg->rend()));
 
       // do pre-processing before we start analysis
-      // and prepare list of blocks to be visited in order
+      // and prepare weak topological order of blocks to be visited
       doPreprocessingBeforeAnalysis(my_cfg);
-      getListBreak(my_cfg);
 
-      bool isCurrentBlockASourceOfBackEdge = false;
-      bool isThisFixPoint = false;
-      bool isReachableFromEntryBlock = false;
-      int numWideningDone = 0;
-      unsigned blockId = 0;
+      m_context->entryBlock = cfg_entry_block;
+      m_context->exitBlock = cfg_exit_block;
 
-      clang::CFGBlock* cfg_block;
-      clang::CFGReverseBlockReachabilityAnalysis blockReahabilityCheck(*(my_cfg.cfg));
+      getErrStream() << "\n Iteration engine: ";
+      getErrStream() << AnalysisOptions::getEngineName(functionOptions.engine);
+      getErrStream() << "\n";
 
-      // now, traverse CFG blocks using blockList
-
-      for (int i = 0; i < blockList.size(); i++)
+      if (functionOptions.engine == ENGINE_WORKLIST)
+      {
+        // analyze blocks again only when their input changed
+        processWorklist(my_cfg);
+      }
+      else
       {
-        cfg_block = blockList[i];
+        // now, traverse CFG blocks in weak topological order, every loop is
+        // iterated until it is stable before blocks after it are visited
+        processWTOElements(my_cfg, 0, m_context->wto.getElements().size());
+      }
 
-        blockId = cfg_block->getBlockID();
+      getErrStream() << "\n  numBlocksProcessed = ";
+      getErrStream() << m_context->numBlocksProcessed;
+      getErrStream() << "\n  numWideningDone = " << m_context->numWideningDone;
+      getErrStream() << "\n";
 
-        isReachableFromEntryBlock = blockReahabilityCheck.isReachable(
-          cfg_entry_block, cfg_block);
+      if (m_options->getOutputFormat() == OUTPUT_SUMMARY)
+      {
+        getErrStream() << "\n Abstract values of function " << functionName
+          << ":\n";
+        my_cfg.printCFGInfo();
+      }
 
-        std::cerr << "\n--------------------------------------------------\n";
-        std::cerr << "\n Current CFGBlock \n - blockId = " << blockId;
+    } // if isThisDeclarationADefinition ends
+  } //if isa<FunctionDecl> ends
 
-        edgeStruct* backEdge = isASourceOfBackEdge(cfg_block);
+  // Return false to stop at function declaration level,
+  // (see ENTRY block with return true)
+  return false;
+}
 
-        if (backEdge == NULL)
-        {
-          isCurrentBlockASourceOfBackEdge = false;
-          std::cerr << "\n - is not the source of a back edge ";
-        }
-        else
-        {
-          isCurrentBlockASourceOfBackEdge = true;
-          std::cerr << "\n - is the source of a back edge ";
-        }
+/// \brief Analyze a block - join abstract values of its predecessors,
+/// process its statements and terminator and store result in MyCFGInfo
+void MyASTVisitor::processBlock(MyCFG& my_cfg, clang::CFGBlock* cfg_block,
+  WTOHeadState* headState)
+{
+  // Apron manager and abstract values of the function, these pointers
+  // do not change once initApron() has set them
+  ap_manager_t* man = m_context->man;
+  AbsVal* AbsValPtr = m_context->AbsValPtr;
+  AbstractMemory* AbstractMemoryPtr = m_context->AbstractMemoryPtr;
 
-        std::cerr << "\n - is reachable from Entry Block ";
-        std::cerr << "(true-1/false-0): ";
-        std::cerr << isReachableFromEntryBlock << "\n";
+  clang::CFGBlock* cfg_entry_block = m_context->entryBlock;
+  clang::CFGBlock* cfg_exit_block = m_context->exitBlock;
+  clang::LangOptions languageOptions;
 
-        // Now lets print current basic block first
-        cfg_block->dump(my_cfg.cfg, languageOptions);
+  unsigned blockId = cfg_block->getBlockID();
 
-        // get number of predecessors and successors
-        int numPredecessors = getNumPredecessors(cfg_block);
-        int numSuccessors = getNumSuccessors(cfg_block);
+  m_context->numBlocksProcessed++;
 
-        std::cerr << "\n  numPredecessors = " << numPredecessors << "\n";
-        std::cerr << "\n  numSuccessors = " << numSuccessors << "\n";
+  // always true, unreachable blocks are not in weak topological order
+  bool isReachableFromEntryBlock = m_context->reachableBlocks[blockId];
 
-        // get info about successors of predecessors
-        clang::CFGBlock::pred_iterator pred_it;
+  getErrStream() << "\n--------------------------------------------------\n";
+  getErrStream() << "\n Current CFGBlock \n - blockId = " << blockId;
 
-        for (pred_it  = cfg_block->pred_begin();
-             pred_it != cfg_block->pred_end();
-             pred_it++)
-        {
-          clang::CFGBlock* pred_block = *pred_it;
+  bool isLoopHead = (headState != NULL);
 
-          std::cerr << "\n  cfg_block = " << cfg_block->getBlockID();
-          std::cerr << " \tpredBlock = " << pred_block->getBlockID() << " \n";
+  if (!isLoopHead)
+  {
+    getErrStream() << "\n - is not a loop head ";
+  }
+  else
+  {
+    getErrStream() << "\n - is head of loop at depth "
+      << headState->loop->depth;
+    getErrStream() << ", iteration " << headState->iteration;
+  }
 
-          addSuccOfPredInfo(cfg_block, pred_block);
-        }
+  getErrStream() << "\n - is reachable from Entry Block ";
+  getErrStream() << "(true-1/false-0): ";
+  getErrStream() << isReachableFromEntryBlock << "\n";
 
-        showSuccOfPredInfo();
+  // Now lets print current basic block first
+  if (m_context->options.verbosity > 0)
+  {
+    // statements are printed through ASTContext shared by analysis threads
+    std::lock_guard<std::mutex> lock(getASTContextMutex());
+    FileRawOstream errStream(getErrFile());
+    cfg_block->print(errStream, my_cfg.cfg, languageOptions);
+  }
 
-        // get current basic block's terminator type
-        std::string termType = getTerminatorType(cfg_block);
+  // get number of predecessors and successors
+  int numPredecessors = getNumPredecessors(cfg_block);
+  int numSuccessors = getNumSuccessors(cfg_block);
 
-        // update block traversal list for while and for loop
-        if ((strcmp(termType.c_str(), "While") == 0) ||
-            (strcmp(termType.c_str(), "For") == 0))
-        {
-          processListWhileFor(cfg_block);
-        }
+  getErrStream() << "\n  numPredecessors = " << numPredecessors << "\n";
+  getErrStream() << "\n  numSuccessors = " << numSuccessors << "\n";
 
-        // update block traversal list for do-while loop
-        if (strcmp(termType.c_str(), "DoWhile") == 0)
-        {
-          processListDoWhile(cfg_block);
-        }
+  // get info about successors of predecessors, entries of an earlier
+  // visit of this block are replaced
+  m_context->SuccOfPredInfo[blockId].clear();
 
-        if (cfg_block == cfg_entry_block)
-        {
-          termType = "Empty";
+  clang::CFGBlock::pred_iterator pred_it;
 
-          // set abstract value at entry block
-          AbstractMemoryPtr->blockAbsVal = ap_abstract1_top(man, env);
-        }
-        else
-        if (cfg_block == cfg_exit_block)
-        {
-          termType = "Empty";
-        }
+  for (pred_it  = cfg_block->pred_begin();
+       pred_it != cfg_block->pred_end();
+       pred_it++)
+  {
+    clang::CFGBlock* pred_block = *pred_it;
 
-        // flag to denote is current block a unique successor
-        // i.e. if current block has one predecessor and that predecessor has
-        // only one successor
-        bool isUniqueSucc = isUniqueSuccessor(cfg_block);
-        std::cerr << "\n  isUniqueSucc = " << isUniqueSucc << "\n";
+    getErrStream() << "\n  cfg_block = " << cfg_block->getBlockID();
+    getErrStream() << " \tpredBlock = " << pred_block->getBlockID() << " \n";
 
-        // this view is of current basic block
+    addSuccOfPredInfo(cfg_block, pred_block);
+  }
 
-        MyCFGInfo* currentCFGInfo;
+  showSuccOfPredInfo(cfg_block);
 
-        // get predecessors of current basic block
-        std::vector<clang::CFGBlock *> preds = getPredecessors(cfg_block);
+  // get current basic block's terminator type (Empty for entry and exit)
+  TerminatorKind termKind = m_context->myCFGInfoList[blockId].terminatorKind;
 
-        if (numPredecessors > 1)
-        {
-          // current basic block has more than one predecessor blocks
+  if (cfg_block == cfg_entry_block)
+  {
+    // set abstract value at entry block, it is stored as its blockAbsVal
+    // at end of block
+    replaceAbsVal(AbstractValue(man, ap_abstract1_top(man, m_context->env)));
+  }
 
-          // abstract value of current block will be join of abstract values
-          // coming from its predecessors
-          //    B4                        B6
-          //     |                         |  B4     B3
-          //    B3                         \   |    / |
-          //   /  \                         \  \  B2  |
-          //  B2   |                         \  \  |  |
-          //   \  /                           \  \ | /
-          //    B1   B1 - two preds               B1    B1 - 4 preds
-          //
+  // flag to denote is current block a unique successor
+  // i.e. if current block has one predecessor and that predecessor has
+  // only one successor
+  bool isUniqueSucc = isUniqueSuccessor(cfg_block);
+  getErrStream() << "\n  isUniqueSucc = " << isUniqueSucc << "\n";
 
-          std::cerr << "\n came inside numPredecessors > 1\n";
-          ap_abstract1_t joined_abs_val;
-          edgeStruct * edge;
-          int count = 0;
+  // this view is of current basic block
 
-          for (int j = 0; j < preds.size(); j++)
-          {
-            std::cerr << "\n came inside numPredecessors > 1 -- first for loop\n";
+  MyCFGInfo* currentCFGInfo;
 
-            // get edge b/w predecessor and cfg_block
-            edge = getEdge(preds[j], cfg_block);
+  // get predecessors of current basic block
+  std::vector<clang::CFGBlock *> preds = getPredecessors(cfg_block);
 
-            std::cerr << "\n edge->isABackEdge = " << edge->isABackEdge;
-            std::cerr << " edge->hasBeenVisited = " << edge->hasBeenVisited << "\n";
+  if (numPredecessors > 1)
+  {
+    // current basic block has more than one predecessor blocks
 
-            isReachableFromEntryBlock = blockReahabilityCheck.isReachable(
-              cfg_entry_block, preds[j]);
+    // abstract value of current block will be join of abstract values
+    // coming from its predecessors
+    //    B4                        B6
+    //     |                         |  B4     B3
+    //    B3                         \   |    / |
+    //   /  \                         \  \  B2  |
+    //  B2   |                         \  \  |  |
+    //   \  /                           \  \ | /
+    //    B1   B1 - two preds               B1    B1 - 4 preds
+    //
 
-            // get initial joined_abs_val when following condition is true
-            if (!(edge->isABackEdge && !(edge->hasBeenVisited)) &&
-                 isReachableFromEntryBlock)
-            {
-              count = j;
+    getErrStream() << "\n came inside numPredecessors > 1\n";
+    AbstractValue joined_abs_val;
+    edgeStruct * edge;
 
-              std::cerr << "\n-- got initial joined_abs_val\n";
+    // abstract values of analyzed predecessors, still owned by their
+    // MyCFGInfo rows
+    std::vector<ap_abstract1_t> predAbsVals;
 
-              currentCFGInfo = getRowOfMyCFGInfo(preds[j]);
+    for (int j = 0; j < preds.size(); j++)
+    {
+      // get edge b/w predecessor and cfg_block
+      edge = getEdge(preds[j], cfg_block);
 
-              joined_abs_val = ap_abstract1_copy(man,
-                &(currentCFGInfo->blockAbsVal));
+      getErrStream() << "\n edge->isABackEdge = " << edge->isABackEdge;
+      getErrStream() << " edge->hasBeenVisited = " << edge->hasBeenVisited
+        << "\n";
 
-              break;
-            }
+      isReachableFromEntryBlock =
+        m_context->reachableBlocks[preds[j]->getBlockID()];
 
-            markVisited(preds[j], cfg_block);
+      // predecessor which is not analyzed yet (source of a back edge to
+      // a loop head in first iteration) has no MyCFGInfo row, skip it
+      currentCFGInfo = getRowOfMyCFGInfo(preds[j]);
 
-          }
+      if (currentCFGInfo != NULL && isReachableFromEntryBlock)
+      {
+        getErrStream() << "\n-- got joined_abs_val of pred ";
+        getErrStream() << preds[j]->getBlockID() << "\n";
 
-          for (int j = count +  1; j < preds.size(); j++)
-          {
-            std::cerr << "\n came inside numPredecessors > 1 -- second for loop\n";
-            edge = getEdge(preds[j], cfg_block);
+        predAbsVals.push_back(*(currentCFGInfo->blockAbsVal.get()));
+      }
 
-            isReachableFromEntryBlock = blockReahabilityCheck.isReachable(
-              cfg_entry_block, preds[j]);
+      markVisited(preds[j], cfg_block);
+    }
 
-            // skip this edge if following condition is true
-            if (!(edge->isABackEdge && !(edge->hasBeenVisited)) &&
-                 isReachableFromEntryBlock)
-            {
-              std::cerr << "\n-- got next joined_abs_val\n";
+    if (predAbsVals.empty())
+    {
+      // no predecessor analyzed yet
+      joined_abs_val.reset(man, ap_abstract1_bottom(man, m_context->env));
+    }
+    else
+    if (predAbsVals.size() == 1)
+    {
+      joined_abs_val = AbstractValue::copyOf(man, &predAbsVals[0]);
+    }
+    else
+    {
+      // join abstract values from all predecessors at once, cheaper than
+      // a chain of pairwise joins (e.g. one convex hull for polyhedra)
+      joined_abs_val.reset(man, ap_abstract1_join_array(man,
+        &predAbsVals[0], predAbsVals.size()));
+    }
 
-              // get pointer to predecessor's block info (2nd, 3rd, ...)
-              currentCFGInfo = getRowOfMyCFGInfo(preds[j]);
+    getErrStream() << "\n  @begin of block " << cfg_block->getBlockID();
+    getErrStream() << "  abstract value after join\n";
+    ap_abstract1_fprint(getErrFile(), man, joined_abs_val.get());
 
-              // join abstract values from predecessors
-              joined_abs_val = ap_abstract1_join(man, false, &joined_abs_val,
-                &(currentCFGInfo->blockAbsVal));
-            }
+    // set abstract value @ begin of this  block = joined abstract values
+    // from its predecessors
+    replaceAbsVal(std::move(joined_abs_val));
 
-              markVisited(preds[j], cfg_block);
-          }
+  } // if numPredecessors > 1 ends
+  else
+  if (numPredecessors == 1)
+  {
+    // current basic block has only one predecessor block
 
-          std::cerr << "\n  @begin of block " << cfg_block->getBlockID();
-          std::cerr << "  abstract value after join\n";
-          ap_abstract1_fprint(stderr, man, &joined_abs_val);
+    // get pointer to single predecessor's block info
+    clang::CFGBlock* singlePred = preds[0];
 
-          // set abstract value @ begin of this  block = joined abstract values
-          // from its predecessors
-          AbsValPtr->abstract_value = ap_abstract1_copy(man,
-            &joined_abs_val);
+    // saveCount is index of current cfg_block in blockList
+    // i+1 points to next cfg_block to be visited in blockList
+    markVisited(singlePred, cfg_block);
 
-        } // if numPredecessors > 1 ends
-        else
-        if (numPredecessors == 1)
-        {
-          // current basic block has only one predecessor block
-
-          // get pointer to single predecessor's block info
-          clang::CFGBlock* singlePred = preds[0];
-
-          // saveCount is index of current cfg_block in blockList
-          // i+1 points to next cfg_block to be visited in blockList
-          markVisited(singlePred, cfg_block);
-
-          std::cerr << "\n  predSingle blockid " << singlePred->getBlockID() << "\n";
-
-          // given this single predecessor find row of MyCFGInfo for abs val
-          currentCFGInfo = getRowOfMyCFGInfo(singlePred);
-
-          if ((strcmp(getTerminatorType(singlePred).c_str(), "If") == 0) ||
-              (strcmp(getTerminatorType(singlePred).c_str(), "While") == 0) ||
-              (strcmp(getTerminatorType(singlePred).c_str(), "DoWhile") == 0) ||
-              (strcmp(getTerminatorType(singlePred).c_str(), "For") == 0))
-          {
-            //    B3                      B4
-            //   /  \                    /  \
-            //  B2   |  B2 first_succ   B3  B2  B3 first_succ, B2 second_succ
-            //   \  /                    \  /
-            //    B1                      B1
-            //
-            std::cerr << "\n  I am block " << cfg_block->getBlockID();
-            std::cerr << " with single pred and term type If\n";
-
-            // find if the current block is first or second successor
-            // of its predecessor
-            bool isFirstSucc = isFirstSuccOfPred(cfg_block);
-            std::cerr << "\n  isFirstSucc = " << isFirstSucc << "\n";
-
-            if (isFirstSucc)
-            {
-              // first successor of its predecessor
-              ap_abstract1_t block_abs_val = ap_abstract1_copy(man,
-                &(currentCFGInfo->blockAbsVal));
-              ap_abstract1_t cond_abs_val = ap_abstract1_copy(man,
-                &(currentCFGInfo->condAbsVal));
-
-              // set abstract value @ begin of this  block = meet of abstract
-              // value of predecessor block and abstract value of positive of
-              // condition
-              AbsValPtr->abstract_value = ap_abstract1_meet(man, false,
-                &block_abs_val, &cond_abs_val);
-
-              std::cerr << "\n  @begin of block " << cfg_block->getBlockID();
-              std::cerr << "  abstract value after meet\n";
-              ap_abstract1_fprint(stderr, man, &(AbsValPtr->abstract_value));
-            }
-            else
-            {
-              // second successor of its predecessor
-              ap_abstract1_t block_abs_val = ap_abstract1_copy(man,
-                &(currentCFGInfo->blockAbsVal));
-              ap_abstract1_t neg_cond_abs_val = ap_abstract1_copy(man,
-                &(currentCFGInfo->negCondAbsVal));
-
-              // set abstract value @ begin of this  block = meet of abstract
-              // value of predecessor block and abstract value of negative of
-              // condition
-              AbsValPtr->abstract_value = ap_abstract1_meet(man, false,
-                &block_abs_val, &neg_cond_abs_val);
-
-              std::cerr << "\n  @begin of block " << cfg_block->getBlockID();
-              std::cerr << "  abstract value after meet\n";
-              ap_abstract1_fprint(stderr, man, &(AbsValPtr->abstract_value));
-            }
-          }
-          else
-          if (isUniqueSucc)
-          {
-            // current basic block is unique successor
-
-            //    B4  <- predecessor block (singlePred)
-            //    |
-            //    B3  <- current block (cfg_block)
-            //
-            // get abstract value of predecessor block and copy
-            // as abstract value for this unique successor
-            std::cerr << "\n  found unique succ\n";
-
-            // set abstract value @ begin of this  block = abstract value
-            // of single predecessor block
-            AbsValPtr->abstract_value = ap_abstract1_copy(man,
-              &(currentCFGInfo->blockAbsVal));
-
-            std::cerr << "  abstract value after copy for isUniqueSucc\n";
-            ap_abstract1_fprint(stderr, man, &(AbsValPtr->abstract_value));
-          }
+    getErrStream() << "\n  predSingle blockid " << singlePred->getBlockID()
+      << "\n";
 
-        }
+    // given this single predecessor find row of MyCFGInfo for abs val
+    currentCFGInfo = getRowOfMyCFGInfo(singlePred);
 
-        // START: Iterate over statements in a basic block
+    TerminatorKind predKind =
+      m_context->myCFGInfoList[singlePred->getBlockID()].terminatorKind;
 
-        // Iterate over a CFGBlock to get every element in it
-        clang::CFGBlock::iterator cfg_block_it;
+    if (isConditionTerminator(predKind))
+    {
+      //    B3                      B4
+      //   /  \                    /  \
+      //  B2   |  B2 first_succ   B3  B2  B3 first_succ, B2 second_succ
+      //   \  /                    \  /
+      //    B1                      B1
+      //
+      getErrStream() << "\n  I am block " << cfg_block->getBlockID();
+      getErrStream() << " with single pred and term type If\n";
 
-        // flag to denote is current statement last statement of basic block
-        bool isLastStatementOfBlock = false;
+      // find if the current block is first or second successor
+      // of its predecessor
+      bool isFirstSucc = isFirstSuccOfPred(cfg_block);
+      getErrStream() << "\n  isFirstSucc = " << isFirstSucc << "\n";
 
-        for (cfg_block_it  = cfg_block->begin();
-             cfg_block_it != cfg_block->end();
-             cfg_block_it++)
-        {
-          // Get CFGElement
-          clang::CFGElement element = *cfg_block_it;
-
-          // Ignore everything except clang::CFGElement::Statement for now
-          if (element.getKind() == clang::CFGElement::Statement)
-          {
-            // Get Stmt objects from CFGElement
-            const clang::CFGStmt* cfg_stmt = element.getAs<clang::CFGStmt>();
-
-            const clang::Stmt *stmt = cfg_stmt->getStmt();
-
-            isLastStatementOfBlock = false;
-
-            if (stmt)
-            {
-              // find if current statement is last statement of the block
-              clang::CFGElement last_element = *(--(cfg_block->end()));
-
-              const clang::CFGStmt* last_cfg_stmt;
-              last_cfg_stmt = last_element.getAs<clang::CFGStmt>();
-
-              const clang::Stmt* last_stmt = last_cfg_stmt->getStmt();
-
-              if (stmt == last_stmt)
-              {
-                isLastStatementOfBlock = true;
-              }
-
-              std::cerr << "\n found stmt \n";
-              std::cerr << "  isLastStatementOfBlock = ";
-              std::cerr << isLastStatementOfBlock << "\n";
-
-              // if this statement is last statement and this block has a
-              // terminator If, While, DoWhile, For - skip this conditional
-              // statement - will be taken care of inside Terminator's Visit
-              // method
-              if (isLastStatementOfBlock &&
-                 ((strcmp(termType.c_str(), "If") == 0) ||
-                  (strcmp(termType.c_str(), "While") == 0) ||
-                  (strcmp(termType.c_str(), "DoWhile") == 0) ||
-                  (strcmp(termType.c_str(), "For") == 0) ) )
-              {
-                // do nothing for this conditional statement
-              }
-              else
-              {
-                // Constructor of MyProcessStmt will invoke TraverseStmt(Stmt *)
-                MyProcessStmt myProcessStmt(this->m_compilerInstance,
-                  cfg_block->getBlockID(),
-                  (clang::Stmt *)stmt,
-                  isLastStatementOfBlock);
-
-                updateAbsValFromGlobalVarList();
-              }
-
-            } // if stmt ends
-
-          } // if element.getKind() ends
-
-        } // for cfg_block_it ends
-
-        // END: Iterate over statements in a basic block
-
-        std::cerr << "\n  abstract value after this block is processed\n";
-        ap_abstract1_fprint(stderr, man, &(AbsValPtr->abstract_value));
-
-        // update AbstractMemoryPtr now for current block
-        // thus we store abstract value after current basic block is processed
-        //if (strcmp(termType.c_str(), "None") == 0)
-        if ((strcmp(termType.c_str(), "None") == 0) ||
-            (strcmp(termType.c_str(), "Goto") == 0) )
-        {
-          AbstractMemoryPtr->blockAbsVal = ap_abstract1_copy(man,
-            &(AbsValPtr->abstract_value));
-        }
+      if (isFirstSucc)
+      {
+        // first successor of its predecessor
 
-        // Get CFGTerminator object
-        clang::CFGTerminator terminator = cfg_block->getTerminator();
+        // set abstract value @ begin of this  block = abstract value of
+        // predecessor block met with condition (computed by predecessor)
+        replaceAbsVal(AbstractValue::copyOf(man,
+          currentCFGInfo->condAbsVal.get()));
 
-        // Get statement of Terminator
-        clang::Stmt* s = terminator.getStmt();
+        getErrStream() << "\n  @begin of block " << cfg_block->getBlockID();
+        getErrStream() << "  abstract value after meet\n";
+        ap_abstract1_fprint(getErrFile(), man,
+          &(AbsValPtr->abstract_value));
+      }
+      else
+      {
+        // second successor of its predecessor
+
+        // set abstract value @ begin of this  block = abstract value of
+        // predecessor block met with negation of condition (computed by
+        // predecessor)
+        replaceAbsVal(AbstractValue::copyOf(man,
+          currentCFGInfo->negCondAbsVal.get()));
+
+        getErrStream() << "\n  @begin of block " << cfg_block->getBlockID();
+        getErrStream() << "  abstract value after meet\n";
+        ap_abstract1_fprint(getErrFile(), man,
+          &(AbsValPtr->abstract_value));
+      }
+    }
+    else
+    if (isUniqueSucc)
+    {
+      // current basic block is unique successor
 
-        if (s)
-        {
-          std::cerr << "\n found terminator stmt \n";
-          std::cerr << "\tStmtClassName: ";
-          std::cerr << s->getStmtClassName() << "\n\n";
+      //    B4  <- predecessor block (singlePred)
+      //    |
+      //    B3  <- current block (cfg_block)
+      //
+      // get abstract value of predecessor block and copy
+      // as abstract value for this unique successor
+      getErrStream() << "\n  found unique succ\n";
 
-          // We want to know what is inside CFGTerminator
-          // - control flow statements (if-else, while, etc.)
-          MyProcessStmt myProcessStmt(this->m_compilerInstance,
-            cfg_block->getBlockID(),
-            (clang::Stmt *)s,
-            true);
+      // set abstract value @ begin of this  block = abstract value
+      // of single predecessor block
+      replaceAbsVal(AbstractValue::copyOf(man,
+        currentCFGInfo->blockAbsVal.get()));
 
-          updateAbsValFromGlobalVarList();
-        }
+      getErrStream() << "  abstract value after copy for isUniqueSucc\n";
+      ap_abstract1_fprint(getErrFile(), man,
+        &(AbsValPtr->abstract_value));
+    }
+    else
+    {
+      // predecessor has several successors but no condition terminator
+      // (e.g. switch), each successor starts with its abstract value; the
+      // current value is not left over from the block analyzed before
+      getErrStream() << "\n  found succ of block with several successors\n";
 
-        // set abstract values for blocks with terminator
-        // If / While / DoWhile / For
-        if ((strcmp(termType.c_str(), "If") == 0) ||
-            (strcmp(termType.c_str(), "While") == 0) ||
-            (strcmp(termType.c_str(), "DoWhile") == 0) ||
-            (strcmp(termType.c_str(), "For") == 0) )
-        {
-          AbstractMemoryPtr->blockAbsVal = ap_abstract1_copy(man,
-            &(AbsValPtr->abstract_value));
-
-          CondExprAbsVal* t_CondExprAbsVal = removeCondExprAbsVal();
-          AbstractMemoryPtr->condAbsVal = ap_abstract1_copy(man,
-            &(t_CondExprAbsVal->condAbsVal));
-          AbstractMemoryPtr->negCondAbsVal = ap_abstract1_copy(man,
-            &(t_CondExprAbsVal->negCondAbsVal));
-
-          std::cerr << "\n  abstract value after block terminator is processed\n";
-          ap_abstract1_fprint(stderr, man, &(AbstractMemoryPtr->blockAbsVal));
-          ap_abstract1_fprint(stderr, man, &(AbstractMemoryPtr->condAbsVal));
-          ap_abstract1_fprint(stderr, man, &(AbstractMemoryPtr->negCondAbsVal));
-        }
+      replaceAbsVal(AbstractValue::copyOf(man,
+        currentCFGInfo->blockAbsVal.get()));
+    }
 
-        // START: widening logic
+  }
 
-        ap_abstract1_t loopExitAbsValCurrent;
-        ap_abstract1_t loopExitAbsValNew;
-        ap_abstract1_t loopExitAbsValOld;
+  // START: widening logic
 
-        if (isCurrentBlockASourceOfBackEdge)
-        {
-          // See if this is first visit to block leading to back edge
-          if (isFirstTime(cfg_block))
-          {
-            loopExitAbsValOld = ap_abstract1_bottom(man, env);
-          }
-          else
-          {
-            // if not, get loopExitAbsValOld
-            loopExitAbsValOld = getLoopExitAbsValOld(cfg_block);
-          }
-
-          // that is we are at exit block of loop
-          // - from current block there is back edge to block with T:While
-          loopExitAbsValCurrent = ap_abstract1_copy(man,
-            &(AbstractMemoryPtr->blockAbsVal));
-
-          std::cerr << "\n  loopExitAbsValOld before widening:\n";
-          ap_abstract1_fprint(stderr, man, &loopExitAbsValOld);
-
-          //if (! ap_abstract1_is_bottom(man, &loopExitAbsValOld))
-          if (backEdge->timesVisited > 1)
-          {
-            // this is the case other than first iteration of the loop
-
-            // Condition for loop unrolling
-            if (backEdge->timesVisited % NumUnrollings == 0)
-            {
-              loopExitAbsValNew = ap_abstract1_widening(man, &loopExitAbsValOld,
-                &loopExitAbsValCurrent);
-              numWideningDone++;
-              std::cerr << "widening done.\n";
-            }
-            else
-            {
-              loopExitAbsValNew = ap_abstract1_copy(man, &loopExitAbsValCurrent);
-            }
-
-            if (ap_abstract1_is_eq(man, &loopExitAbsValNew, &loopExitAbsValOld))
-            {
-              // stop
-              isThisFixPoint = true;
-              std::cerr << "\n  We have reached at fixed point! ";
-              std::cerr << "after widening " << numWideningDone << " times\n";
-
-              // Reset timesVisited counter of back edge if fix point is reached
-              resetTimesVisited(cfg_block);
-            }
-            else
-            {
-              // do again and call modifyListWiden()
-              // copy widened new value into old value
-              loopExitAbsValOld = ap_abstract1_copy(man, &loopExitAbsValNew);
-              isThisFixPoint = false;
-              std::cerr << "\n  not yet fixed point ";
-            }
-          }
-          else
-          {
-            // in first iteration of loop, loopExitAbsValOld is bottom
-            // so, copy loopExitAbsValCurrent into loopExitAbsValOld
-            loopExitAbsValOld = ap_abstract1_copy(man, &loopExitAbsValCurrent);
-            loopExitAbsValNew = ap_abstract1_copy(man, &loopExitAbsValCurrent);
-          }
-
-          // don't forget to update blockAbsVal in MyCFGInfo for this block
-          AbstractMemoryPtr->blockAbsVal = ap_abstract1_copy(man,
-            &loopExitAbsValNew);
-
-          std::cerr << "\n  inside isCurrentBlockASourceOfBackEdge:";
-          std::cerr << "\n  loopExitAbsValOld:\n";
-          ap_abstract1_fprint(stderr, man, &loopExitAbsValOld);
-          std::cerr << "\n  loopExitAbsValCurrent:\n";
-          ap_abstract1_fprint(stderr, man, &loopExitAbsValCurrent);
-          std::cerr << "\n  loopExitAbsValNew:\n";
-          ap_abstract1_fprint(stderr, man, &loopExitAbsValNew);
-          std::cerr << "\n  numWideningDone = " << numWideningDone << "\n";
-        }
+  // abstract value at begin of a loop head is joined with the one of
+  // previous iteration, and widened once loop has been unrolled
+  // NumUnrollings times; the loop is stable when it does not grow
+  if (isLoopHead)
+  {
+    if (headState->iteration > 0)
+    {
+      getErrStream() << "\n  loopHeadAbsValOld before widening:\n";
+      ap_abstract1_fprint(getErrFile(), man, headState->absValOld.get());
 
-        // END: widening logic
+      // current value is replaced by the joined one, join in place into it
+      AbsValPtr->abstract_value = ap_abstract1_join(man, true,
+        &(AbsValPtr->abstract_value), headState->absValOld.get());
 
-        // add this basic block info in CFGInfo
-        my_cfg.addCFGInfo(blockId,
-          cfg_block,
-          termType,
-          isCurrentBlockASourceOfBackEdge,
-          AbstractMemoryPtr,
-          loopExitAbsValNew);
+      if (headState->iteration >= m_context->NumUnrollings)
+      {
+        replaceAbsVal(AbstractValue(man, ap_abstract1_widening(man,
+          headState->absValOld.get(), &(AbsValPtr->abstract_value))));
+        m_context->numWideningDone++;
+        getErrStream() << "widening done.\n";
+      }
 
-        my_cfg.printCFGInfo();
+      headState->isStable = ap_abstract1_is_leq(man,
+        &(AbsValPtr->abstract_value), headState->absValOld.get());
+    }
 
-        // ok, if this block is leading to back edge and this is not fix point
-        // call modifyListWiden()
-        // but this should happen after MyCFGInfo entry of this block is updated
-        if (isCurrentBlockASourceOfBackEdge && (!isThisFixPoint))
-        {
-          i = modifyListWiden(cfg_block, i);
-        }
+    // keep value at head for next iteration, value of last iteration is
+    // cleared
+    headState->absValOld = AbstractValue::copyOf(man,
+      &(AbsValPtr->abstract_value));
 
-        // reset fix point flag
-        isThisFixPoint = false;
-      } // for CFG::iterator ends
+    getErrStream() << "\n  @begin of loop head " << cfg_block->getBlockID();
+    getErrStream() << "  abstract value after widening\n";
+    ap_abstract1_fprint(getErrFile(), man, &(AbsValPtr->abstract_value));
 
-    } // if isThisDeclarationADefinition ends
-  } //if isa<FunctionDecl> ends
+    if (headState->isStable)
+    {
+      getErrStream() << "\n  We have reached at fixed point! ";
+      getErrStream() << "after widening " << m_context->numWideningDone;
+      getErrStream() << " times\n";
+    }
+    else
+    {
+      getErrStream() << "\n  not yet fixed point ";
+    }
+  }
 
-  // Return false to stop at function declaration level,
-  // (see ENTRY block with return true)
-  return false;
-}
+  // END: widening logic
 
-/// \brief Do pre-processing before analysis begins on CFG block list
-void MyASTVisitor::doPreprocessingBeforeAnalysis(MyCFG my_cfg)
-{
-  unsigned NumberOfBlocks = my_cfg.cfg->getNumBlockIDs();
+  // START: Iterate over statements in a basic block
 
-  createBlockList(my_cfg);
+  MyCFGInfo& blockInfo = m_context->myCFGInfoList[blockId];
 
-  printBlockStruct();
+  if (blockInfo.transferProgram != NULL)
+  {
+    // statements were lowered on first visit, no AST traversal
+    getErrStream() << "\n  running transfer program of block " << blockId;
+    getErrStream() << " (" << blockInfo.transferProgram->size();
+    getErrStream() << " operations)\n";
 
-  // get Entry block (topmost block)
-  clang::CFGBlock* cfg_entry_block = *(my_cfg.cfg->rbegin());
+    runTransferProgram(blockInfo.transferProgram);
+  }
+  else
+  {
+    startTransferRecording(new TransferProgram);
+    processBlockStatements(cfg_block, termKind);
+    blockInfo.transferProgram = stopTransferRecording();
+  }
 
-  // get Exit block (last block)
-  clang::CFGBlock* cfg_exit_block = *(--(my_cfg.cfg->rend()));
+  // END: Iterate over statements in a basic block
 
-  // get vector<clang::CFGBlock *> blockList containing list of blocks
-  // to be visited in order
+  getErrStream() << "\n  abstract value after this block is processed\n";
+  ap_abstract1_fprint(getErrFile(), man, &(AbsValPtr->abstract_value));
 
-  // initially mark all blocks as not visited or to be visited
-  blocksToVisit = (int *) new int [NumberOfBlocks];
+  // Get CFGTerminator object
+  clang::CFGTerminator terminator = cfg_block->getTerminator();
 
-  for (int i = 0; i < NumberOfBlocks; i++)
+  // Get statement of Terminator
+  clang::Stmt* s = terminator.getStmt();
+
+  // update AbstractMemoryPtr now for current block
+  // thus we store abstract value after current basic block is processed
+  // (entry and exit blocks too, blockAbsVal of last block was moved into
+  // MyCFGInfo and is not there anymore)
+  if (!isConditionTerminator(termKind))
   {
-    blocksToVisit[i] = WHITE;
+    if (s)
+    {
+      // terminator statement below still works on current value
+      AbstractMemoryPtr->blockAbsVal = AbstractValue::copyOf(man,
+        &(AbsValPtr->abstract_value));
+    }
+    else
+    {
+      // current value is not needed anymore, next block replaces it
+      AbstractMemoryPtr->blockAbsVal = takeAbsVal();
+    }
   }
 
-  // creating and initializing adjacency matrix to 0
-  for (int i = 0; i < NumberOfBlocks; i++)
+  // constraints of condition built on an earlier visit of this block
+  bool isCondCached =
+    isConditionTerminator(termKind) && blockInfo.condCons != NULL;
+
+  if (s && !isCondCached)
+  {
+    getErrStream() << "\n found terminator stmt \n";
+    getErrStream() << "\tStmtClassName: ";
+    getErrStream() << s->getStmtClassName() << "\n\n";
+
+    // We want to know what is inside CFGTerminator
+    // - control flow statements (if-else, while, etc.)
+    MyProcessStmt myProcessStmt(this->m_compilerInstance,
+      cfg_block->getBlockID(),
+      (clang::Stmt *)s,
+      true);
+
+    updateAbsValFromGlobalVarList();
+  }
+
+  // set abstract values for blocks with terminator
+  // If / While / DoWhile / For
+  if (isConditionTerminator(termKind))
   {
-    std::vector <int> row;
+    CondExprCons* t_CondExprCons = blockInfo.condCons;
+    CondExprCons t_removedCons;
+
+    if (t_CondExprCons == NULL)
+    {
+      // constraints removed from the stack are owned here, nothing known
+      // about a condition which pushed none
+      CondExprCons* t_top = removeCondExprCons();
+      t_removedCons = t_top ? *t_top : makeCondExprCons(2);
+      t_CondExprCons = &t_removedCons;
+
+      if (s && isConditionCacheable(s,
+            this->m_compilerInstance->getASTContext()))
+      {
+        // condition is the same on every visit, keep its constraints
+        // (linearized once if they are linear)
+        blockInfo.condCons = new CondExprCons(t_removedCons);
+        linearizeCondExprCons(blockInfo.condCons);
+        t_CondExprCons = blockInfo.condCons;
+      }
+    }
+    else
+    {
+      getErrStream() << "\n  reusing constraints of condition of block ";
+      getErrStream() << blockId << "\n";
+    }
+
+    // values of both branches: block value met with the constraints of
+    // condition and of its negation
+    AbstractMemoryPtr->condAbsVal.reset(man,
+      meetCondExprCons(&(AbsValPtr->abstract_value), t_CondExprCons,
+        false));
+    AbstractMemoryPtr->negCondAbsVal.reset(man,
+      meetCondExprCons(&(AbsValPtr->abstract_value), t_CondExprCons,
+        true));
 
-    for (int j = 0; j < NumberOfBlocks; j++)
+    if (t_CondExprCons == &t_removedCons)
     {
-      row.push_back(0);
+      clearCondExprCons(&t_removedCons);
     }
-    adjacencyMatrix.push_back(row);
+
+    // current value is not needed anymore, next block replaces it
+    AbstractMemoryPtr->blockAbsVal = takeAbsVal();
+
+    getErrStream()
+      << "\n  abstract value after block terminator is processed\n";
+    ap_abstract1_fprint(getErrFile(), man,
+      AbstractMemoryPtr->blockAbsVal.get());
+    ap_abstract1_fprint(getErrFile(), man,
+      AbstractMemoryPtr->condAbsVal.get());
+    ap_abstract1_fprint(getErrFile(), man,
+      AbstractMemoryPtr->negCondAbsVal.get());
   }
 
-  
-  for (int i = 0; i < NumberOfBlocks; i++)
+  // expressions of terminator are not needed anymore
+  resetStatementArena();
+
+  // add this basic block info in CFGInfo
+  my_cfg.addCFGInfo(blockId,
+    isLoopHead,
+    AbstractMemoryPtr,
+    isLoopHead ? headState->absValOld.get() : NULL);
+
+  if (m_options->getOutputFormat() == OUTPUT_FULL)
+  {
+    my_cfg.printCFGInfo();
+  }
+}
+
+/// \brief Process statements of a block (terminator excluded) on current
+/// abstract value
+void MyASTVisitor::processBlockStatements(clang::CFGBlock* cfg_block,
+  TerminatorKind termKind)
+{
+  // Iterate over a CFGBlock to get every element in it
+  clang::CFGBlock::iterator cfg_block_it;
+
+  // flag to denote is current statement last statement of basic block
+  bool isLastStatementOfBlock = false;
+
+  for (cfg_block_it  = cfg_block->begin();
+       cfg_block_it != cfg_block->end();
+       cfg_block_it++)
+  {
+    // Get CFGElement
+    clang::CFGElement element = *cfg_block_it;
+
+    // Ignore everything except clang::CFGElement::Statement for now
+    if (element.getKind() == clang::CFGElement::Statement)
+    {
+      // Get Stmt objects from CFGElement
+      const clang::CFGStmt* cfg_stmt = element.getAs<clang::CFGStmt>();
+
+      const clang::Stmt *stmt = cfg_stmt->getStmt();
+
+      isLastStatementOfBlock = false;
+
+      if (stmt)
+      {
+        // find if current statement is last statement of the block
+        clang::CFGElement last_element = *(--(cfg_block->end()));
+
+        const clang::CFGStmt* last_cfg_stmt;
+        last_cfg_stmt = last_element.getAs<clang::CFGStmt>();
+
+        const clang::Stmt* last_stmt = last_cfg_stmt->getStmt();
+
+        if (stmt == last_stmt)
+        {
+          isLastStatementOfBlock = true;
+        }
+
+        getErrStream() << "\n found stmt \n";
+        getErrStream() << "  isLastStatementOfBlock = ";
+        getErrStream() << isLastStatementOfBlock << "\n";
+
+        // if this statement is last statement and this block has a
+        // terminator If, While, DoWhile, For - skip this conditional
+        // statement - will be taken care of inside Terminator's Visit
+        // method
+        if (isLastStatementOfBlock && isConditionTerminator(termKind))
+        {
+          // do nothing for this conditional statement
+        }
+        else
+        {
+          // Constructor of MyProcessStmt will invoke TraverseStmt(Stmt *)
+          MyProcessStmt myProcessStmt(this->m_compilerInstance,
+            cfg_block->getBlockID(),
+            (clang::Stmt *)stmt,
+            isLastStatementOfBlock);
+
+          updateAbsValFromGlobalVarList();
+
+          // expressions of this statement are not needed anymore
+          resetStatementArena();
+        }
+
+      } // if stmt ends
+
+    } // if element.getKind() ends
+
+  } // for cfg_block_it ends
+}
+
+/// \brief Analyze elements [begin, end) of weak topological order
+void MyASTVisitor::processWTOElements(MyCFG& my_cfg, int begin, int end)
+{
+  const std::vector<WTOElement>& elements = m_context->wto.getElements();
+  int i = begin;
+
+  while (i < end)
+  {
+    if (elements[i].componentEnd)
+    {
+      stabilizeComponent(my_cfg, i);
+      i = elements[i].componentEnd;
+    }
+    else
+    {
+      processBlock(my_cfg, elements[i].block, NULL);
+      i++;
+    }
+  }
+}
+
+/// \brief Analyze component of weak topological order until its head is
+/// stable (Bourdoncle's recursive iteration strategy)
+void MyASTVisitor::stabilizeComponent(MyCFG& my_cfg, int head)
+{
+  const WTOElement& element = m_context->wto.getElements()[head];
+
+  WTOHeadState headState;
+  headState.loop = element.loop;
+  headState.iteration = 0;
+  headState.isStable = false;
+
+  while (true)
+  {
+    processBlock(my_cfg, element.block, &headState);
+
+    if (headState.isStable)
+    {
+      // body was analyzed with the same value at head, it is stable too
+      break;
+    }
+
+    // nested components are stabilized in every iteration of this one
+    processWTOElements(my_cfg, head + 1, element.componentEnd);
+
+    headState.iteration++;
+  }
+
+  // headState.absValOld is cleared here, loopHeadAbsValOld of MyCFGInfo of
+  // head holds a copy
+}
+
+/// \brief Analyze blocks with a worklist ordered by reverse postorder
+void MyASTVisitor::processWorklist(MyCFG& my_cfg)
+{
+  ap_manager_t* man = m_context->man;
+  const std::vector<clang::CFGBlock *>& blockList = m_context->blockList;
+  const std::vector<WTOElement>& elements = m_context->wto.getElements();
+  unsigned NumberOfBlocks = my_cfg.cfg->getNumBlockIDs();
+
+  // priority of a block is its index in blockList, the flattened weak
+  // topological order, which is a reverse postorder of the CFG: blocks
+  // come after their predecessors except for sources of back edges
+  std::vector<int> priority(NumberOfBlocks, -1);
+
+  // iteration state of loop heads, indexed by block id
+  std::vector<WTOHeadState> headStates(NumberOfBlocks);
+  std::vector<bool> isHead(NumberOfBlocks, false);
+
+  for (int i = 0; i < elements.size(); i++)
   {
-    std::vector <edgeStruct *> row;
+    unsigned id = elements[i].block->getBlockID();
+
+    priority[id] = i;
 
-    for (int j = 0; j < NumberOfBlocks; j++)
+    if (elements[i].componentEnd)
     {
-      row.push_back(NULL);
+      isHead[id] = true;
+      headStates[id].loop = elements[i].loop;
+      headStates[id].iteration = 0;
+      headStates[id].isStable = false;
     }
-    edgeMatrix.push_back(row);
   }
 
-  // creating edges of the original cfg top down
-  clang::CFG::reverse_iterator cfg_rit;
-  int edgesCreated[NumberOfBlocks];
+  // smallest priority first, inWorklist keeps a block in it once
+  std::priority_queue<int, std::vector<int>, std::greater<int> > worklist;
+  std::vector<bool> inWorklist(NumberOfBlocks, false);
+
+  // every block is analyzed once, in reverse postorder
+  for (int i = 0; i < blockList.size(); i++)
+  {
+    worklist.push(i);
+    inWorklist[blockList[i]->getBlockID()] = true;
+  }
+
+  while (!worklist.empty())
+  {
+    clang::CFGBlock* cfg_block = blockList[worklist.top()];
+    unsigned id = cfg_block->getBlockID();
+
+    worklist.pop();
+    inWorklist[id] = false;
+
+    // keep output of last visit to find out if it changes
+    MyCFGInfo* info = getRowOfMyCFGInfo(cfg_block);
+    bool isFirstVisit = (info == NULL);
+    bool hasCondition = !isFirstVisit &&
+      isConditionTerminator(info->terminatorKind);
+    AbstractValue oldBlockAbsVal, oldCondAbsVal, oldNegCondAbsVal;
+
+    if (!isFirstVisit)
+    {
+      // output of last visit is replaced by processBlock(), so it is moved
+      // out of the row; it is copied only if the block is its own
+      // predecessor and reads its row
+      bool isOwnPred = false;
+
+      for (int j = 0; j < m_context->edgeIndex.getNumSuccEdges(id); j++)
+      {
+        if (m_context->edgeIndex.getSuccEdge(id, j)->destBlock == cfg_block)
+        {
+          isOwnPred = true;
+        }
+      }
+
+      if (isOwnPred)
+      {
+        oldBlockAbsVal = AbstractValue::copyOf(man, info->blockAbsVal.get());
+      }
+      else
+      {
+        oldBlockAbsVal = std::move(info->blockAbsVal);
+      }
+
+      if (hasCondition && isOwnPred)
+      {
+        oldCondAbsVal = AbstractValue::copyOf(man, info->condAbsVal.get());
+        oldNegCondAbsVal = AbstractValue::copyOf(man,
+          info->negCondAbsVal.get());
+      }
+      else
+      if (hasCondition)
+      {
+        oldCondAbsVal = std::move(info->condAbsVal);
+        oldNegCondAbsVal = std::move(info->negCondAbsVal);
+      }
+    }
+
+    processBlock(my_cfg, cfg_block, isHead[id] ? &(headStates[id]) : NULL);
+
+    if (isHead[id])
+    {
+      headStates[id].iteration++;
+    }
+
+    bool hasChanged = isFirstVisit;
+
+    if (!isFirstVisit)
+    {
+      info = getRowOfMyCFGInfo(cfg_block);
+
+      hasChanged = !ap_abstract1_is_eq(man, oldBlockAbsVal.get(),
+        info->blockAbsVal.get());
+
+      if (hasCondition)
+      {
+        hasChanged = hasChanged ||
+          !ap_abstract1_is_eq(man, oldCondAbsVal.get(),
+            info->condAbsVal.get()) ||
+          !ap_abstract1_is_eq(man, oldNegCondAbsVal.get(),
+            info->negCondAbsVal.get());
+      }
+    }
+
+    getErrStream() << "\n  worklist: output of block " << id;
+    getErrStream() << (hasChanged ? " changed\n" : " did not change\n");
+
+    if (!hasChanged)
+    {
+      continue;
+    }
+
+    // inputs of successors changed, analyze them again
+    for (int j = 0; j < m_context->edgeIndex.getNumSuccEdges(id); j++)
+    {
+      edgeStruct* edge = m_context->edgeIndex.getSuccEdge(id, j);
+      unsigned succId = edge->destBlock->getBlockID();
+
+      if (priority[succId] >= 0 && !inWorklist[succId])
+      {
+        worklist.push(priority[succId]);
+        inWorklist[succId] = true;
+      }
+    }
+  }
+
+  // headStates[].absValOld are cleared here, loopHeadAbsValOld of MyCFGInfo
+  // holds a copy
+}
+
+/// \brief Do pre-processing before analysis begins on CFG block list
+void MyASTVisitor::doPreprocessingBeforeAnalysis(MyCFG my_cfg)
+{
+  unsigned NumberOfBlocks = my_cfg.cfg->getNumBlockIDs();
+
+  createBlockList(my_cfg);
+
+  printBlockStruct();
+
+  // get Entry block (topmost block)
+  clang::CFGBlock* cfg_entry_block = *(my_cfg.cfg->rbegin());
+
+  // get Exit block (last block)
+  clang::CFGBlock* cfg_exit_block = *(--(my_cfg.cfg->rend()));
+
+  // get vector<clang::CFGBlock *> blockList containing list of blocks
+  // to be visited in order
+
+  // initially mark all blocks as not visited or to be visited
+  m_context->blocksToVisit = (int *) new int [NumberOfBlocks];
 
   for (int i = 0; i < NumberOfBlocks; i++)
   {
-    edgesCreated[i] = 0;
+    m_context->blocksToVisit[i] = WHITE;
   }
 
+  // creating edges of the original cfg top down
+  clang::CFG::reverse_iterator cfg_rit;
+  std::vector<char> edgesCreated(NumberOfBlocks, 0);
+
   for (cfg_rit  = my_cfg.cfg->rbegin();
        cfg_rit != my_cfg.cfg->rend();
        cfg_rit++)
@@ -917,13 +1363,16 @@ void MyASTVisitor::doPreprocessingBeforeAnalysis(MyCFG my_cfg)
     }
   }
 
-  std::cout <<"\nEdges in the forward direction are: \n";
+  // index edges by source and destination block id
+  m_context->edgeIndex.build(NumberOfBlocks, m_context->myEdgeStructList);
+
+  getOutStream() <<"\nEdges in the forward direction are: \n";
   displayEdges();
 
   // Detecting the back edges
-  findBackEdges(cfg_entry_block, blocksToVisit);
+  findBackEdges(cfg_entry_block, m_context->blocksToVisit);
 
-  std::cout << "\nThe back edges are: \n";
+  getOutStream() << "\nThe back edges are: \n";
   displayBackEdges();
 
   // creating edges of the original cfg bottom up
@@ -934,111 +1383,116 @@ void MyASTVisitor::doPreprocessingBeforeAnalysis(MyCFG my_cfg)
     edgesCreated[i] = 0;
   }
 
-  // Display the Adjacency Matrix
-  std::cout << "\nAdjacency Matrix is: \n";
+  // Display successors and predecessors of every block
+  getOutStream() << "\nSuccessors are: \n";
 
   for (int i = 0; i < NumberOfBlocks; i++)
   {
-    std::cout << "\n|";
+    getOutStream() << "\n" << i << ":";
 
-    for (int j = 0; j < NumberOfBlocks; j++)
+    for (int j = 0; j < m_context->edgeIndex.getNumSuccEdges(i); j++)
     {
-      std::cout << " " << adjacencyMatrix[i][j];
+      getOutStream() << " "
+        << m_context->edgeIndex.getSuccEdge(i, j)->destBlock->getBlockID();
     }
-    std::cout <<"|";
   }
 
-  std::cout << "\n\n";
+  getOutStream() << "\n\n";
 
-  
-  std::cerr << "\nEdge Matrix is: \n";
+  getErrStream() << "\nPredecessor edges are: \n";
 
   for (int i = 0; i < NumberOfBlocks; i++)
   {
-    std::cerr << "\n|";
+    getErrStream() << "\n" << i << ":";
 
-    for (int j = 0; j < NumberOfBlocks; j++)
+    for (int j = 0; j < m_context->edgeIndex.getNumPredEdges(i); j++)
     {
-      if (edgeMatrix[i][j])
-      {
-        std::cerr << " " << std::setw(3)
-          << edgeMatrix[i][j]->sourceBlock->getBlockID() << "->"
-          << std::setw(3) <<edgeMatrix[i][j]->destBlock->getBlockID();
-      }
-      else
-      {
-        std::cerr << " " << std::setw(3)
-          << "xx" << "->" << std::setw(3) << "xx";
-      }
-    }
+      edgeStruct* edge = m_context->edgeIndex.getPredEdge(i, j);
 
-    std::cerr <<"|";
-  }
-  
-  
-  // creating the block_traversal_list
-  for (int i = 0; i < NumberOfBlocks; i++)
-  {
-    blocksToVisit[i] = WHITE;
+      getErrStream() << " " << edge->sourceBlock->getBlockID() << "->"
+        << edge->destBlock->getBlockID();
+    }
   }
 
-  getList(cfg_entry_block, blocksToVisit);
 
-  //removeUnreachableBlocks(my_cfg);
-  tarzanAlgo();
+  findReachableBlocks(my_cfg);
+  buildLoopForest(my_cfg);
   printLoops();
 
+  // creating the block_traversal_list from the weak topological order,
+  // blocks not reachable from entry block are left out
+  m_context->wto.build(m_context->loopForest, m_context->edgeIndex,
+    m_context->reachableBlocks);
+
+  getOutStream() << "\nWeak topological order:";
+  m_context->wto.print();
+  getOutStream() << "\n\n";
+
+  m_context->blockList.clear();
+
+  for (int i = 0; i < m_context->wto.getElements().size(); i++)
+  {
+    m_context->blockList.push_back(m_context->wto.getElements()[i].block);
+  }
+
 /*
   // displaying the block_traversal_list
-  std::cout << "\nBlock traversal list\n";
+  getOutStream() << "\nBlock traversal list\n";
 
-  for (int i = 0; i < blockList.size(); i++)
+  for (int i = 0; i < m_context->blockList.size(); i++)
   {
-    clang::CFGBlock* block = blockList[i];
-    std::cout << block->getBlockID() << " ";
+    clang::CFGBlock* block = m_context->blockList[i];
+    getOutStream() << block->getBlockID() << " ";
   }
 
-  std::cout << "\n\n";
+  getOutStream() << "\n\n";
 */
 }
 
-/// \brief Remove Unreachable Blocks from traversal List
-void MyASTVisitor::removeUnreachableBlocks(MyCFG my_cfg)
+/// \brief Find blocks reachable from entry block with one forward DFS
+void MyASTVisitor::findReachableBlocks(MyCFG my_cfg)
 {
-  bool isReachableFromEntryBlock = false;
-  clang::CFGBlock * cfg_entry_block;
-  std::vector<clang::CFGBlock *> tempList;
+  unsigned NumberOfBlocks = my_cfg.cfg->getNumBlockIDs();
+  clang::CFGBlock* cfg_entry_block = *(my_cfg.cfg->rbegin());
+
+  std::vector<bool>& reachableBlocks = m_context->reachableBlocks;
+  reachableBlocks.assign(NumberOfBlocks, false);
 
-  clang::CFGReverseBlockReachabilityAnalysis blockReahabilityCheck(*(my_cfg.cfg));
-  cfg_entry_block = *(my_cfg.cfg->rbegin());
+  std::vector<unsigned> stack;
+  stack.push_back(cfg_entry_block->getBlockID());
+  reachableBlocks[cfg_entry_block->getBlockID()] = true;
 
-  tempList.push_back(blockList[0]);
+  int numReachable = 1;
 
-  for (int i = 1; i < blockList.size(); i++)
+  while (!stack.empty())
   {
-    isReachableFromEntryBlock = blockReahabilityCheck.isReachable(
-      cfg_entry_block, blockList[i]);
+    unsigned id = stack.back();
+    stack.pop_back();
 
-    if (isReachableFromEntryBlock)
+    for (int j = 0; j < m_context->edgeIndex.getNumSuccEdges(id); j++)
     {
-      tempList.push_back(blockList[i]);
+      unsigned succId =
+        m_context->edgeIndex.getSuccEdge(id, j)->destBlock->getBlockID();
+
+      if (!reachableBlocks[succId])
+      {
+        reachableBlocks[succId] = true;
+        stack.push_back(succId);
+        numReachable++;
+      }
     }
   }
 
-  blockList = tempList;
+  getErrStream() << "\n\nUnreachable blocks removed: ";
+  getErrStream() << NumberOfBlocks - numReachable << "\n";
 }
 
 /// \brief Return edge structure given source and destination blocks
 edgeStruct* MyASTVisitor::getEdge(clang::CFGBlock* sourceBlock,
   clang::CFGBlock* destBlock)
 {
-  edgeStruct * myEdgeStruct;
-  myEdgeStruct = edgeMatrix[sourceBlock->getBlockID()][destBlock->getBlockID()];
-
-  if (myEdgeStruct != NULL)
-    return myEdgeStruct;
-  else
-    return NULL;
+  return m_context->edgeIndex.findEdge(sourceBlock->getBlockID(),
+    destBlock->getBlockID());
 }
 
 /// \brief Mark an edge visited based on given in indices in blockList
@@ -1047,132 +1501,80 @@ void MyASTVisitor::markVisited(clang::CFGBlock* thisBlock,
 {
    edgeStruct* myEdgeStruct;
 
-  myEdgeStruct = edgeMatrix[thisBlock->getBlockID()][nextBlock->getBlockID()];
+  myEdgeStruct = getEdge(thisBlock, nextBlock);
 
   // update flags for marked edge
   myEdgeStruct->hasBeenVisited = true;
 }
 
-/// \brief Get blockList - list of blocks to be visited in order
-void MyASTVisitor::getList(clang::CFGBlock* cfg_block, int* blocksToVisit)
+/// \brief Does a depth first search top-down to detect the back edges
+void MyASTVisitor::findBackEdges(clang::CFGBlock* cfg_block, int* blocksToVisit)
 {
-  clang::CFGBlock::pred_iterator pred_it;
-  clang::CFGBlock::succ_iterator succ_it;
+  if (blocksToVisit[cfg_block->getBlockID()] != WHITE)
+  {
+    return;
+  }
 
-  if (blocksToVisit[cfg_block->getBlockID()] != BLACK)
+  // DFS stack of blocks with index of next successor to follow
+  std::vector<std::pair<clang::CFGBlock *, unsigned> > frames;
+
+  // color this block GRAY as we call get list on its successors
+  blocksToVisit[cfg_block->getBlockID()] = GRAY;
+  frames.push_back(std::make_pair(cfg_block, 0u));
+
+  while (!frames.empty())
   {
-    if (blocksToVisit[cfg_block->getBlockID()] != RED)
-    {
-      for (pred_it  = cfg_block->pred_begin();
-           pred_it != cfg_block->pred_end();
-           pred_it++)
-      {
-        clang::CFGBlock * pred_block = *(pred_it);
+    clang::CFGBlock* block = frames.back().first;
+    unsigned next = frames.back().second;
 
-        if (!isPresentInBackEdgeList(pred_block, cfg_block))
-        {
-          if ((blocksToVisit[pred_block->getBlockID()] != RED) &&
-              (blocksToVisit[pred_block->getBlockID()] != BLACK))
-          {
-            getList(pred_block, blocksToVisit);
-            //std::cout << "\nReturn from block " << cfg_block->getBlockID();
-            //std::cout << " since its pred " << pred_block->getBlockID();
-            //std::cout << " is not visited.";
-            //return;
-          }
-        }
-      }
+    if (next == block->succ_size())
+    {
+      // color this block BLACK as all successors have been considered.
+      blocksToVisit[block->getBlockID()] = BLACK;
+      frames.pop_back();
+      continue;
     }
 
-    if ((blocksToVisit[cfg_block->getBlockID()] != RED) &&
-        (blocksToVisit[cfg_block->getBlockID()] != BLACK))
+    frames.back().second++;
+
+    clang::CFGBlock* succ_block = *(block->succ_begin() + next);
+
+    // handle cases where the successor is NULL
+    if (succ_block == NULL)
     {
-      blockList.push_back(cfg_block);
-      blocksToVisit[cfg_block->getBlockID()] = RED;
+      continue;
     }
 
-    for (succ_it  = cfg_block->succ_begin();
-         succ_it != cfg_block->succ_end();
-         succ_it++)
+    if (blocksToVisit[succ_block->getBlockID()] == GRAY)
     {
-      clang::CFGBlock* succ_block = *succ_it;
-      if(succ_block != NULL)
-      {
-        if ((blocksToVisit[succ_block->getBlockID()] != RED) &&
-            (blocksToVisit[succ_block->getBlockID()] != BLACK))
-        {
-          getList(succ_block, blocksToVisit);
-        }
-      }
+      // successor is still on the stack, all its successors have not been
+      // taken into consideration
+      createBackEdge(block, succ_block);
+    }
+    else
+    if (blocksToVisit[succ_block->getBlockID()] != BLACK)
+    {
+      blocksToVisit[succ_block->getBlockID()] = GRAY;
+      frames.push_back(std::make_pair(succ_block, 0u));
     }
-
-    blocksToVisit[cfg_block->getBlockID()] = BLACK;
   }
 }
 
-/// \brief Does a depth first search top-down to detect the back edges
-void MyASTVisitor::findBackEdges(clang::CFGBlock* cfg_block, int* blocksToVisit)
+/// \brief Creates edges between two connected nodes in the cfg
+/// in the forward direction
+void MyASTVisitor::createEdges(clang::CFGBlock* source, clang::CFGBlock* dest)
 {
-  if (blocksToVisit[cfg_block->getBlockID()] == BLACK)
-  {
-    return;
-  }
-  else
-  if (blocksToVisit[cfg_block->getBlockID()] == GRAY)
-  {
-    // all successors have not been taken into consideration
-    createBackEdge(currentSourceBlock, currentDestBlock);
-    return;
-  }
-
-  // color this block GRAY as we call get list on its successors
-  blocksToVisit[cfg_block->getBlockID()] = GRAY;
-
-  clang::CFGBlock::pred_iterator pred_it;
-  clang::CFGBlock::succ_iterator succ_it;
-
-  for (succ_it  = cfg_block->succ_begin();
-       succ_it != cfg_block->succ_end();
-       succ_it++)
-  {
-    // call findBackEdges() for every successor
-
-    clang::CFGBlock* succ_block = *succ_it;
-
-    // handle cases where the successor is NULL
-    if (succ_block != NULL)
-    {
-      currentSourceBlock = cfg_block;
-      currentDestBlock = succ_block;
-
-      findBackEdges(succ_block, blocksToVisit);
-    }
-  }
-
-  // color this block BLACK as all successors have been considered.
-  currentSourceBlock = cfg_block;
-  blocksToVisit[cfg_block->getBlockID()] = BLACK;
-}
-
-/// \brief Creates edges between two connected nodes in the cfg
-/// in the forward direction
-void MyASTVisitor::createEdges(clang::CFGBlock* source, clang::CFGBlock* dest)
-{
-  if ((dest != NULL) && (source != NULL))
+  if ((dest != NULL) && (source != NULL))
   {
     edgeStruct * myEdgeStruct = (edgeStruct *) new edgeStruct;
     myEdgeStruct->sourceBlock = source;
     myEdgeStruct->destBlock = dest;
-    myEdgeStruct->hasBeenAddedWhile = false;
     myEdgeStruct->isABackEdge = false;
     myEdgeStruct->hasBeenVisited = false;
-    myEdgeStruct->timesVisited = 0;
     myEdgeStruct->edgeColor = WHITE;
 
-    myEdgeStructList.push_back(myEdgeStruct);
-
-    edgeMatrix[source->getBlockID()][dest->getBlockID()] = myEdgeStruct;
-    adjacencyMatrix[source->getBlockID()][dest->getBlockID()] = 1;
+    // indexed by m_context->edgeIndex once all edges are created
+    m_context->myEdgeStructList.push_back(myEdgeStruct);
   }
 }
 
@@ -1182,37 +1584,28 @@ void MyASTVisitor::createBackEdge(clang::CFGBlock* source,
   clang::CFGBlock* dest)
 {
    edgeStruct * myEdgeStruct;
-  myEdgeStruct = edgeMatrix[source->getBlockID()][dest->getBlockID()];
-  myEdgeStruct->isABackEdge = true;
+  myEdgeStruct = getEdge(source, dest);
+  m_context->edgeIndex.markBackEdge(myEdgeStruct);
   myEdgeStruct->edgeColor = BLACK;
-
-  t_loopStruct * myLoop;
-  myLoop = (t_loopStruct *) new (t_loopStruct);
-  myLoop->loopStart = dest;
-  myLoop->loopEnd = source;
-  myLoop->loop_done = false;
-
-  loopStructList.push_back(myLoop);
 }
 
 /// \brief Displays all edges in forward direction in no particular order
 void MyASTVisitor::displayEdges()
 {
-   int numBlocks;
-  numBlocks = edgeMatrix.size();
+  int numBlocks;
+  numBlocks = m_context->edgeIndex.getNumBlocks();
 
   for (int i = 0; i < numBlocks; i++)
   {
-    for (int j = 0; j < numBlocks; j++)
+    for (int j = 0; j < m_context->edgeIndex.getNumSuccEdges(i); j++)
     {
-      if (edgeMatrix[i][j] != NULL)
-      {
-        std::cerr << " " << edgeMatrix[i][j]->sourceBlock->getBlockID()
-          << " " << edgeMatrix[i][j]->destBlock->getBlockID();
-      }
+      edgeStruct* edge = m_context->edgeIndex.getSuccEdge(i, j);
+
+      getErrStream() << " " << edge->sourceBlock->getBlockID()
+        << " " << edge->destBlock->getBlockID();
     }
 
-    std::cerr << "\n";
+    getErrStream() << "\n";
   }
 }
 
@@ -1221,38 +1614,25 @@ void MyASTVisitor::displayEdges()
 void MyASTVisitor::displayBackEdges()
 {
   int numBlocks;
-  numBlocks = edgeMatrix.size();
+  numBlocks = m_context->edgeIndex.getNumBlocks();
 
   for (int i = 0; i < numBlocks; i++)
   {
-    for (int j = 0; j < numBlocks; j++)
+    for (int j = 0; j < m_context->edgeIndex.getNumSuccEdges(i); j++)
     {
-      if (edgeMatrix[i][j] != NULL)
+      edgeStruct* edge = m_context->edgeIndex.getSuccEdge(i, j);
+
+      if (edge->isABackEdge)
       {
-	if (edgeMatrix[i][j]->isABackEdge)
-	{
-          std::cerr << " " << edgeMatrix[i][j]->sourceBlock->getBlockID()
-            << " " << edgeMatrix[i][j]->destBlock->getBlockID();
-	}
+        getErrStream() << " " << edge->sourceBlock->getBlockID()
+          << " " << edge->destBlock->getBlockID();
       }
     }
 
-    std::cerr << "\n";
+    getErrStream() << "\n";
   }
 }
 
-/// \brief Find if this edge is present in the list of back edges
-bool MyASTVisitor::isPresentInBackEdgeList(clang::CFGBlock * sourceBlock,
-  clang::CFGBlock * destBlock)
-{
-   if (edgeMatrix[sourceBlock->getBlockID()][destBlock->getBlockID()] != NULL)
-  {
-    return (edgeMatrix[sourceBlock->getBlockID()][destBlock->getBlockID()]->isABackEdge);
-  }
-
-  return false;
-}
-
 /// \brief Get number of predecessors
 int MyASTVisitor::getNumPredecessors(clang::CFGBlock* block)
 {
@@ -1319,14 +1699,14 @@ MyASTVisitor::getSuccessors(clang::CFGBlock* block)
     succList.push_back(currSucc);
   }
 
-  std::cerr << "\n  predecessor's successor list\n";
+  getErrStream() << "\n  predecessor's successor list\n";
 
   for (int i = 0; i < succList.size(); i++)
   {
     clang::CFGBlock* blk = succList[i];
-    std::cerr << " " << blk->getBlockID();
+    getErrStream() << " " << blk->getBlockID();
   }
-  std::cerr << "\n";
+  getErrStream() << "\n";
 
   return succList;
 }
@@ -1335,25 +1715,29 @@ MyASTVisitor::getSuccessors(clang::CFGBlock* block)
 void MyASTVisitor::addSuccOfPredInfo(clang::CFGBlock* cfg_block,
   clang::CFGBlock* pred_block)
 {
-  // create a t_MySuccOfPredInfo
-  MySuccOfPredInfo* t_MySuccOfPredInfo;
-  t_MySuccOfPredInfo = new MySuccOfPredInfo;
+  // create a t_MySuccOfPredInfo in the entries of the block
+  MySuccOfPredInfoList& succOfPredInfo =
+    m_context->SuccOfPredInfo[cfg_block->getBlockID()];
+  succOfPredInfo.push_back(MySuccOfPredInfo());
+  MySuccOfPredInfo* t_MySuccOfPredInfo = &succOfPredInfo.back();
 
   t_MySuccOfPredInfo->cfgBlock = cfg_block;
   t_MySuccOfPredInfo->predBlock = pred_block;
   t_MySuccOfPredInfo->numSuccOfPred = getNumSuccessors(pred_block);
   t_MySuccOfPredInfo->succOfPredList = getSuccessors(pred_block);
+  t_MySuccOfPredInfo->pointerToEdge = NULL;
   edgeStruct * myEdgeStruct;
 
-  if (edgeMatrix[pred_block->getBlockID()][cfg_block->getBlockID()] != NULL)
+  myEdgeStruct = getEdge(pred_block, cfg_block);
+
+  if (myEdgeStruct != NULL)
   {
-    myEdgeStruct = edgeMatrix[pred_block->getBlockID()][cfg_block->getBlockID()];
     t_MySuccOfPredInfo-> pointerToEdge = myEdgeStruct;
 
-    if ((strcmp(getTerminatorType(pred_block).c_str(), "If") == 0) ||
-        (strcmp(getTerminatorType(pred_block).c_str(), "While") == 0) ||
-        (strcmp(getTerminatorType(pred_block).c_str(), "DoWhile") == 0) ||
-        (strcmp(getTerminatorType(pred_block).c_str(), "For") == 0))
+    TerminatorKind predKind =
+      m_context->myCFGInfoList[pred_block->getBlockID()].terminatorKind;
+
+    if (isConditionTerminator(predKind))
     {
       if (cfg_block == t_MySuccOfPredInfo->succOfPredList[0])
       {
@@ -1368,71 +1752,49 @@ void MyASTVisitor::addSuccOfPredInfo(clang::CFGBlock* cfg_block,
       }
     }
   }
-
-  // check head of MySuccOfPredInfo
-  if (!SuccOfPredInfo)
-  {
-    // empty MySuccOfPredInfo, add first entry
-    t_MySuccOfPredInfo->next = SuccOfPredInfo;
-
-    SuccOfPredInfo = t_MySuccOfPredInfo;
-  }
-  else
-  {
-    // add one more entry in MySuccOfPredInfo at the end
-    t_MySuccOfPredInfo->next = NULL;
-
-    MySuccOfPredInfo* l = SuccOfPredInfo;
-
-    while (l->next)
-    {
-      l = l->next;
-    }
-
-    l->next = t_MySuccOfPredInfo;
-  }
-
 }
 
-/// \brief Show successors of predecessors
-void MyASTVisitor::showSuccOfPredInfo()
+/// \brief Show successors of predecessors of a basic block
+void MyASTVisitor::showSuccOfPredInfo(clang::CFGBlock* cfg_block)
 {
-  if (!SuccOfPredInfo)
+  const MySuccOfPredInfoList& succOfPredInfo =
+    m_context->SuccOfPredInfo[cfg_block->getBlockID()];
+
+  if (succOfPredInfo.empty())
   {
-    std::cerr << "\n  Empty SuccOfPredInfo!\n";
+    getErrStream() << "\n  Empty SuccOfPredInfo!\n";
   }
   else
   {
-    MySuccOfPredInfo* t_MySuccOfPredInfo;
-    t_MySuccOfPredInfo = SuccOfPredInfo;
-
-    std::cerr << "\ncfgBlock \tpredBlock numSuccOfPred Edge EdgeColor ";
-    std::cerr << "succOfPredList\n";
-    std::cerr << "------------------------------------------------------------\n";
+    getErrStream() << "\ncfgBlock \tpredBlock numSuccOfPred Edge EdgeColor ";
+    getErrStream() << "succOfPredList\n";
+    getErrStream()
+      << "------------------------------------------------------------\n";
 
-    do
+    for (int j = 0; j < succOfPredInfo.size(); j++)
     {
-      std::cerr << t_MySuccOfPredInfo->cfgBlock->getBlockID() << " \t\t";
-      std::cerr << t_MySuccOfPredInfo->predBlock->getBlockID() << " \t\t";
-      std::cerr << t_MySuccOfPredInfo->numSuccOfPred << " \t";
-      std::cerr << t_MySuccOfPredInfo->pointerToEdge->sourceBlock->getBlockID();
-      std::cerr << "->";
-      std::cerr << t_MySuccOfPredInfo->pointerToEdge->destBlock->getBlockID();
-      std::cerr << " \t";
-      std::cerr << t_MySuccOfPredInfo->pointerToEdge->edgeColor << "\t";
+      const MySuccOfPredInfo* t_MySuccOfPredInfo = &succOfPredInfo[j];
+
+      getErrStream() << t_MySuccOfPredInfo->cfgBlock->getBlockID() << " \t\t";
+      getErrStream() << t_MySuccOfPredInfo->predBlock->getBlockID() << " \t\t";
+      getErrStream() << t_MySuccOfPredInfo->numSuccOfPred << " \t";
+      getErrStream()
+        << t_MySuccOfPredInfo->pointerToEdge->sourceBlock->getBlockID();
+      getErrStream() << "->";
+      getErrStream()
+        << t_MySuccOfPredInfo->pointerToEdge->destBlock->getBlockID();
+      getErrStream() << " \t";
+      getErrStream() << t_MySuccOfPredInfo->pointerToEdge->edgeColor << "\t";
 
       for (int i = 0; i < t_MySuccOfPredInfo->succOfPredList.size(); i++)
       {
         clang::CFGBlock* currentBlock = t_MySuccOfPredInfo->succOfPredList[i];
-        std::cerr << currentBlock->getBlockID() << ", ";
+        getErrStream() << currentBlock->getBlockID() << ", ";
       }
-      std::cerr << "END\n";
-
-      t_MySuccOfPredInfo = t_MySuccOfPredInfo->next;
+      getErrStream() << "END\n";
     }
-    while (t_MySuccOfPredInfo);
 
-    std::cerr << "\n";
+    getErrStream() << "\n";
   }
 }
 
@@ -1447,7 +1809,7 @@ bool MyASTVisitor::isUniqueSuccessor(clang::CFGBlock* cfg_block)
   int numSuccOfPred = 0;
   bool isUniqueSucc = false;
 
-  std::cerr << "\n  predecessor list: \n";
+  getErrStream() << "\n  predecessor list: \n";
 
   for (pred_it  = cfg_block->pred_begin();
        pred_it != cfg_block->pred_end();
@@ -1458,503 +1820,124 @@ bool MyASTVisitor::isUniqueSuccessor(clang::CFGBlock* cfg_block)
     if (pred_block)
     {
       numPredecessors++;
-      std::cerr << pred_block->getBlockID() << "  ";
+      getErrStream() << pred_block->getBlockID() << "  ";
 
       // get successors of predecessor block
       for (succOfPred_it  = pred_block->succ_begin();
            succOfPred_it != pred_block->succ_end();
            succOfPred_it++)
-      {
-        clang::CFGBlock* succOfPred_block = *succOfPred_it;
-
-        if (succOfPred_block)
-        {
-          numSuccOfPred++;
-          //store numSuccOfPred->getBlockID()
-        }
-
-      } // for succOfPred_it ends
-
-    } // if pred_block ends
-
-  } // for pred_it ends
-
-  if ((numPredecessors == 1) && (numSuccOfPred == 1))
-  {
-    isUniqueSucc = true;
-  }
-
-  std::cerr << "\n  Block " << cfg_block->getBlockID() << " has ";
-  std::cerr << numPredecessors << " predecessors\n";
-
-  return isUniqueSucc;
-}
-
-/// \brief Get a row of structure MyCFGInfo
-MyCFGInfo* MyASTVisitor::getRowOfMyCFGInfo(clang::CFGBlock* block)
-{
-  MyCFGInfoList::iterator it;
-  MyCFGInfo* t_MyCFGInfo = NULL;
-
-  for (it  = myCFGInfoList.begin();
-       it != myCFGInfoList.end();
-       it++)
-  {
-    t_MyCFGInfo = *it;
-
-    if (t_MyCFGInfo->cfg_block == block)
-    {
-      return t_MyCFGInfo;
-    }
-  }
-
-  return NULL;
-}
-
-/// \brief Find if this block is first successor of its predecessor -
-/// return true for first successor, false otherwise
-bool MyASTVisitor::isFirstSuccOfPred(clang::CFGBlock* cfg_block)
-{
-  std::vector<clang::CFGBlock *> t_succOfPredList;
-  bool isFirstSucc = false;
-
-  while (SuccOfPredInfo)
-  {
-    // if this block is found in SuccOfPredList
-    if (SuccOfPredInfo->cfgBlock == cfg_block)
-    {
-      std::cerr << "\n  this block " << cfg_block->getBlockID();
-      std::cerr << " found in SuccOfPredList \n";
-
-      // get successor list of its predecessor
-      t_succOfPredList = SuccOfPredInfo->succOfPredList;
-
-      // is this block first succ
-      if (cfg_block == t_succOfPredList[0])
-      {
-        isFirstSucc = true;
-      }
-      else
-      if (cfg_block == t_succOfPredList[1])
-      {
-        isFirstSucc = false;
-      }
-
-      break;
-    }
-
-    SuccOfPredInfo = SuccOfPredInfo->next;
-  }
-
-  return isFirstSucc;
-}
-
-/// \brief In case of for loops and while loops, we add the loop head
-/// at the end of the loop tail in the traversal list
-void MyASTVisitor::processListWhileFor(clang::CFGBlock * cfg_block)
-{
-  clang::CFGBlock * source;
-  edgeStruct * currentEdge;
-  edgeStruct * myEdgeStruct;
-  int count = 0;
-
-  int numBlocks;
-  numBlocks = edgeMatrix.size();
-
-  for (int i = 0; i < numBlocks; i++)
-  {
-    if (edgeMatrix[i][cfg_block->getBlockID()] != NULL)
-    {
-      myEdgeStruct = edgeMatrix[i][cfg_block->getBlockID()];
-
-      if (myEdgeStruct->isABackEdge == true)
-      {
-        source = myEdgeStruct->sourceBlock;
-        currentEdge = myEdgeStruct;
-        break;
-      }
-    }
-  }
-
-
-  if (currentEdge->hasBeenAddedWhile == false)
-  {
-    for (int i = 0; i < blockList.size(); i++)
-    {
-      if (blockList[i] == source)
-      {
-        count = i;
-        break;
-      }
-    }
-
-    std::vector<clang::CFGBlock *> tempList;
-
-    for (int i = 0; i <= count; i++)
-    {
-      tempList.push_back(blockList[i]);
-    }
-
-    tempList.push_back(cfg_block);
-
-    for (int i = count + 1; i < blockList.size(); i++)
-    {
-      tempList.push_back(blockList[i]);
-    }
-
-    blockList = tempList;
-    currentEdge->hasBeenAddedWhile = true;
-  }
-}
-
-/// \brief In case of Dowhile loops, we add the loop head to
-/// the block before loop tail at the end of the loop tail
-/// in the traversal list
-void MyASTVisitor::processListDoWhile(clang::CFGBlock * cfg_block)
-{
-  clang::CFGBlock * source;
-  clang::CFGBlock * dest;
-  dest = cfg_block;
-
-  clang::CFGBlock::succ_iterator succ_it;
-  succ_it = cfg_block->succ_begin();
-  source = *(succ_it);
-
-  bool found = false;
-  edgeStruct * currentEdge = NULL;
-  edgeStruct * myEdgeStruct = NULL;
-  int s_count = 0, d_count =0;
-
-  int numBlocks;
-  numBlocks = edgeMatrix.size();
-
-  for (int i = 0; i < numBlocks; i++)
-  {
-    if (edgeMatrix[source->getBlockID()][i] != NULL)
-    {
-      myEdgeStruct = edgeMatrix[source->getBlockID()][i];
-
-      if (myEdgeStruct->isABackEdge == true)
-      {
-        dest = myEdgeStruct->destBlock;
-        currentEdge = myEdgeStruct;
-	found = true;
-        break;
-      }
-    }
-  }
-
-  if (found && !currentEdge->hasBeenAddedWhile)
-  {
-    for (int i = 0; i < blockList.size(); i++)
-    {
-      if (blockList[i] == source)
-      {
-        s_count = i;
-        break;
-      }
-    }
-
-    for (int i = 0; i < blockList.size(); i++)
-    {
-      if (blockList[i] == dest)
-      {
-        d_count = i;
-        break;
-      }
-    }
-
-    std::vector<clang::CFGBlock *> tempList;
-
-    for (int i = 0; i <= s_count; i++)
-    {
-      tempList.push_back(blockList[i]);
-    }
-
-    for(int i = d_count; i<s_count; i++)
-    {
-      tempList.push_back(blockList[i]);
-    }
-
-    for (int i = s_count + 1; i < blockList.size(); i++)
-    {
-      tempList.push_back(blockList[i]);
-    }
-
-    blockList = tempList;
-    currentEdge->hasBeenAddedWhile = true;
-  }
-}
-
-/// \brief When widening needs to be done, the pointer of the blocklist
-/// is shifted back to the loop head. Should be called from the source
-/// of a back edge
-int MyASTVisitor::modifyListWiden(clang::CFGBlock * cfg_block, int original)
-{
-   int count = 0;
-  clang::CFGBlock * dest;
-  edgeStruct * currentEdge;
-  edgeStruct * myEdgeStruct;
-
-  int numBlocks;
-  numBlocks = edgeMatrix.size();
-
-  for (int i = 0; i < numBlocks; i++)
-  {
-    if (edgeMatrix[cfg_block->getBlockID()][i] != NULL)
-    {
-      myEdgeStruct = edgeMatrix[cfg_block->getBlockID()][i];
-
-      if (myEdgeStruct->isABackEdge == true)
-      {
-        currentEdge = myEdgeStruct;
-        currentEdge->timesVisited++;
-        break;
-      }
-    }
-  }
-
-  if (currentEdge->isABackEdge == true)
-  {
-    for (int k = 0; k < blockList.size(); k++)
-    {
-      if (blockList[k] == currentEdge->destBlock)
-      {
-        return (k-1);
-      }
-    }
-  }
-
-  return original;
-}
-
-/// \brief Find if this block is the source of a back edge
-edgeStruct* MyASTVisitor::isASourceOfBackEdge(clang::CFGBlock * cfg_block)
-{
- edgeStruct * myEdgeStruct;
-  int numBlocks = edgeMatrix.size();
-
-  for (int i = 0; i < numBlocks; i++)
-  {
-    if (edgeMatrix[cfg_block->getBlockID()][i] != NULL)
-    {
-      myEdgeStruct = edgeMatrix[cfg_block->getBlockID()][i];
-
-      if (myEdgeStruct->isABackEdge)
-      {
-        return myEdgeStruct;
-      }
-    }
-  }
-
-  return NULL;
-}
-
-/// \brief Find if this block is the destination of a back edge
-edgeStruct* MyASTVisitor::isADestOfBackEdge(clang::CFGBlock * cfg_block)
-{
-  edgeStruct * myEdgeStruct;
-  int numBlocks = edgeMatrix.size();
-
-  for (int i = 0; i < numBlocks; i++)
-  {
-    if (edgeMatrix[i][cfg_block->getBlockID()] != NULL)
-    {
-      myEdgeStruct = edgeMatrix[i][cfg_block->getBlockID()];
-
-      if (myEdgeStruct->isABackEdge)
-      {
-        return myEdgeStruct;
-      }
-    }
-  }
-
-  return NULL;
-}
-
-/// \brief See if this is first visit to block leading to back edge
-bool MyASTVisitor::isFirstTime(clang::CFGBlock* cfg_block)
-{
-  edgeStruct * myEdgeStruct;
-  int numBlocks = edgeMatrix.size();
-
-  for (int i = 0; i < numBlocks; i++)
-  {
-    if (edgeMatrix[cfg_block->getBlockID()][i] != NULL)
-    {
-      myEdgeStruct = edgeMatrix[cfg_block->getBlockID()][i];
-
-      if (myEdgeStruct->isABackEdge)
-      {
-         if (myEdgeStruct->timesVisited == 0)
-          return true;
-      }
-    }
-  }
-
-  return false;
-}
-
-/// \brief Reset timesVisited counter for back edge if fix point is reached
-void MyASTVisitor::resetTimesVisited(clang::CFGBlock* cfg_block)
-{
-   edgeStruct * myEdgeStruct;
-  int numBlocks = edgeMatrix.size();
-
-  for (int i = 0; i < numBlocks; i++)
-  {
-    if (edgeMatrix[cfg_block->getBlockID()][i] != NULL)
-    {
-      myEdgeStruct = edgeMatrix[cfg_block->getBlockID()][i];
-
-      if (myEdgeStruct->isABackEdge)
-      {
-        myEdgeStruct->timesVisited = 0;
-      }
-    }
-  }
-}
-
-/// \brief Return loopExitAbsValOld for given cfg_block
-ap_abstract1_t MyASTVisitor::getLoopExitAbsValOld(clang::CFGBlock* cfg_block)
-{
-  MyCFGInfoList::iterator it;
-  MyCFGInfo* t_MyCFGInfo;
-  ap_abstract1_t loopExitAbsValOld;
-
-  for (it  = myCFGInfoList.begin();
-       it != myCFGInfoList.end();
-       it++)
-  {
-    t_MyCFGInfo = *it;
-
-    if (t_MyCFGInfo->cfg_block == cfg_block)
-    {
-      std::cerr << "\n  cfg_block = " << cfg_block->getBlockID();
-      loopExitAbsValOld = t_MyCFGInfo->loopExitAbsValOld;
-      break;
-    }
-  }
+      {
+        clang::CFGBlock* succOfPred_block = *succOfPred_it;
 
-  return loopExitAbsValOld;
-}
+        if (succOfPred_block)
+        {
+          numSuccOfPred++;
+          //store numSuccOfPred->getBlockID()
+        }
 
-/// \brief Use Tarzan's Algorithm to find SCC in the CFG
-void MyASTVisitor::tarzanAlgo()
-{
-  // myEdgeStructList : Edge Struct List
-  // blockList : List of Vertices
-  // numBlocks : Number of Blocks
-  // Each vertex has associated index and lowlink.
-  // S : Stack, implemented as vector.
+      } // for succOfPred_it ends
 
-  indexcount = 0;
+    } // if pred_block ends
 
-  int numBlocks;
-  numBlocks = blockList.size();
+  } // for pred_it ends
 
-  // initialize everything to undefined : -100
-  for (int i = 0; i < blockList.size(); i++)
+  if ((numPredecessors == 1) && (numSuccOfPred == 1))
   {
-      myindex.push_back(-100);
-      lowlink.push_back(-100);
+    isUniqueSucc = true;
   }
 
-  // iterating over all vertices
-  for (int i = 0; i < blockList.size(); i++)
-  {
-    clang::CFGBlock* cfg_block;
-    cfg_block = blockList[i];
+  getErrStream() << "\n  Block " << cfg_block->getBlockID() << " has ";
+  getErrStream() << numPredecessors << " predecessors\n";
 
-    if (myindex[cfg_block->getBlockID()] == -100)
-    {
-      stronglyConnect(cfg_block);
-    }
-  }
+  return isUniqueSucc;
 }
 
-/// \brief Support member for Tajan's Algorithm
-void MyASTVisitor::stronglyConnect(clang::CFGBlock* cfg_block)
+/// \brief Get a row of structure MyCFGInfo
+MyCFGInfo* MyASTVisitor::getRowOfMyCFGInfo(clang::CFGBlock* block)
 {
-  myindex[cfg_block->getBlockID()] = indexcount;
-  lowlink[cfg_block->getBlockID()] = indexcount;
-  indexcount = indexcount + 1;
-  S.push_back(cfg_block);
+  MyCFGInfo* t_MyCFGInfo = &(m_context->myCFGInfoList[block->getBlockID()]);
 
-  edgeStructList::iterator edge_it;
-  edgeStruct * myEdgeStruct;
-  clang::CFGBlock * destBlock;
+  return t_MyCFGInfo->isAnalyzed ? t_MyCFGInfo : NULL;
+}
+
+/// \brief Find if this block is first successor of its predecessor -
+/// return true for first successor, false otherwise
+bool MyASTVisitor::isFirstSuccOfPred(clang::CFGBlock* cfg_block)
+{
+  std::vector<clang::CFGBlock *> t_succOfPredList;
+  bool isFirstSucc = false;
+
+  // entries of this block, added when it was visited
+  const MySuccOfPredInfoList& succOfPredInfo =
+    m_context->SuccOfPredInfo[cfg_block->getBlockID()];
 
-  for (edge_it  = myEdgeStructList.begin();
-       edge_it != myEdgeStructList.end();
-       edge_it++)
+  for (int j = 0; j < succOfPredInfo.size(); j++)
   {
-    myEdgeStruct = *(edge_it);
+    const MySuccOfPredInfo* t_MySuccOfPredInfo = &succOfPredInfo[j];
 
-    if (myEdgeStruct->sourceBlock == cfg_block)
+    // if this block is found in SuccOfPredList
+    if (t_MySuccOfPredInfo->cfgBlock == cfg_block)
     {
-      destBlock = myEdgeStruct->destBlock;
+      getErrStream() << "\n  this block " << cfg_block->getBlockID();
+      getErrStream() << " found in SuccOfPredList \n";
+
+      // get successor list of its predecessor
+      t_succOfPredList = t_MySuccOfPredInfo->succOfPredList;
 
-      if (myindex[destBlock->getBlockID()] == -100)
+      // is this block first succ
+      if (cfg_block == t_succOfPredList[0])
       {
-        stronglyConnect(destBlock);
-        lowlink[cfg_block->getBlockID()] =
-          (lowlink[cfg_block->getBlockID()] > lowlink[destBlock->getBlockID()])
-           ? lowlink[destBlock->getBlockID()]:lowlink[cfg_block->getBlockID()];
+        isFirstSucc = true;
       }
-      else if(isPresentinS(destBlock))
+      else
+      if (cfg_block == t_succOfPredList[1])
       {
-        lowlink[cfg_block->getBlockID()] =
-          (lowlink[cfg_block->getBlockID()] > myindex[destBlock->getBlockID()])
-           ? myindex[destBlock->getBlockID()]:lowlink[cfg_block->getBlockID()];
+        isFirstSucc = false;
       }
-    }
-  }
-
-  std::vector<clang::CFGBlock * > tempSCC;
-
-  if (lowlink[cfg_block->getBlockID()] == myindex[cfg_block->getBlockID()])
-  {
-    int k;
 
-    while (1)
-    {
-      k = S.size();
-      destBlock = S[k-1];
-      S.pop_back();
-      tempSCC.push_back(destBlock);
-
-      if (destBlock == cfg_block)
-        break;
+      break;
     }
+  }
 
-    std::cout <<"\nPrinting SCC \n";
+  return isFirstSucc;
+}
 
-    while (tempSCC.size() > 0)
-    {
-        std::cout << (tempSCC[tempSCC.size()-1])->getBlockID() << " ";
-        tempSCC.pop_back();
-    }
-  }
+/// \brief Find if this block is the source of a back edge
+edgeStruct* MyASTVisitor::isASourceOfBackEdge(clang::CFGBlock * cfg_block)
+{
+  return m_context->edgeIndex.getBackEdgeFrom(cfg_block->getBlockID());
 }
 
-/// \brief Support member for Tajan's Algorithm
-bool MyASTVisitor::isPresentinS(clang::CFGBlock * cfg_block)
+/// \brief Find if this block is the destination of a back edge
+edgeStruct* MyASTVisitor::isADestOfBackEdge(clang::CFGBlock * cfg_block)
 {
-  std::vector<clang::CFGBlock *>::iterator it;
-  it = std::find(S.begin(),S.end(),cfg_block);
+  return m_context->edgeIndex.getBackEdgeTo(cfg_block->getBlockID());
+}
 
-  if (it != S.end())
-      return true;
-  else
-      return false;
+/// \brief Build loop-nesting forest of the CFG
+void MyASTVisitor::buildLoopForest(MyCFG my_cfg)
+{
+  // back edges must be marked before, see findBackEdges()
+  m_context->loopForest.build(my_cfg.cfg, m_context->edgeIndex);
 }
 
 /// \brief Populate the blockStructList containing the block pointer and the
-//  block terminator type.
+//  block terminator type, and create MyCFGInfo table.
 void MyASTVisitor::createBlockList(MyCFG my_cfg)
 {
-  t_blockStructList blockStructList(my_cfg.cfg->getNumBlockIDs(),NULL);
+  unsigned NumberOfBlocks = my_cfg.cfg->getNumBlockIDs();
+  t_blockStructList blockStructList(NumberOfBlocks, NULL);
+
+  clang::CFGBlock* cfg_entry_block = *(my_cfg.cfg->rbegin());
+  clang::CFGBlock* cfg_exit_block = *(--(my_cfg.cfg->rend()));
+
+  // one row per block id, filled while analyzing
+  MyCFGInfoList& myCFGInfoList = m_context->myCFGInfoList;
+  myCFGInfoList.clear();
+  myCFGInfoList.resize(NumberOfBlocks);
+
+  m_context->SuccOfPredInfo.clear();
+  m_context->SuccOfPredInfo.resize(NumberOfBlocks);
 
   clang::CFG::iterator block_it;
   clang::CFGBlock* cfg_block;
@@ -1964,26 +1947,43 @@ void MyASTVisitor::createBlockList(MyCFG my_cfg)
        block_it++)
   {
     cfg_block = *(block_it);
+
+    // terminator type is computed once per block
+    TerminatorKind termKind = getTerminatorType(cfg_block);
+
+    MyCFGInfo& row = myCFGInfoList[cfg_block->getBlockID()];
+    row.blockid = cfg_block->getBlockID();
+    row.cfg_block = cfg_block;
+    row.terminatorKind = termKind;
+    row.isAnalyzed = false;
+    row.isLoopHead = false;
+    row.condCons = NULL;
+    row.transferProgram = NULL;
+
+    if (cfg_block == cfg_entry_block || cfg_block == cfg_exit_block)
+    {
+      row.terminatorKind = TERM_EMPTY;
+    }
+
     t_blockStruct *  blockStruct;
-    blockStruct = (t_blockStruct *) new (t_blockStruct *);
+    blockStruct = (t_blockStruct *) new (t_blockStruct);
     blockStruct->blockPtr = *(block_it);
     blockStruct->term = 0;
 
-    if ((strcmp(getTerminatorType(blockStruct->blockPtr).c_str(), "If") == 0))
+    if (termKind == TERM_IF)
       blockStruct->term = 1;
     else
-    if (strcmp(getTerminatorType(blockStruct->blockPtr).c_str(), "While") == 0)
+    if (termKind == TERM_WHILE)
       blockStruct->term = 2;
     else
-    if (strcmp(getTerminatorType(blockStruct->blockPtr).c_str(), "DoWhile") == 0)
+    if (termKind == TERM_DOWHILE)
       blockStruct->term = 3;
     else
-    if (strcmp(getTerminatorType(blockStruct->blockPtr).c_str(), "For") == 0)
+    if (termKind == TERM_FOR)
       blockStruct->term = 4;
     else
-    if (strcmp(getTerminatorType(blockStruct->blockPtr).c_str(), "Goto") == 0)
-    {    
-
+    if (termKind == TERM_GOTO)
+    {
       clang::CFGTerminator terminator = cfg_block->getTerminator();
       Stmt * stmt;
       stmt = terminator.getStmt();
@@ -1993,8 +1993,9 @@ void MyASTVisitor::createBlockList(MyCFG my_cfg)
       ld = gotostmt->getLabel();
       std::string labelName;
       labelName = ld->getNameAsString();
-      std::cout << "\nBlock " << cfg_block->getBlockID() << " has a goto stmt.";
-      std::cout << "\n\tGoto Label is : " << labelName.c_str();
+      getOutStream() << "\nBlock " << cfg_block->getBlockID()
+        << " has a goto stmt.";
+      getOutStream() << "\n\tGoto Label is : " << labelName.c_str();
 
       std::string whileLabel = ("while_break");
       int comparisonSize = whileLabel.size();
@@ -2009,418 +2010,59 @@ void MyASTVisitor::createBlockList(MyCFG my_cfg)
     blockStructList[blockStruct->blockPtr->getBlockID()] = blockStruct;
   }
 
-  globalBlockList = blockStructList;
+  m_context->globalBlockList = blockStructList;
 }
 
 /// \brief Print the block structure.
 void MyASTVisitor::printBlockStruct()
 {
-  for (int i = 0; i < globalBlockList.size(); i++)
+  for (int i = 0; i < m_context->globalBlockList.size(); i++)
   {
-    std::cout << "\nBlock Id: " << globalBlockList[i]->blockPtr->getBlockID();
-    std::cout << "\tTerm Type: " << globalBlockList[i]->term;
+    getOutStream() << "\nBlock Id: "
+      << m_context->globalBlockList[i]->blockPtr->getBlockID();
+    getOutStream() << "\tTerm Type: " << m_context->globalBlockList[i]->term;
   }
 }
 
-/// \brief Print the loops encountered in the CFG
+/// \brief Print the loop-nesting forest of the CFG
 void MyASTVisitor::printLoops()
 {
-  std::cout << "\n\nPrint Loop Lists";
-
-  for (int i = 0; i < loopStructList.size(); i++)
-  {
-    std::cout << "\nLoop from " << loopStructList[i]->loopStart->getBlockID();
-    std::cout << " to " << loopStructList[i]->loopEnd->getBlockID();
-  }
-
-  std::cout<< "\n\n";
-}
-
-/// \brief Get pointer to the loop given the loop start node
-t_loopStruct * MyASTVisitor::getLoopSource(clang::CFGBlock * source)
-{
-  t_loopStructList::iterator loop_it;
-  t_loopStruct * myLoop;
-
-  for (loop_it  = loopStructList.begin();
-       loop_it != loopStructList.end();
-       loop_it++)
-  {
-    myLoop = *(loop_it);
-
-    if (myLoop->loopStart == source)
-      return myLoop;
-  }
-
-  return NULL;
-}
-
-/// \brief Get pointer to the loop given the loop end node
-t_loopStruct * MyASTVisitor::getLoopDest(clang::CFGBlock * dest)
-{
-  t_loopStructList::iterator loop_it;
-  t_loopStruct * myLoop;
-
-  for (loop_it  = loopStructList.begin();
-       loop_it != loopStructList.end();
-       loop_it++)
-  {
-    myLoop = *(loop_it);
-
-    if (myLoop->loopEnd == dest)
-      return myLoop;
-  }
-
-  return NULL;
-}
-
-/// \brief Get traversal list for CFG with breaks.
-void MyASTVisitor::getListBreak(MyCFG my_cfg)
-{
-  unsigned NumberOfBlocks = my_cfg.cfg->getNumBlockIDs();
-  myNumBlocks = NumberOfBlocks;
-  myBlocksToVisit = (int *) new int [NumberOfBlocks];
-
-  for(int i =0 ; i<NumberOfBlocks; i++)
-  {
-    myBlocksToVisit[i] = WHITE;
-  }
-
-  t_loopStruct * newloop;
-  newloop = (t_loopStruct *) new (t_loopStruct);
-  currentLoop = (t_loopStruct *) new (t_loopStruct);
-  newloop->loopStart = *(my_cfg.cfg->rbegin());
-  newloop->loopEnd =  *(--(my_cfg.cfg->rend()));
-  newloop->loop_done = true;
-  loopStructList.push_back(newloop);
-
-
-  currentLoop = getLoopSource(*(my_cfg.cfg->rbegin()));
-  newGetList(*(my_cfg.cfg->rbegin()), myBlocksToVisit);
-
-  while(currentLoop->loop_done == false)
-  {
-    std::cerr << "\nloop from "
-      << currentLoop->loopStart->getBlockID() << " to "
-      << currentLoop->loopEnd->getBlockID() << " is unfinished.\n";
-    processPendingList(myBlocksToVisit);
-    std::cerr << "\nDone processing pending list for loop from"
-      << currentLoop->loopStart->getBlockID() << " to "
-      << currentLoop->loopEnd->getBlockID() << " explicitly.\n";
-  }
-
-  //Printing tempblock list
-  std::cout << "\n\n" << "Printing tempBlockList\n";
-  for(int i = 0; i < tempblockList.size(); i++)
-  {
-    std::cout << " " << tempblockList[i]->getBlockID();
-  }
-  std::cout << "\n\n";
-
-  blockList = tempblockList;
-}
-
-/// \brief Get blockList - list of blocks to be visited in order
-void MyASTVisitor::newGetList(clang::CFGBlock* cfg_block, int* myBlocksToVisit)
-{
-  // Visited <=> Put on the blockList
-
-  // A block can be visited only when its normal predecessors have been visited
-  // normal predecessors : Predecessors which are not sources of back-edges.
-
-  // GRAY : Predecessors of Block Not Visited yet.
-  // RED  : Predecessors of Block Done, Block Put onto List,
-  //        Successors not Visited yet.
-  // BLACK : Both Predecessors and Successors of Block Visited.
-  // GREEN : Goto Block, Put onto pending list.
-
-  if(cfg_block == NULL)
-  {
-  std::cerr << "\nCame to NULL Block, returning.";
-  return;
-  }
-
-  else  if(myBlocksToVisit[cfg_block->getBlockID()]!= BLACK)
-  {
-  std::cerr << "\nMyBlocks to visit is: \n";
-
-
-  std::cerr << "\nCurrently in loop from "
-    << currentLoop->loopStart->getBlockID() << " to "
-    << currentLoop->loopEnd->getBlockID() << "\n";
-  for(int i = 0; i< myNumBlocks; i++)
-    std::cerr << std::setw(4) << i<<" ";
-
-  std::cerr << "\n";
-
-  for(int i = 0; i< myNumBlocks; i++)
-    std::cerr << std::setw(4) << myBlocksToVisit[i] << " ";
-
-  std::cerr << "\n\n";
-  if(exit_block && cfg_block)
-    std::cerr << "\n\n" << " from block " << exit_block->getBlockID() << " Came to block " << cfg_block->getBlockID() ;
-  else if(!(exit_block && cfg_block))
-    std::cerr << "\n\n" << " Came to block " << cfg_block->getBlockID() ;
-
-  int blockType = globalBlockList[cfg_block->getBlockID()]->term;
-  edgeStruct* myEdge = isADestOfBackEdge(cfg_block);
-  edgeStruct* myEdge2 = isASourceOfBackEdge(cfg_block);
-
-
-  if(myBlocksToVisit[cfg_block->getBlockID()] == BLACK)
-  {
-    std::cerr << "\nNot processing, since already finished.";
-    return;
-  }
-  //We have reached an unprocessed Goto Block.
-  else if(blockType == 5 && myEdge2 == NULL && myBlocksToVisit[cfg_block->getBlockID()]!= BLACK)
-  {
-    std::cerr << "\nCame into blockType == 5";
-    //Check if we have reached the end of the current loop?
-    if(currentLoop->loop_done == true)
-    {
-      predVisit(cfg_block,myBlocksToVisit);
-    //safe to now process this block?
-    //TODO: Check if this block can always be processed at this point.
-    //For eg: Can it ever happen that this block has a predecessor which
-    //        has not been processed till now?
-      std::cerr << "\nCurrent->loop_done is : TRUE  ";
-      if((myBlocksToVisit[cfg_block->getBlockID()] != RED)&&
-              (myBlocksToVisit[cfg_block->getBlockID()]!= BLACK))
-      {
-        //Pushing the block onto the list and marking it RED.
-        std::cerr << "\nPushing block " << cfg_block->getBlockID()
-                  << " onto tempblockList";
-        tempblockList.push_back(cfg_block);
-        myBlocksToVisit[cfg_block->getBlockID()] = RED;
-      }
-      //Go and visit Successors of this block.
-      succVisit(cfg_block,myBlocksToVisit);
-    }
-
-    //This is the case when the loop end has not been reached
-    //Check if the block is not GREEN, nor RED nor BLACK
-    //It is the same as checking if the Block is WHITE
-    else if(myBlocksToVisit[cfg_block->getBlockID()]== WHITE)
-    {
-      std::cerr << "\nPushing block " << cfg_block->getBlockID() << " onto loop pending"
-                << " list of loop from  " << currentLoop->loopStart->getBlockID() << " to "
-                << currentLoop->loopEnd->getBlockID();
-      if(cfg_block != NULL)
-        currentLoop->pendingList.push_back(cfg_block);
-
-      //Print the Loop Pending List.
-      std::cerr << "\nThe list is now : ";
-      for(int i=0; i <currentLoop->pendingList.size(); i++)
-        std::cerr << " " << currentLoop->pendingList[i]->getBlockID();
-
-      //Mark the Current Block as Green.
-      myBlocksToVisit[cfg_block->getBlockID()] = GREEN;
-
-    }
-
-    else
-    {
-      std::cerr << "\nWhat to do with this block?";
-    }
-  }
-
-  //This is the case when the Block is the Loop head
-  //i.e destination block of a back edge.
-  else if(myEdge!=NULL)
-  {
-    std::cerr << "\nCame into MyEdge != NULL";
-
-    //get the pointer to the current loop.
-    currentLoop = getLoopSource(cfg_block);
-
-    //Standard procedure
-    //1. Visit all predecessors
-    //2. Mark block as visited.
-    //3. Visit all Successors.
-    //4. Mark block as Processed.
-    if (myBlocksToVisit[cfg_block->getBlockID()] != BLACK)
-    {
-      predVisit(cfg_block,myBlocksToVisit);
+  const t_loopStructList& loops = m_context->loopForest.getLoops();
 
-      if ((myBlocksToVisit[cfg_block->getBlockID()] != RED) &&
-          (myBlocksToVisit[cfg_block->getBlockID()] != BLACK))
-      {
-        std::cerr << "\nPushing Block " << cfg_block->getBlockID() << " on the list.";
-        tempblockList.push_back(cfg_block);
-        myBlocksToVisit[cfg_block->getBlockID()] = RED;
-      }
-      succVisit(cfg_block,myBlocksToVisit);
-    }
-  }
+  getOutStream() << "\n\nPrint Loop Lists";
 
-  //This is the case when Block is the Loop Exit
-  //i.e Source of a back edge.
-  else if(myEdge2 != NULL)
+  // root of the forest is the function itself, not a loop
+  for (int i = 1; i < loops.size(); i++)
   {
-    std::cerr << "\nCame into MyEdge2 != NULL";
-
-    //get Pointer to the loop.
-    currentLoop = getLoopDest(cfg_block);
-
-
-    if (myBlocksToVisit[cfg_block->getBlockID()] != BLACK)
-    {
-      //1. Visit all predecessors
-      predVisit(cfg_block,myBlocksToVisit);
-
-      if ((myBlocksToVisit[cfg_block->getBlockID()] != RED) &&
-         (myBlocksToVisit[cfg_block->getBlockID()] != BLACK))
-      {
-        //2. Mark block as visited.
-        std::cerr << "\nPushing Block " << cfg_block->getBlockID() << " on the list.";
-        tempblockList.push_back(cfg_block);
-        myBlocksToVisit[cfg_block->getBlockID()] = RED;
-        if(currentLoop->loop_done == false)
-          {
-          exit_block = cfg_block;
-          processPendingList(myBlocksToVisit);
-          }
-      }
+    t_loopStruct* loop = loops[i];
 
-      //4. Visit all Successors.
-      succVisit(cfg_block,myBlocksToVisit);
-    }
-  }
+    getOutStream() << "\nLoop from " << loop->loopStart->getBlockID();
+    getOutStream() << " to " << loop->loopEnd->getBlockID();
+    getOutStream() << " depth " << loop->depth;
 
-  //This is the case when the block is neither a loop head/end
-  //and neither a non-finished Goto Block.
-  else
-  {
-    std::cerr << "\nCame into else";
-    //Standard procedure
-    //1. Visit all predecessors
-    //2. Mark block as visited.
-    //3. Visit all Successors.
-    //4. Mark block as Processed.
-    if (myBlocksToVisit[cfg_block->getBlockID()] != BLACK)
+    if (loop->parent->depth > 0)
     {
-      predVisit(cfg_block,myBlocksToVisit);
-
-      if ((myBlocksToVisit[cfg_block->getBlockID()] != RED) &&
-          (myBlocksToVisit[cfg_block->getBlockID()] != BLACK))
-      {
-        std::cerr << "\nPushing block " << cfg_block->getBlockID()
-                  << " onto tempblockList";
-        tempblockList.push_back(cfg_block);
-        myBlocksToVisit[cfg_block->getBlockID()] = RED;
-      }
-
-      succVisit(cfg_block,myBlocksToVisit);
+      getOutStream() << " in loop from "
+        << loop->parent->loopStart->getBlockID();
     }
-  }
-  std::cerr << "\nReturning from the newList call of block " << cfg_block->getBlockID();
-  }
-
-}
 
-/// \brief Visits all the successors of a given block.
-void MyASTVisitor::succVisit(clang::CFGBlock * cfg_block, int * myBlocksToVisit)
-{
-  if (myBlocksToVisit[cfg_block->getBlockID()] != BLACK)
-  {
-    clang::CFGBlock::succ_iterator succ_it;
+    getOutStream() << "\n\tbody:";
 
-    for (succ_it  = cfg_block->succ_begin();
-         succ_it != cfg_block->succ_end();
-         succ_it++)
+    for (int j = 0; j < loop->body.size(); j++)
     {
-      clang::CFGBlock* succ_block = *succ_it;
-
-      if (succ_block != NULL)
-      {
-        if ((myBlocksToVisit[succ_block->getBlockID()] != RED) &&
-            (myBlocksToVisit[succ_block->getBlockID()] != BLACK))
-        {
-          newGetList(succ_block, myBlocksToVisit);
-        }
-      }
+      getOutStream() << " " << loop->body[j]->getBlockID();
     }
 
-    myBlocksToVisit[cfg_block->getBlockID()] = BLACK;
-  }
-}
-
-/// \brief Visits all the predecessors of a given block.
-void MyASTVisitor::predVisit(clang::CFGBlock * cfg_block, int * myBlocksToVisit)
-{
-  clang::CFGBlock::pred_iterator pred_it;
+    getOutStream() << "\n\texits:";
 
-  if (myBlocksToVisit[cfg_block->getBlockID()] != RED)
-  {
-    for (pred_it  = cfg_block->pred_begin();
-         pred_it != cfg_block->pred_end();
-         pred_it++)
+    for (int j = 0; j < loop->exitEdges.size(); j++)
     {
-      clang::CFGBlock * pred_block = *(pred_it);
-
-      if (!isPresentInBackEdgeList(pred_block, cfg_block))
-      {
-        if ((myBlocksToVisit[pred_block->getBlockID()] != RED) &&
-            (myBlocksToVisit[pred_block->getBlockID()] != BLACK))
-        {
-          newGetList(pred_block, myBlocksToVisit);
-        }
-      }
+      getOutStream() << " " << loop->exitEdges[j]->sourceBlock->getBlockID()
+        << "->" << loop->exitEdges[j]->destBlock->getBlockID();
     }
   }
-}
-
-/// \brief Visits all the pending blocks of a given loop.
-void MyASTVisitor::processPendingList(int * myBlocksToVisit)
-{
-  //Mark current loop as visited.
-  currentLoop->loop_done = true;
-
-  //3. Process the pending list for this block.
-  std::cerr << "\nProcessing pending list for loop from "
-    << currentLoop->loopStart->getBlockID() << " to "
-    << currentLoop->loopEnd->getBlockID();
-
-  //3.1 First Push all the pending blocks which are already not there on the list.
-  /*for(int j=0; j< currentLoop->pendingList.size(); j++)
-  {
-    if((myBlocksToVisit[currentLoop->pendingList[j]->getBlockID()] != RED)
-          &&(myBlocksToVisit[currentLoop->pendingList[j]->getBlockID()] != BLACK))
-    myBlocksToVisit[currentLoop->pendingList[j]->getBlockID()] = RED;
-    tempblockList.push_back(currentLoop->pendingList[j]);
-  }*/
-
-  //3.2 Now call getList function on each of the pending blocks.
-  //The blocks are already marked red.
-  //This part ensures that the successors of the individual pending blocks
-  //are visited.
-  //This is done till the pending list for that particular loop is empty.
-  while(currentLoop->pendingList.size()>0)
-  {
-    //clang::CFGBlock * myBlock = currentLoop->pendingList[0];
-
-    clang::CFGBlock * myBlock = currentLoop->pendingList[currentLoop->pendingList.size()-1];
-    if(myBlock != NULL && myBlocksToVisit[myBlock->getBlockID()] != BLACK )
-      {
-      std::cerr << "\nCalling newGetList on block " << myBlock->getBlockID();
-      newGetList(myBlock, myBlocksToVisit);
-      }
-    /*std::vector <clang::CFGBlock *> newPendingList;
-
-    //Remove the first element from the pending list.
-    for(int j=1;j < currentLoop->pendingList.size(); j++)
-    {
-      newPendingList.push_back(currentLoop->pendingList[j]);
-    }
-    currentLoop->pendingList = newPendingList;*/
-    if(currentLoop->pendingList.size()>0)
-      currentLoop->pendingList.pop_back();
 
-  }
-  std::cerr << "\nDone Processing pending list for loop from "
-    << currentLoop->loopStart->getBlockID() << " to "
-    << currentLoop->loopEnd->getBlockID();
+  getOutStream()<< "\n\n";
 }
 
 /// \brief Set compiler instance
@@ -2429,6 +2071,12 @@ void MyCFG::setCompilerInstance(clang::CompilerInstance* ci)
   m_compilerInstance = ci;
 }
 
+/// \brief Set analysis context of the function this CFG belongs to
+void MyCFG::setAnalysisContext(AnalysisContext* context)
+{
+  m_context = context;
+}
+
 /// \brief getCFG invokes CFG::buildCFG()
 clang::CFG* MyCFG::getCFG(clang::FunctionDecl *functionDecl,
   clang::Stmt *body,
@@ -2443,178 +2091,94 @@ clang::CFG* MyCFG::getCFG(clang::FunctionDecl *functionDecl,
 
 /// \brief Add CFG info in structure MyCFGInfo
 void MyCFG::addCFGInfo(unsigned blockid,
-  clang::CFGBlock* cfg_block,
-  std::string termType,
-  bool isSourceOfBackEdge,
+  bool isLoopHead,
   AbstractMemory* absMemPtr,
-  ap_abstract1_t loopExitAbsValOld)
+  const ap_abstract1_t* loopHeadAbsValOld)
 {
-  MyCFGInfoList::iterator it;
-  bool found = false;
+  // row of the block exists, created with its terminator kind
+  MyCFGInfo* myCFGInfo = &(m_context->myCFGInfoList[blockid]);
 
-  MyCFGInfo* myCFGInfo = NULL;
-  MyCFGInfo* t_MyCFGInfo;
+  myCFGInfo->isAnalyzed = true;
 
-  // first check if this block cfg_block exists in MyCFGInfoList
+  // blocks with no terminator, entry and exit blocks; values of last visit
+  // are cleared by the move
+  myCFGInfo->blockAbsVal = std::move(absMemPtr->blockAbsVal);
 
-  for (it  = myCFGInfoList.begin();
-       it != myCFGInfoList.end();
-       it++)
+  if (isConditionTerminator(myCFGInfo->terminatorKind))
   {
-    t_MyCFGInfo = *it;
-
-    if (t_MyCFGInfo->cfg_block == cfg_block)
-    {
-      found = true;
-
-      // if yes, store pointer to MyCFGInfo entry
-      myCFGInfo = t_MyCFGInfo;
-      break;
-    }
+    // blocks with conditions and loops as teminator
+    myCFGInfo->condAbsVal = std::move(absMemPtr->condAbsVal);
+    myCFGInfo->negCondAbsVal = std::move(absMemPtr->negCondAbsVal);
   }
 
-  if (!found)
-  {
-    // add first entry
-    t_MyCFGInfo = (MyCFGInfo*) new MyCFGInfo;
-
-    t_MyCFGInfo->blockid = blockid;
-    t_MyCFGInfo->cfg_block = cfg_block;
-    t_MyCFGInfo->terminatorType = termType;
-
-    if ((strcmp(termType.c_str(), "If") == 0) ||
-        (strcmp(termType.c_str(), "While") == 0) ||
-        (strcmp(termType.c_str(), "DoWhile") == 0) ||
-        (strcmp(termType.c_str(), "For") == 0) )
-    {
-      // blocks with conditions and loops as teminator
-      t_MyCFGInfo->blockAbsVal = absMemPtr->blockAbsVal;
-      t_MyCFGInfo->condAbsVal = absMemPtr->condAbsVal;
-      t_MyCFGInfo->negCondAbsVal = absMemPtr->negCondAbsVal;
-    }
-    else
-    //if (strcmp(termType.c_str(), "None") == 0)
-    if ((strcmp(termType.c_str(), "None") == 0) ||
-        (strcmp(termType.c_str(), "Goto") == 0) )
-    {
-      // blocks with no terminator
-      t_MyCFGInfo->blockAbsVal = absMemPtr->blockAbsVal;
-    }
-    else
-    if (strcmp(termType.c_str(), "Empty") == 0)
-    {
-      // entry and exit blocks
-      t_MyCFGInfo->blockAbsVal = absMemPtr->blockAbsVal;
-    }
-
-    t_MyCFGInfo->isSourceOfBackEdge = isSourceOfBackEdge;
+  myCFGInfo->isLoopHead = isLoopHead;
 
-    // set loopExitAbsValOld for loops
-    if (isSourceOfBackEdge)
-    {
-      t_MyCFGInfo->loopExitAbsValOld = loopExitAbsValOld;
-    }
-
-    myCFGInfoList.push_back(t_MyCFGInfo);
-  }
-  else
+  // set loopHeadAbsValOld for loops
+  if (isLoopHead)
   {
-    // entry exists, update MyCFGInfo entry
-    myCFGInfo->terminatorType = termType;
-
-    if ((strcmp(termType.c_str(), "If") == 0) ||
-        (strcmp(termType.c_str(), "While") == 0) ||
-        (strcmp(termType.c_str(), "DoWhile") == 0) ||
-        (strcmp(termType.c_str(), "For") == 0) )
-    {
-      // blocks with conditions and loops as teminator
-      myCFGInfo->blockAbsVal = absMemPtr->blockAbsVal;
-      myCFGInfo->condAbsVal = absMemPtr->condAbsVal;
-      myCFGInfo->negCondAbsVal = absMemPtr->negCondAbsVal;
-    }
-    else
-    //if (strcmp(termType.c_str(), "None") == 0)
-    if ((strcmp(termType.c_str(), "None") == 0) ||
-        (strcmp(termType.c_str(), "Goto") == 0) )
-    {
-      // blocks with no terminator
-      myCFGInfo->blockAbsVal = absMemPtr->blockAbsVal;
-    }
-    else
-    if (strcmp(termType.c_str(), "Empty") == 0)
-    {
-      // entry and exit blocks
-      myCFGInfo->blockAbsVal = absMemPtr->blockAbsVal;
-    }
-
-    // set loopExitAbsValOld for loops
-    if (isSourceOfBackEdge)
-    {
-      t_MyCFGInfo->loopExitAbsValOld = loopExitAbsValOld;
-    }
-
-  } // else found ends
+    myCFGInfo->loopHeadAbsValOld = AbstractValue::copyOf(m_context->man,
+      loopHeadAbsValOld);
+  }
 }
 
 /// \brief Print CFG info in structure MyCFGInfo
 void MyCFG::printCFGInfo()
 {
-  MyCFGInfoList::iterator it;
   MyCFGInfo* t_MyCFGInfo;
 
-  std::cerr << "\nBlockId CFGBlock \tTermType";
-  std::cerr << " blockAbsVal \tcondAbsVal \tnegCondAbsVal\tloopExitAbsValOld\n";
-  std::cerr << "------------------------------------------------------------";
-  std::cerr << "------------------------------------------------------------\n";
+  getErrStream() << "\nBlockId CFGBlock \tTermType";
+  getErrStream()
+    << " blockAbsVal \tcondAbsVal \tnegCondAbsVal\tloopHeadAbsValOld\n";
+  getErrStream()
+    << "------------------------------------------------------------";
+  getErrStream()
+    << "------------------------------------------------------------\n";
 
-  for (it  = myCFGInfoList.begin();
-       it != myCFGInfoList.end();
-       it++)
+  // rows in traversal order, blocks not analyzed yet are left out
+  for (int i = 0; i < m_context->blockList.size(); i++)
   {
-    t_MyCFGInfo = *it;
-
-    std::cerr << t_MyCFGInfo->blockid << "\t";
-    std::cerr << t_MyCFGInfo->cfg_block << "\t";
-    std::cerr << t_MyCFGInfo->terminatorType << "\t";
+    t_MyCFGInfo =
+      &(m_context->myCFGInfoList[m_context->blockList[i]->getBlockID()]);
 
-    if ((strcmp(t_MyCFGInfo->terminatorType.c_str(), "If") == 0) ||
-        (strcmp(t_MyCFGInfo->terminatorType.c_str(), "While") == 0) ||
-        (strcmp(t_MyCFGInfo->terminatorType.c_str(), "DoWhile") == 0) ||
-        (strcmp(t_MyCFGInfo->terminatorType.c_str(), "For") == 0) )
+    if (!t_MyCFGInfo->isAnalyzed)
     {
-      ap_abstract1_fprint(stderr, man, &(t_MyCFGInfo->blockAbsVal));
-      ap_abstract1_fprint(stderr, man, &(t_MyCFGInfo->condAbsVal));
-      ap_abstract1_fprint(stderr, man, &(t_MyCFGInfo->negCondAbsVal));
+      continue;
     }
-    else
-    //if (strcmp(t_MyCFGInfo->terminatorType.c_str(), "None") == 0)
-    if ((strcmp(t_MyCFGInfo->terminatorType.c_str(), "None") == 0) ||
-        (strcmp(t_MyCFGInfo->terminatorType.c_str(), "Goto") == 0) )
-    {
-      ap_abstract1_fprint(stderr, man, &(t_MyCFGInfo->blockAbsVal));
 
-      std::cerr << "----\t\t";
-      std::cerr << "----\t\t";
+    getErrStream() << t_MyCFGInfo->blockid << "\t";
+    getErrStream() << t_MyCFGInfo->cfg_block << "\t";
+    getErrStream() << getTerminatorName(t_MyCFGInfo->terminatorKind) << "\t";
+
+    if (isConditionTerminator(t_MyCFGInfo->terminatorKind))
+    {
+      ap_abstract1_fprint(getErrFile(), m_context->man,
+        t_MyCFGInfo->blockAbsVal.get());
+      ap_abstract1_fprint(getErrFile(), m_context->man,
+        t_MyCFGInfo->condAbsVal.get());
+      ap_abstract1_fprint(getErrFile(), m_context->man,
+        t_MyCFGInfo->negCondAbsVal.get());
     }
     else
-    if (strcmp(t_MyCFGInfo->terminatorType.c_str(), "Empty") == 0)
     {
-      ap_abstract1_fprint(stderr, man, &(t_MyCFGInfo->blockAbsVal));
+      // blocks with no terminator, Goto, entry and exit blocks
+      ap_abstract1_fprint(getErrFile(), m_context->man,
+        t_MyCFGInfo->blockAbsVal.get());
 
-      std::cerr << "----\t\t";
-      std::cerr << "----\t\t";
+      getErrStream() << "----\t\t";
+      getErrStream() << "----\t\t";
     }
 
-    if (t_MyCFGInfo->isSourceOfBackEdge)
+    if (t_MyCFGInfo->isLoopHead)
     {
-      ap_abstract1_fprint(stderr, man, &(t_MyCFGInfo->loopExitAbsValOld));
+      ap_abstract1_fprint(getErrFile(), m_context->man,
+        t_MyCFGInfo->loopHeadAbsValOld.get());
     }
     else
     {
-      std::cerr << "----";
+      getErrStream() << "----";
     }
 
-    std::cerr << "\n";
+    getErrStream() << "\n";
   }
 }
 
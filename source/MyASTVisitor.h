@@ -6,6 +6,7 @@
 /// \brief Defines AST node visitor class MyASTVisitor inherited from
 /// clang::RecursiveASTVisitor
 ///
+#include <mutex>
 #include <vector>
 
 #ifndef MYASTVISITOR_H
@@ -15,10 +16,24 @@
 #include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/Analysis/CFG.h"
 #include "clang/Frontend/CompilerInstance.h"
-#include "clang/Analysis/Analyses/CFGReachabilityAnalysis.h"
 
 #include "Apron.h"
 
+class AnalysisContext;
+
+/// \brief Get mutex serializing lookups in clang::SourceManager, which
+/// caches its last lookup and is shared by analysis threads
+/// @param none
+/// @return std::mutex& - source manager mutex
+std::mutex& getSourceManagerMutex();
+
+/// \brief Get mutex serializing queries of clang::ASTContext (constant
+/// evaluation, side effects, printing policy), which is shared by analysis
+/// threads and is not thread-safe
+/// @param none
+/// @return std::mutex& - AST context mutex
+std::mutex& getASTContextMutex();
+
 /// \brief Color constants used to mark CFGBlocks and edges in CFG traversal,
 /// see edgeColor in structure edgeStruct
 const int GREEN = 4;
@@ -27,6 +42,30 @@ const int RED   = 2;
 const int GRAY  = 1;
 const int WHITE = 0;
 
+/// \brief Kind of terminator of a CFG block, computed once per block by
+/// MyASTVisitor::getTerminatorType(); TERM_EMPTY for entry and exit blocks
+typedef enum TerminatorKind
+{
+  TERM_NONE    = 0,
+  TERM_IF      = 1,
+  TERM_WHILE   = 2,
+  TERM_DOWHILE = 3,
+  TERM_FOR     = 4,
+  TERM_GOTO    = 5,
+  TERM_EMPTY   = 6
+} TerminatorKind;
+
+/// \brief Get printable name of a terminator kind
+/// @param kind - terminator kind
+/// @return const char* - None / If / While / DoWhile / For / Goto / Empty
+const char* getTerminatorName(TerminatorKind kind);
+
+/// \brief Is terminator a condition (If / While / DoWhile / For), i.e. does
+/// block have abstract values of condition and its negation
+/// @param kind - terminator kind
+/// @return bool - true for condition terminators, false otherwise
+bool isConditionTerminator(TerminatorKind kind);
+
 /// \brief Structure to hold CFG info
 typedef struct MyCFGInfo
 {
@@ -36,30 +75,48 @@ typedef struct MyCFGInfo
   /// \brief Pointer to basic block
   clang::CFGBlock* cfg_block;
 
-  /// \brief Does this block have a terminator
-  std::string terminatorType;
+  /// \brief Terminator kind of this block
+  TerminatorKind terminatorKind;
+
+  /// \brief Flag to indicate that block has been analyzed, abstract values
+  /// below are set only then
+  bool isAnalyzed;
 
-  /// \brief Flag to indicate if current block is source of an back edge
-  bool isSourceOfBackEdge;
+  /// \brief Flag to indicate if current block is head of a component (loop
+  /// header) of the weak topological order
+  bool isLoopHead;
 
-  // AbstractMemory
+  // AbstractMemory (values are owned by the row)
 
   /// \brief Abstract value of a CFGBlock
-  ap_abstract1_t blockAbsVal;
+  AbstractValue blockAbsVal;
 
-  /// \brief Abstract value of positive of condition
-  ap_abstract1_t condAbsVal;
+  /// \brief Abstract value of block met with condition (value at begin of
+  /// first successor)
+  AbstractValue condAbsVal;
 
-  /// \brief Abstract value of negative of condition
-  ap_abstract1_t negCondAbsVal;
+  /// \brief Abstract value of block met with negation of condition (value
+  /// at begin of second successor)
+  AbstractValue negCondAbsVal;
 
-  /// \brief Old Abstract value at exit block of loop
-  ap_abstract1_t loopExitAbsValOld;
+  /// \brief Abstract value at loop head of last iteration (joined or
+  /// widened), compared with the next one to detect stability
+  AbstractValue loopHeadAbsValOld;
+
+  /// \brief Constraints of condition of terminator, built on first visit
+  /// and reused by later ones (owned by the row, NULL if not built yet or
+  /// if condition cannot be reused)
+  CondExprCons* condCons;
+
+  /// \brief Effect of statements of the block (terminator excluded),
+  /// recorded on first visit and run by later ones (owned by the row, NULL
+  /// if not recorded yet or if it cannot be reused)
+  TransferProgram* transferProgram;
 
 } MyCFGInfo;
 
-/// \brief Vector of MyCFGInfo records
-typedef std::vector <MyCFGInfo* > MyCFGInfoList;
+/// \brief Table of MyCFGInfo records indexed by block id
+typedef std::vector <MyCFGInfo> MyCFGInfoList;
 
 /// \brief Wrapper class for CFG
 class MyCFG
@@ -74,6 +131,11 @@ class MyCFG
     /// @return void (nothing)
     void setCompilerInstance(clang::CompilerInstance* ci);
 
+    /// \brief Set analysis context of the function this CFG belongs to
+    /// @param context - analysis context
+    /// @return void (nothing)
+    void setAnalysisContext(AnalysisContext* context);
+
     /// \brief getCFG invokes CFG::buildCFG()
     /// @param functionDecl - pointer to FunctionDecl object
     ///        (coming from VisitFunctionDecl() parameter)
@@ -86,20 +148,20 @@ class MyCFG
       clang::ASTContext *C,
       clang::CFG::BuildOptions buildOpts);
 
-    /// \brief Add CFG info in structure MyCFGInfo
+    /// \brief Add CFG info in row blockid of MyCFGInfo table, the row
+    /// with block pointer and terminator kind is created before analysis;
+    /// abstract values of AbstractMemory are moved into the row, values of
+    /// the last visit are cleared
     /// @param blockid - block id of CFGBlock
-    /// @param cfg_block - pointer to current CFGBlock
-    /// @param termType - terminator type of current basic block
-    /// @param isSourceOfBackEdge - is current block source of back edge (loop)
+    /// @param isLoopHead - is current block head of a loop
     /// @param absMemPtr - pointer to AbstractMemory structure
-    /// @param loopExitAbsValOld - old Abstract value at exit of loop
+    /// @param loopHeadAbsValOld - abstract value at loop head of last
+    ///        iteration (copied), NULL if block is not a loop head
     /// @return void (nothing)
     void addCFGInfo(unsigned blockid,
-      clang::CFGBlock* cfg_block,
-      std::string termType,
-      bool isSourceOfBackEdge,
+      bool isLoopHead,
       AbstractMemory* absMemPtr,
-      ap_abstract1_t loopExitAbsValOld);
+      const ap_abstract1_t* loopHeadAbsValOld);
 
     /// \brief Print CFG info in structure MyCFGInfo
     /// @param none
@@ -110,6 +172,9 @@ private:
 
     /// \brief CompilerInstance handle
     clang::CompilerInstance* m_compilerInstance;
+
+    /// \brief Analysis context of the function
+    AnalysisContext* m_context;
 };
 
 /// \brief Structure to hold edge information
@@ -121,10 +186,6 @@ typedef struct edgeStruct
   /// \brief Destination block of edge
   clang::CFGBlock * destBlock;
 
-  /// \brief Flag to keep track whether loop head has been added to
-  /// the end of the loop in the case of while and for loops
-  bool hasBeenAddedWhile;
-
   /// \brief Flag to keep track whether if this is the first pass
   /// through the loop
   bool hasBeenVisited;
@@ -132,10 +193,6 @@ typedef struct edgeStruct
   /// \brief Flag to keep track whether this edge is a back edge
   bool isABackEdge;
 
-  /// \brief Counter to keep count of the number of times this
-  /// edge has been traversed
-  int timesVisited;
-
   /// \brief Edge marking 0:Normal, 1: Condition True
   /// 2: Condition False, 3: Back Edge
   int edgeColor;
@@ -164,11 +221,11 @@ typedef struct MySuccOfPredInfo
   /// \brief List of successors of predecessors of current basic block
   std::vector<clang::CFGBlock *> succOfPredList;
 
-  /// \brief Pointer to next entry of structure MySuccOfPredInfo
-  struct MySuccOfPredInfo* next;
-
 } MySuccOfPredInfo;
 
+/// \brief Entries of MySuccOfPredInfo of one basic block, one per predecessor
+typedef std::vector<MySuccOfPredInfo> MySuccOfPredInfoList;
+
 /// \brief Temporary blockStruct for traversal list
 typedef struct t_blockStruct
 {
@@ -179,26 +236,53 @@ typedef struct t_blockStruct
 /// \brief List of temporary blockStruct for traversal list
 typedef std::vector <t_blockStruct *> t_blockStructList;
 
-/// \brief Temporary global block list
-extern t_blockStructList globalBlockList;
-
-/// \brief Loop Structures to keep track of Loops
+/// \brief Loop Structures to keep track of Loops, nodes of the loop-nesting
+/// forest (see LoopForest.h)
 typedef struct t_loopStruct
 {
+  /// \brief Loop header, entry block for the function
   clang::CFGBlock * loopStart;
+
+  /// \brief Source of the first back edge to loop header found in DFS,
+  /// exit block for the function
   clang::CFGBlock * loopEnd;
-  std::vector <clang::CFGBlock *> pendingList;
-  bool loop_done;
+
+  /// \brief Blocks of the loop, header first, including nested loops
+  std::vector <clang::CFGBlock *> body;
+
+  /// \brief Edges from a block of the loop to a block outside of it
+  std::vector <edgeStruct *> exitEdges;
+
+  /// \brief Enclosing loop, NULL for the function
+  struct t_loopStruct * parent;
+
+  /// \brief Loops nested directly in this loop
+  std::vector <struct t_loopStruct *> children;
+
+  /// \brief Nesting depth, 0 for the function, 1 for outermost loops
+  int depth;
 } t_loopStruct;
 
 /// \brief List of temporary loopStruct
 typedef std::vector<t_loopStruct *> t_loopStructList;
 
-/// \brief Temporary list of loopStruct
-extern t_loopStructList loopStructList;
+/// \brief Iteration state of a component head (loop header) of the weak
+/// topological order while its component is stabilized
+typedef struct WTOHeadState
+{
+  /// \brief Loop headed by the block
+  t_loopStruct* loop;
 
-/// \brief Loop counter
-extern int loopCounter;
+  /// \brief Number of iterations of the component done so far
+  int iteration;
+
+  /// \brief Abstract value at head of last iteration
+  AbstractValue absValOld;
+
+  /// \brief Flag to indicate that value at head did not grow in the last
+  /// iteration, the component is stable
+  bool isStable;
+} WTOHeadState;
 
 /// \brief AST visitor class inherited from clang::RecursiveASTVisitor
 class MyASTVisitor : public clang::RecursiveASTVisitor<MyASTVisitor>
@@ -210,10 +294,25 @@ class MyASTVisitor : public clang::RecursiveASTVisitor<MyASTVisitor>
     /// @return void (nothing)
     void setCompilerInstance(clang::CompilerInstance* ci);
 
-    /// \brief Get terminator type (If/While/Do/For/None) for basic block
+    /// \brief Set analysis options
+    /// @param options - analysis options (domain, unrollings, verbosity, ...)
+    /// @return void (nothing)
+    void setAnalysisOptions(const AnalysisOptions* options);
+
+    /// \brief Set CFG built before analysis for a function definition, used
+    /// by VisitFunctionDecl() instead of building it (functions analyzed in
+    /// parallel get their CFG built on the main thread)
+    /// @param functionDecl - function definition
+    /// @param cfg - CFG of functionDecl (not owned)
+    /// @return void (nothing)
+    void setPrebuiltCFG(const clang::FunctionDecl* functionDecl,
+      clang::CFG* cfg);
+
+    /// \brief Get terminator type (If/While/Do/For/Goto/None) for basic
+    /// block, use terminatorKind of MyCFGInfo table during analysis
     /// @param cfg_block - pointer to current CFGBlock
-    /// @return std::string - terminator type If / While / DoWhile / For
-    std::string getTerminatorType(clang::CFGBlock* cfg_block);
+    /// @return TerminatorKind - terminator kind, TERM_NONE for others
+    TerminatorKind getTerminatorType(clang::CFGBlock* cfg_block);
 
     // Override AST visitor functions below
     // - Returning false from one of the overridden visitor functions
@@ -236,6 +335,13 @@ class MyASTVisitor : public clang::RecursiveASTVisitor<MyASTVisitor>
     /// @return bool - flag to stop ast traversal (false) or continue (true)
     bool VisitFunctionDecl(clang::FunctionDecl *FD);
 
+    /// \brief Build Apron environment of a function in one pre-pass with
+    /// all its scalar parameters, locals and temporaries (one per shift
+    /// operator), see buildEnvironment()
+    /// @param functionDecl - function
+    /// @return void (nothing)
+    void buildFunctionEnvironment(clang::FunctionDecl* functionDecl);
+
     // Functions required for CFG traversal and updating abstract value
 
     /// \brief Do pre-processing before analysis begins on CFG block list
@@ -243,10 +349,52 @@ class MyASTVisitor : public clang::RecursiveASTVisitor<MyASTVisitor>
     /// @return void (nothing)
     void doPreprocessingBeforeAnalysis(MyCFG my_cfg);
 
-    /// \brief Remove Unreachable Blocks from traversal List
+    /// \brief Analyze a block - join abstract values of its predecessors,
+    /// process its statements and terminator and store result in MyCFGInfo
+    /// @param my_cfg - MyCFG structure
+    /// @param cfg_block - pointer to CFGBlock to be analyzed
+    /// @param headState - iteration state if block is a component head,
+    ///        NULL otherwise
+    /// @return void (nothing)
+    void processBlock(MyCFG& my_cfg, clang::CFGBlock* cfg_block,
+      WTOHeadState* headState);
+
+    /// \brief Process statements of a block (terminator excluded) on
+    /// current abstract value, by traversing them with MyProcessStmt
+    /// @param cfg_block - pointer to CFGBlock
+    /// @param termKind - terminator kind of block, last statement of a block
+    /// with a condition terminator is processed with the terminator
+    /// @return void (nothing)
+    void processBlockStatements(clang::CFGBlock* cfg_block,
+      TerminatorKind termKind);
+
+    /// \brief Analyze elements [begin, end) of the weak topological order,
+    /// components are stabilized before the elements after them
     /// @param my_cfg - MyCFG structure
+    /// @param begin - index of first element
+    /// @param end - index past last element
     /// @return void (nothing)
-    void removeUnreachableBlocks(MyCFG my_cfg);
+    void processWTOElements(MyCFG& my_cfg, int begin, int end);
+
+    /// \brief Iterate a component of the weak topological order until the
+    /// value at its head is stable, widening at the head only
+    /// @param my_cfg - MyCFG structure
+    /// @param head - index of component head in weak topological order
+    /// @return void (nothing)
+    void stabilizeComponent(MyCFG& my_cfg, int head);
+
+    /// \brief Analyze blocks with a worklist ordered by reverse postorder,
+    /// a block is analyzed again only if output of a predecessor changed;
+    /// widening is done at loop heads as in stabilizeComponent()
+    /// @param my_cfg - MyCFG structure
+    /// @return void (nothing)
+    void processWorklist(MyCFG& my_cfg);
+
+    /// \brief Find blocks reachable from entry block with one forward DFS,
+    /// fills reachableBlocks of analysis context
+    /// @param my_cfg - MyCFG structure
+    /// @return void (nothing)
+    void findReachableBlocks(MyCFG my_cfg);
 
     /// \brief Return edge structure given source and destination blocks
     /// @param sourceBlock - pointer to source CFGBlock
@@ -262,15 +410,10 @@ class MyASTVisitor : public clang::RecursiveASTVisitor<MyASTVisitor>
     void markVisited(clang::CFGBlock* thisBlock,
       clang::CFGBlock* nextBlock);
 
-    /// \brief Get blockList - list of blocks to be visited in order
-    /// @param cfg_block - pointer to current CFGBlock
-    /// @param blocksToVisit - pointer to list of blockIDs marked visited
-    /// @return void (nothing)
-    void getList(clang::CFGBlock* cfg_block,
-      int* blocksToVisit);
-
-    /// \brief Does a depth first search top-down to detect the back edges.
-    /// @param cfg_block - pointer to current CFGBlock
+    /// \brief Does a depth first search top-down to detect the back edges,
+    /// iterative with an explicit stack so deep CFGs cannot overflow the
+    /// call stack.
+    /// @param cfg_block - pointer to CFGBlock to start from (entry block)
     /// @param blocksToVisit - pointer to list of blockIDs marked visited
     /// @return void (nothing)
     void findBackEdges(clang::CFGBlock* cfg_block,
@@ -315,13 +458,6 @@ class MyASTVisitor : public clang::RecursiveASTVisitor<MyASTVisitor>
     /// @return void (nothing)
     void displayBackEdges();
 
-    /// \brief Find if this edge is present in the list of back edges
-    /// @param sourceBlock - pointer to source CFGBlock
-    /// @param destBlock - pointer to destination CFGBlock
-    /// @return bool - true if source->destination edge is a back edge
-    bool isPresentInBackEdgeList(clang::CFGBlock * sourceBlock,
-      clang::CFGBlock * destBlock);
-
     /// \brief Get number of predecessors
     /// @param block - pointer to current CFGBlock
     /// @return int - number of predecessors
@@ -342,17 +478,18 @@ class MyASTVisitor : public clang::RecursiveASTVisitor<MyASTVisitor>
     /// @return std::vector of clang::CFGBlock * - successor list
     std::vector<clang::CFGBlock *> getSuccessors(clang::CFGBlock* block);
 
-    /// \brief Add an entry for successors of a predecessor of a basic block
+    /// \brief Add an entry for successors of a predecessor of a basic block,
+    /// entries of the block are cleared before it is visited
     /// @param cfg_block - pointer to current CFGBlock
     /// @param pred_block - pointer to predecessor of current CFGBlock
     /// @return void (nothing)
     void addSuccOfPredInfo(clang::CFGBlock* cfg_block,
       clang::CFGBlock* pred_block);
 
-    /// \brief Show successors of predecessors
-    /// @param none
+    /// \brief Show successors of predecessors of a basic block
+    /// @param cfg_block - pointer to current CFGBlock
     /// @return void (nothing)
-    void showSuccOfPredInfo();
+    void showSuccOfPredInfo(clang::CFGBlock* cfg_block);
 
     /// \brief Find if this block is unique successor -
     /// block with one predecessor and predecessor has only one successor
@@ -362,7 +499,8 @@ class MyASTVisitor : public clang::RecursiveASTVisitor<MyASTVisitor>
 
     /// \brief Get a row of structure MyCFGInfo
     /// @param block - pointer to current CFGBlock
-    /// @return MyCFGInfo* - pointer to entry of current block in MyCFGInfo
+    /// @return MyCFGInfo* - pointer to entry of current block in MyCFGInfo,
+    ///         NULL if block has not been analyzed yet
     MyCFGInfo* getRowOfMyCFGInfo(clang::CFGBlock* block);
 
     /// \brief Find if this block is first successor of its predecessor -
@@ -371,28 +509,6 @@ class MyASTVisitor : public clang::RecursiveASTVisitor<MyASTVisitor>
     /// @return bool - true if current block is first successor
     bool isFirstSuccOfPred(clang::CFGBlock* cfg_block);
 
-    /// \brief In case of for loops and while loops, we add the loop head
-    /// at the end of the loop tail in the traversal list
-    /// @param cfg_block - pointer to current CFGBlock
-    /// @return void (nothing)
-    void processListWhileFor(clang::CFGBlock * cfg_block);
-
-    /// \brief In case of Dowhile loops, we add the loop head to
-    /// the block before loop tail at the end of the loop tail
-    /// in the traversal list
-    /// @param cfg_block - pointer to current CFGBlock
-    /// @return void (nothing)
-    void processListDoWhile(clang::CFGBlock * cfg_block);
-
-    /// \brief When widening needs to be done, the pointer of the blocklist
-    /// is shifted back to the loop head. Should be called from the source
-    /// of a back edge.
-    /// @param cfg_block - pointer to current CFGBlock
-    /// @param original - blockid marker in blocklist to shift back for widening
-    /// @return int - 
-    int modifyListWiden(clang::CFGBlock * cfg_block,
-      int original);
-
     /// \brief Find if this block is the source of a back edge
     /// @param cfg_block - pointer to current CFGBlock
     /// @return edgeStruct* - pointer to edge info otherwise NULL
@@ -403,38 +519,14 @@ class MyASTVisitor : public clang::RecursiveASTVisitor<MyASTVisitor>
     /// @return edgeStruct* - pointer to edge info otherwise NULL
     edgeStruct* isADestOfBackEdge(clang::CFGBlock * cfg_block);
 
-    /// \brief See if this is first visit to block leading to back edge
-    /// @param cfg_block - pointer to current CFGBlock
-    /// @return bool - true if exit block of loop is visited first time
-    bool isFirstTime(clang::CFGBlock* cfg_block);
-
-    /// \brief Reset timesVisited counter for back edge if fix point is reached
-    /// @param cfg_block - pointer to current CFGBlock
-    /// @return void (nothing)
-    void resetTimesVisited(clang::CFGBlock* cfg_block);
-
-    /// \brief Return loopExitAbsValOld for given cfg_block
-    /// @param cfg_block - pointer to current CFGBlock
-    /// @return ap_abstract1_t - old abstract value at exit of loop
-    ap_abstract1_t getLoopExitAbsValOld(clang::CFGBlock* cfg_block);
-
-    /// \brief Support member for Tarzan's Algorithm
-    /// @param cfg_block - pointer to current CFGBlock
-    /// @return bool - 
-    bool isPresentinS(clang::CFGBlock * cfg_block);
-
-    /// \brief Support member for Tarzan's Algorithm
-    /// @param cfg_block - pointer to current CFGBlock
-    /// @return void (nothing)
-    void stronglyConnect(clang::CFGBlock* cfg_block);
-
-    /// \brief Use Tarzan's Algorithm to find SCC in the CFG
-    /// @param none
+    /// \brief Build loop-nesting forest of the CFG (see LoopForest.h)
+    /// @param my_cfg - MyCFG structure
     /// @return void (nothing)
-    void tarzanAlgo();
+    void buildLoopForest(MyCFG my_cfg);
 
     /// \brief Populate the blockStructList containing the block pointer
-    /// and the block terminator type
+    /// and the block terminator type, and create MyCFGInfo table with
+    /// terminator kind of every block
     /// @param my_cfg - MyCFG structure
     /// @return void (nothing)
     void createBlockList(MyCFG my_cfg);
@@ -444,59 +536,26 @@ class MyASTVisitor : public clang::RecursiveASTVisitor<MyASTVisitor>
     /// @return void (nothing)
     void printBlockStruct();
 
-    /// \brief Print the loops encountered in the CFG
+    /// \brief Print the loop-nesting forest of the CFG
     /// @param none
     /// @return void (nothing)
     void printLoops();
 
-    /// \brief Get traversal list for CFG with breaks
-    /// @param my_cfg - MyCFG structure
-    /// @return void (nothing)
-    void getListBreak(MyCFG my_cfg);
-
-    /// \brief Get pointer to the loop given the loop start node
-    /// @param source -
-    /// @return t_loopStruct * -
-    t_loopStruct * getLoopSource(clang::CFGBlock * source);
-
-    /// \brief Get pointer to the loop given the loop end node
-    /// @param dest -
-    /// @return t_loopStruct * -
-    t_loopStruct * getLoopDest(clang::CFGBlock * dest);
-
-    /// \brief Get blockList - list of blocks to be visited in order
-    /// @param cfg_block - 
-    /// @param myBlocksToVisit -
-    /// @return void (nothing)
-    void newGetList(clang::CFGBlock* cfg_block,
-      int* myBlocksToVisit);
-
-    /// \brief Visits all the successors of a given block
-    /// @param cfg_block - 
-    /// @param myBlocksToVisit -
-    /// @return void (nothing)
-    void succVisit(clang::CFGBlock * cfg_block,
-      int * myBlocksToVisit);
-
-    /// \brief Visits all the predecessors of a given block
-    /// @param cfg_block - 
-    /// @param myBlocksToVisit -
-    /// @return void (nothing)
-    void predVisit(clang::CFGBlock * cfg_block,
-      int * myBlocksToVisit);
-
-    /// \brief Visits all the pending blocks of a given loop
-    /// @param myBlocksToVisit - to keep track if block has been visited
-    /// @return void (nothing)
-    void processPendingList(int * myBlocksToVisit);
-
   private:
 
     /// \brief CompilerInstance handle
     clang::CompilerInstance* m_compilerInstance;
 
-    /// \brief Pointer to list of structure MySuccOfPredInfo
-    MySuccOfPredInfo* SuccOfPredInfo;
+    /// \brief Analysis options
+    const AnalysisOptions* m_options;
+
+    /// \brief Analysis context of the function being analyzed,
+    /// set by VisitFunctionDecl()
+    AnalysisContext* m_context;
+
+    /// \brief Function definition with a prebuilt CFG and its CFG
+    const clang::FunctionDecl* m_prebuiltFunction;
+    clang::CFG* m_prebuiltCFG;
 };
 
 #endif //MYASTVISITOR_H
@@ -10,16 +10,11 @@
 #include <string>
 
 #include "MyProcessStmt.h"
+#include "AnalysisContext.h"
+#include "AnalysisOutput.h"
 
 using namespace clang;
 
-/// \brief Flag to indicate if current expression is compound expression
-bool isCascadedAssign = false;
-
-/// \brief Count number of assignments in a statement
-/// (required for cascaded assignments)
-int assignCount = 0;
-
 /// \brief Set compiler instance, block id for a statement, statement object
 /// (Stmt *s) and call TraverseStmt()
 MyProcessStmt::MyProcessStmt(clang::CompilerInstance* ci,
@@ -33,6 +28,10 @@ MyProcessStmt::MyProcessStmt(clang::CompilerInstance* ci,
   m_isLastStatement = isLastStatement;
   m_ignoreExpr = false;
 
+  // per-statement state (assignCount, isCascadedAssign) lives in the
+  // context of the function being analyzed
+  m_context = AnalysisContext::getCurrent();
+
   // call TraverseStmt(Stmt* ) will dispatch calls to Visit## methods
   TraverseStmt(m_stmt);
 }
@@ -46,19 +45,36 @@ std::string MyProcessStmt::getTypeAsString(const ValueDecl* valueDecl)
   // Now call clang::QualType.getAsString(PrintingPolicy &Policy)
   clang::ASTContext &context = this->m_compilerInstance->getASTContext();
 
+  // ASTContext is shared by analysis threads
+  std::lock_guard<std::mutex> lock(getASTContextMutex());
+
   return declQT.getAsString(context.getPrintingPolicy());
 }
 
+/// \brief Get symbol of a variable declaration, a declaration without
+/// symbol (e.g. global variable) gets one on first use
+VariableCount* MyProcessStmt::getVariableSymbol(const ValueDecl* valueDecl)
+{
+  VariableCount* var = lookupVariable(valueDecl);
+
+  if (var == NULL)
+  {
+    var = addVariable(valueDecl, valueDecl->getNameAsString().c_str(),
+      getTypeAsString(valueDecl).c_str());
+  }
+
+  return var;
+}
+
 /// \brief Get operand for unary incr/decr operator
-std::string MyProcessStmt::getOperandForUnaryOp(UnaryOperator *E)
+VariableCount* MyProcessStmt::getOperandForUnaryOp(UnaryOperator *E)
 {
   // get sub expression
   Expr* subexpr = E->getSubExpr();
 
-  std::string varName;
-  std::string varType;
+  VariableCount* var = NULL;
 
-  if (strcmp(subexpr->getStmtClassName(), "DeclRefExpr") == 0)
+  if (subexpr->getStmtClass() == Stmt::DeclRefExprClass)
   {
     // get name and type for Expr *subexpr from DeclRefExpr
     const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(subexpr);
@@ -66,14 +82,67 @@ std::string MyProcessStmt::getOperandForUnaryOp(UnaryOperator *E)
 
     if (valueDecl)
     {
-      varName = valueDecl->getNameAsString();
-      varType = getTypeAsString(valueDecl);
-      std::cerr << "\tvarName = " << (char *)varName.c_str() << "\n";
-      std::cerr << "\tvarType = " << varType << "\n";
+      var = getVariableSymbol(valueDecl);
+      getErrStream() << "\tvarName = " << var->varName << "\n";
+      getErrStream() << "\tvarType = " << var->varType << "\n";
     }
   }
 
-  return varName;
+  return var;
+}
+
+/// \brief Fold an integer constant expression (e.g. 2 * 3, enum constant,
+/// sizeof) with clang's constant evaluator
+bool MyProcessStmt::getIntegerConstant(const Expr* E, double& dval)
+{
+  if (E == NULL || !E->getType()->isIntegralOrEnumerationType())
+  {
+    return false;
+  }
+
+  // fails for expressions with side effects or non-constant operands
+  llvm::APSInt value;
+
+  {
+    // evaluator allocates in ASTContext, which is shared by analysis threads
+    std::lock_guard<std::mutex> lock(getASTContextMutex());
+
+    if (!E->EvaluateAsInt(value, m_compilerInstance->getASTContext()))
+    {
+      return false;
+    }
+  }
+
+  dval = value.roundToDouble(value.isSigned());
+
+  return true;
+}
+
+/// \brief Set constraints of a condition which folds to a constant,
+/// e.g. while (1), while (3 > 2), if (False)
+bool MyProcessStmt::setConstantCondition(const Expr* cond)
+{
+  double dval;
+
+  if (!getIntegerConstant(cond, dval))
+  {
+    return false;
+  }
+
+  getErrStream() << "\t\tconstant condition value: " << dval << "\n";
+
+  if (dval == 0)
+  {
+    getErrStream() << "\t\tcondition is zero! \n";
+    setAbstractMemory(0);
+  }
+  else
+  {
+    getErrStream() << "\t\tcondition is non-zero! \n";
+    setAbstractMemory(1);
+  }
+
+  return true;
 }
 
 /// \brief Override visit method for declaration - DeclStmt
@@ -81,7 +150,7 @@ std::string MyProcessStmt::getOperandForUnaryOp(UnaryOperator *E)
 /// - inside for loop initialization section
 bool MyProcessStmt::VisitDeclStmt(Stmt *s)
 {
-  std::cerr << "\n   Found DeclStmt \n";
+  getErrStream() << "\n   Found DeclStmt \n";
 
   // Get DeclStmt by dyn_cast s to DeclStmt
   DeclStmt *declStmt = dyn_cast<DeclStmt>(s);
@@ -97,32 +166,26 @@ bool MyProcessStmt::VisitDeclStmt(Stmt *s)
   {
     clang::Decl* decl = *it;
 
-    std::cerr << "\tdecl statement: ";
-    decl->dump();
-    std::cerr << "\n";
-
-    std::string varName;
-    std::string varType;
+    getErrStream() << "\tdecl statement: ";
+    FileRawOstream errStream(getErrFile());
+    std::unique_lock<std::mutex> lock(getASTContextMutex());
+    decl->print(errStream);
+    lock.unlock();
+    getErrStream() << "\n";
 
-    // Get name for Decl
-    const NamedDecl *namedDecl = dyn_cast<NamedDecl>(decl);
+    VariableCount* var = NULL;
 
-    if (namedDecl)
-    {
-      varName = namedDecl->getNameAsString();
-      std::cerr << "\tidentifier name = " << varName << "\n";
-    }
-
-    // Get type for Decl
+    // Get symbol (name and type) for Decl
     const ValueDecl *valueDecl = dyn_cast<ValueDecl>(decl);
 
     if (valueDecl)
     {
-      varType = getTypeAsString(valueDecl);
-      std::cerr << "\ttype = " << varType << "\n";
+      var = getVariableSymbol(valueDecl);
+      getErrStream() << "\tidentifier name = " << var->varName << "\n";
+      getErrStream() << "\ttype = " << var->varType << "\n";
 
       // Get variable name and type
-      getVarNameAndType(varName.c_str(), varType.c_str());
+      getVarNameAndType(var->varName, var->varType);
     }
 
     // Get initial value for declaration and update abstract value
@@ -134,57 +197,42 @@ bool MyProcessStmt::VisitDeclStmt(Stmt *s)
       if (varDecl->hasInit())
       {
         // increment assignCount when DeclStmt has initial value
-        assignCount++;
+        m_context->assignCount++;
+
+        // value of initializer if it is an integer constant expression
+        double constVal = 0;
 
         const Expr *e = varDecl->getInit();
         e = e->IgnoreParenImpCasts();
 
-        if (strcmp(e->getStmtClassName(), "CharacterLiteral") == 0)
-        {
-          std::cerr << "\tCharacterLiteral: \n";
-
-          const CharacterLiteral *CL = dyn_cast<CharacterLiteral>(e);
-
-          // TODO : get correct character literal value
-          unsigned ch = CL->getValue();
-          std::cerr << "\tinitial value: " << ch << "\n";
-
-          // Set initial value for character literal
-          setValueForIntegerLiteral(varName.c_str(), (double) ch, assignCount);
-          assignCount--;
-        }
-        else
-        if (strcmp(e->getStmtClassName(), "IntegerLiteral") == 0)
+        if (getIntegerConstant(e, constVal))
         {
-          std::cerr << "\tIntegerLiteral: " << "\n";
-
-          const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(e);
+          // literal or constant subexpression folded by clang
+          getErrStream() << "\tinitial value: " << constVal << "\n";
 
-          // TODO : get correct integer literal value
-          double dval = IL->getValue().signedRoundToDouble();
-          std::cerr << "\tinitial value: " << dval << "\n";
-
-          // Set initial value for integer literal
-          setValueForIntegerLiteral(varName.c_str(), dval, assignCount);
-          assignCount--;
+          // Set initial value for integer constant
+          setValueForIntegerLiteral(var,
+            constVal, m_context->assignCount);
+          m_context->assignCount--;
         }
         else
-        if (strcmp(e->getStmtClassName(), "FloatingLiteral") == 0)
+        if (e->getStmtClass() == Stmt::FloatingLiteralClass)
         {
-          std::cerr << "\tFloatingLiteral: " << "\n";
+          getErrStream() << "\tFloatingLiteral: " << "\n";
 
           const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(e);
 
           // TODO : get correct floating literal value
           double dval = FL->getValue().convertToDouble();
-          std::cerr << "\tinitial value: " << dval << "\n";
+          getErrStream() << "\tinitial value: " << dval << "\n";
 
           // Set initial value for floating literal
-          setValueForFloatingLiteral(varName.c_str(), dval, assignCount);
-          assignCount--;
+          setValueForFloatingLiteral(var,
+            dval, m_context->assignCount);
+          m_context->assignCount--;
         }
         else
-        if (strcmp(e->getStmtClassName(), "DeclRefExpr") == 0)
+        if (e->getStmtClass() == Stmt::DeclRefExprClass)
         {
           const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(e);
 
@@ -194,22 +242,21 @@ bool MyProcessStmt::VisitDeclStmt(Stmt *s)
 
             if (valueDecl)
             {
-              std::string rhsVar = valueDecl->getNameAsString();
-              std::string varType = getTypeAsString(valueDecl);
-              std::cerr << "\tidentifier = " << rhsVar << "\n";
-              std::cerr << "\ttype: " << varType << "\n";
+              VariableCount* rhsVar = getVariableSymbol(valueDecl);
+              getErrStream() << "\tidentifier = " << rhsVar->varName << "\n";
+              getErrStream() << "\ttype: " << rhsVar->varType << "\n";
 
               // set value for variable on RHS (e.g. int x=10, w=x;)
-              setValueForRHSVariable(varName.c_str(), rhsVar.c_str(),
-                varType.c_str(), assignCount);
-              assignCount--;
+              setValueForRHSVariable(var, rhsVar,
+                m_context->assignCount);
+              m_context->assignCount--;
             }
           }
         }
         else
-        if (strcmp(e->getStmtClassName(), "ImplicitCastExpr") == 0)
+        if (e->getStmtClass() == Stmt::ImplicitCastExprClass)
         {
-          std::cerr << "\tImplicitCastExpr: \n";
+          getErrStream() << "\tImplicitCastExpr: \n";
 
           const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(e);
 
@@ -218,7 +265,7 @@ bool MyProcessStmt::VisitDeclStmt(Stmt *s)
           // Get ImplicitCastExpr->LValueToRValue
           if (ICE->getCastKind() == CK_LValueToRValue)
           {
-            std::cerr << "\tLValueToRValue " << "\n";
+            getErrStream() << "\tLValueToRValue " << "\n";
 
             const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -228,15 +275,14 @@ bool MyProcessStmt::VisitDeclStmt(Stmt *s)
 
               if (valueDecl)
               {
-                std::string rhsVar = valueDecl->getNameAsString();
-                std::string varType = getTypeAsString(valueDecl);
-                std::cerr << "\tidentifier = " << rhsVar << "\n";
-                std::cerr << "\ttype: " << varType << "\n";
+                VariableCount* rhsVar = getVariableSymbol(valueDecl);
+                getErrStream() << "\tidentifier = " << rhsVar->varName << "\n";
+                getErrStream() << "\ttype: " << rhsVar->varType << "\n";
 
                 // set value for variable on RHS (e.g. int x=10, w=x;)
-                setValueForRHSVariable(varName.c_str(), rhsVar.c_str(),
-                  varType.c_str(), assignCount);
-                assignCount--;
+                setValueForRHSVariable(var, rhsVar,
+                  m_context->assignCount);
+                m_context->assignCount--;
               }
             }
           }
@@ -244,40 +290,10 @@ bool MyProcessStmt::VisitDeclStmt(Stmt *s)
           // Get ImplicitCastExpr->IntegralCast
           if (ICE->getCastKind() == CK_IntegralCast)
           {
-            std::cerr << "\tIntegralCast \n";
-
-            // IntegralCast can be CharacterLiteral or IntegerLiteral
-            // but first check for CharacterLiteral
-            if (strcmp(se->getStmtClassName(), "CharacterLiteral") == 0)
-            {
-              std::cerr << "\tCharacterLiteral: \n";
-
-              const CharacterLiteral *CL = dyn_cast<CharacterLiteral>(se);
-
-              // TODO : get correct character literal value
-              unsigned ch = CL->getValue();
-              std::cerr << "\tinitial value: " << ch << "\n";
-
-              // Set initial value for character literal
-              setValueForIntegerLiteral(varName.c_str(), (double) ch,
-                assignCount);
-              assignCount--;
-            }
-            else
-            if (strcmp(se->getStmtClassName(), "IntegerLiteral") == 0)
-            {
-              std::cerr << "\tIntegerLiteral: \n";
-
-              const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(se);
-              double dval = IL->getValue().signedRoundToDouble();
-              std::cerr << "\tinitial value: " << dval << "\n";
+            getErrStream() << "\tIntegralCast \n";
 
-              // Set initial value for integer literal
-              setValueForIntegerLiteral(varName.c_str(), dval, assignCount);
-              assignCount--;
-            }
-            else
-            if (strcmp(se->getStmtClassName(), "DeclRefExpr") == 0)
+            // literals under IntegralCast are folded as constants above
+            if (se->getStmtClass() == Stmt::DeclRefExprClass)
             {
               const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -287,15 +303,15 @@ bool MyProcessStmt::VisitDeclStmt(Stmt *s)
 
                 if (valueDecl)
                 {
-                  std::string rhsVar = valueDecl->getNameAsString();
-                  std::string varType = getTypeAsString(valueDecl);
-                  std::cerr << "\tidentifier = " << rhsVar << "\n";
-                  std::cerr << "\ttype: " << varType << "\n";
+                  VariableCount* rhsVar = getVariableSymbol(valueDecl);
+                  getErrStream() << "\tidentifier = " << rhsVar->varName
+                    << "\n";
+                  getErrStream() << "\ttype: " << rhsVar->varType << "\n";
 
                   // set value for variable on RHS (e.g. int x=10, w=x;)
-                  setValueForRHSVariable(varName.c_str(), rhsVar.c_str(),
-                    varType.c_str(), assignCount);
-                  assignCount--;
+                  setValueForRHSVariable(var, rhsVar,
+                    m_context->assignCount);
+                  m_context->assignCount--;
                 }
               }
             }
@@ -304,53 +320,59 @@ bool MyProcessStmt::VisitDeclStmt(Stmt *s)
           // Get ImplicitCastExpr->FloatingCast
           if (ICE->getCastKind() == CK_FloatingCast)
           {
-            std::cerr << "\tFloatingCast \n";
+            getErrStream() << "\tFloatingCast \n";
 
             // FloatingCast can be FloatingLiteral
-            if (strcmp(se->getStmtClassName(), "FloatingLiteral") == 0)
+            if (se->getStmtClass() == Stmt::FloatingLiteralClass)
             {
-              std::cerr << "\tFloatingLiteral: \n";
+              getErrStream() << "\tFloatingLiteral: \n";
 
               const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(se);
               double dval = FL->getValue().convertToDouble();
-              std::cerr << "\tinitial value: " << dval << "\n";
+              getErrStream() << "\tinitial value: " << dval << "\n";
 
               // Set initial value for floating literal
-              setValueForFloatingLiteral(varName.c_str(), dval, assignCount);
-              assignCount--;
+              setValueForFloatingLiteral(var,
+                dval, m_context->assignCount);
+              m_context->assignCount--;
             }
           }
 
         }  // ImplicitCastExpr ends
         else
-        if ((strcmp(e->getStmtClassName(), "BinaryOperator") == 0))
+        if ((e->getStmtClass() == Stmt::BinaryOperatorClass))
         {
-          std::string opcode = ((BinaryOperator*)e)->getOpcodeStr();
+          BinaryOperatorKind opcode = ((BinaryOperator*)e)->getOpcode();
 
-          if (strcmp(opcode.c_str(), "=") == 0)
+          if (opcode == BO_Assign)
           {
-            std::cout << "Found assignment on rhs, it is cascaded assignment.\n";
+            getOutStream()
+              << "Found assignment on rhs, it is cascaded assignment.\n";
 
-            isCascadedAssign = true;
+            m_context->isCascadedAssign = true;
           }
 
-          std::cout << "\nFound an initialization with expression on the RHS\n";
+          getOutStream()
+            << "\nFound an initialization with expression on the RHS\n";
 
           TraverseStmt((Stmt*) e);
 
-          evaluateAssignment(varName.c_str(), assignCount, m_isLastStatement);
-          assignCount--;
+          evaluateAssignment(var,
+            m_context->assignCount, m_isLastStatement);
+          m_context->assignCount--;
 
           removeTemporaryVariables();
         }
-        if ((strcmp(e->getStmtClassName(), "UnaryOperator") == 0))
+        if ((e->getStmtClass() == Stmt::UnaryOperatorClass))
         {
-          std::cout << "\nFound an initialization with Unary expression on RHS";
+          getOutStream()
+            << "\nFound an initialization with Unary expression on RHS";
 
           TraverseStmt((Stmt*) e);
 
-          evaluateAssignment(varName.c_str(), assignCount, m_isLastStatement);
-          assignCount--;
+          evaluateAssignment(var,
+            m_context->assignCount, m_isLastStatement);
+          m_context->assignCount--;
 
           removeTemporaryVariables();
         }
@@ -366,15 +388,15 @@ bool MyProcessStmt::VisitDeclStmt(Stmt *s)
 /// \brief Override visit method for array subscript
 bool MyProcessStmt::VisitArraySubscriptExpr(ArraySubscriptExpr* S)
 {
-  std::cerr <<"\n\tfound array subscript expr\n";
+  getErrStream() <<"\n\tfound array subscript expr\n";
 
   m_ignoreExpr = true;
 
   Expr *base = S->getBase();
 
-  if (strcmp(base->getStmtClassName(), "ImplicitCastExpr") == 0)
+  if (base->getStmtClass() == Stmt::ImplicitCastExprClass)
   {
-    std::cerr << "\tImplicitCastExpr: " << "\n";
+    getErrStream() << "\tImplicitCastExpr: " << "\n";
 
     const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(base);
 
@@ -383,7 +405,7 @@ bool MyProcessStmt::VisitArraySubscriptExpr(ArraySubscriptExpr* S)
     // Get ImplicitCastExpr->ArrayToPointerDecay
     if (ICE->getCastKind() == CK_ArrayToPointerDecay)
     {
-      std::cerr << "\tArrayToPointerDecay " << "\n";
+      getErrStream() << "\tArrayToPointerDecay " << "\n";
 
       const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -391,7 +413,8 @@ bool MyProcessStmt::VisitArraySubscriptExpr(ArraySubscriptExpr* S)
 
       if (valueDecl)
       {
-        std::cerr << "\tidentifier = " << valueDecl->getNameAsString() << "\n";
+        getErrStream() << "\tidentifier = " << valueDecl->getNameAsString()
+          << "\n";
       }
     }
 
@@ -399,14 +422,14 @@ bool MyProcessStmt::VisitArraySubscriptExpr(ArraySubscriptExpr* S)
 
   Expr *idx = S->getIdx();
 
-  if (strcmp(idx->getStmtClassName(), "IntegerLiteral") == 0)
+  if (idx->getStmtClass() == Stmt::IntegerLiteralClass)
   {
-    std::cerr << "\tIntegerLiteral: " << "\n";
+    getErrStream() << "\tIntegerLiteral: " << "\n";
 
     const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(idx);
     double val = IL->getValue().signedRoundToDouble();
 
-    std::cerr << "\tindex value: " << val << "\n";
+    getErrStream() << "\tindex value: " << val << "\n";
   }
   else
   {
@@ -422,10 +445,10 @@ bool MyProcessStmt::VisitArraySubscriptExpr(ArraySubscriptExpr* S)
 bool MyProcessStmt::VisitBinAssign(BinaryOperator *E)
 {
   // BO_Assign =
-  std::string opcode = E->getOpcodeStr();
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tAssignment Op " << opcode;
-  std::cerr << "  in B" << this->m_blockId << "\n";
+  BinaryOperatorKind opcode = E->getOpcode();
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tAssignment Op " << E->getOpcodeStr();
+  getErrStream() << "  in B" << this->m_blockId << "\n";
 
   // get operands of binary assignment operation
   Expr* lhs = E->getLHS();
@@ -436,17 +459,19 @@ bool MyProcessStmt::VisitBinAssign(BinaryOperator *E)
   // take care of parenthesies and implicit cast expressions on rhs
   rhs = rhs->IgnoreParenImpCasts();
 
-  std::string lhsVarName;
-  const char* lhsVarType;
+  VariableCount* lhsVar = NULL;
 
   bool rhs_found = false;
 
+  // value of an operand which is an integer constant expression
+  double constVal = 0;
+
   // increment assignCount for every assignment
-  assignCount++;
+  m_context->assignCount++;
 
   // LHS of assignment
 
-  if (strcmp(lhs->getStmtClassName(), "DeclRefExpr") == 0)
+  if (lhs->getStmtClass() == Stmt::DeclRefExprClass)
   {
     // get name and type for Expr *lhs from DeclRefExpr
     const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(lhs);
@@ -455,30 +480,40 @@ bool MyProcessStmt::VisitBinAssign(BinaryOperator *E)
 
     if (valueDecl)
     {
-      lhsVarName = valueDecl->getNameAsString();
-      lhsVarType = getTypeAsString(valueDecl).c_str();
-      std::cerr << "\tLHS identifier = " << lhsVarName << "\n";
-      std::cerr << "\ttype: " << lhsVarType << "\n";
+      lhsVar = getVariableSymbol(valueDecl);
+      getErrStream() << "\tLHS identifier = " << lhsVar->varName << "\n";
+      getErrStream() << "\ttype: " << lhsVar->varType << "\n";
     }
   }
 
   // RHS of assignment
 
-  if (strcmp(rhs->getStmtClassName(), "BinaryOperator") == 0)
+  if (rhs->getStmtClass() == Stmt::BinaryOperatorClass)
   {
-    std::string opcode = ((BinaryOperator*)rhs)->getOpcodeStr();
+    BinaryOperatorKind opcode = ((BinaryOperator*)rhs)->getOpcode();
 
     // Important Note: - if rhs of assignment is = node, then
     // it is cascaded assignment, i.e. x = y = z = w = 10;
     // Hence if we get = operator, set isCascadedAssign to true
-    if (strcmp(opcode.c_str(), "=") == 0)
+    if (opcode == BO_Assign)
     {
-      std::cout << "Found assignment on rhs, it is cascaded assignment.\n";
-      isCascadedAssign = true;
+      getOutStream() << "Found assignment on rhs, it is cascaded assignment.\n";
+      m_context->isCascadedAssign = true;
     }
   }
   else
-  if (strcmp(rhs->getStmtClassName(), "DeclRefExpr") == 0)
+  if (getIntegerConstant(rhs, constVal))
+  {
+    // literal or constant subexpression folded by clang
+    getErrStream() << "\tconstant RHS value: " << constVal << "\n";
+
+    // Set value for integer constant
+    setValueForIntegerLiteral(lhsVar, constVal, m_context->assignCount);
+    m_context->assignCount--;
+    rhs_found = true;
+  }
+  else
+  if (rhs->getStmtClass() == Stmt::DeclRefExprClass)
   {
     // get name and type for Expr *rhs from DeclRefExpr
     const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(rhs);
@@ -487,74 +522,46 @@ bool MyProcessStmt::VisitBinAssign(BinaryOperator *E)
 
     if (valueDecl)
     {
-      std::string rhsVar = valueDecl->getNameAsString();
-      std::cerr << "\tRHS identifier = " << rhsVar << "\n";
-      std::string varType = getTypeAsString(valueDecl);
-      std::cerr << "\ttype: " << varType << "\n";
+      VariableCount* rhsVar = getVariableSymbol(valueDecl);
+      getErrStream() << "\tRHS identifier = " << rhsVar->varName << "\n";
+      getErrStream() << "\ttype: " << rhsVar->varType << "\n";
 
       // set value for variable on RHS (e.g. y = x;)
-      setValueForRHSVariable(lhsVarName.c_str(), rhsVar.c_str(),
-        varType.c_str(), assignCount);
-      assignCount--;
+      setValueForRHSVariable(lhsVar, rhsVar,
+        m_context->assignCount);
+      m_context->assignCount--;
       rhs_found = true;
     }
   }
   else
-  if (strcmp(rhs->getStmtClassName(), "IntegerLiteral") == 0)
+  if (rhs->getStmtClass() == Stmt::FloatingLiteralClass)
   {
-    std::cerr << "\tIntegerLiteral: " << "\n";
-
-    const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(rhs);
-    double dval = IL->getValue().signedRoundToDouble();
-    std::cerr << "\tRHS value: " << dval << "\n";
-
-    // Set value for integer literal
-    setValueForIntegerLiteral(lhsVarName.c_str(), dval, assignCount);
-    assignCount--;
-    rhs_found = true;
-  }
-  else
-  if (strcmp(rhs->getStmtClassName(), "CharacterLiteral") == 0)
-  {
-    std::cerr << "\tCharacterLiteral:\n";
-
-    const CharacterLiteral *CL = dyn_cast<CharacterLiteral>(rhs);
-    unsigned ch = CL->getValue();
-    std::cerr << "\tRHS value: " << ch << "\n";
-
-    // Set value for character literal
-    setValueForIntegerLiteral(lhsVarName.c_str(), (double) ch, assignCount);
-    assignCount--;
-    rhs_found = true;
-  }
-  else
-  if (strcmp(rhs->getStmtClassName(), "FloatingLiteral") == 0)
-  {
-    std::cerr << "\tFloatingLiteral: " << "\n";
+    getErrStream() << "\tFloatingLiteral: " << "\n";
 
     const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(rhs);
     double dval = FL->getValue().convertToDouble();
-    std::cerr << "\tRHS value: " << dval << "\n";
+    getErrStream() << "\tRHS value: " << dval << "\n";
 
     // Set value for floating literal
-    setValueForFloatingLiteral(lhsVarName.c_str(), dval, assignCount);
-    assignCount--;
+    setValueForFloatingLiteral(lhsVar,
+      dval, m_context->assignCount);
+    m_context->assignCount--;
     rhs_found = true;
   }
   else
-  if (strcmp(rhs->getStmtClassName(), "ImplicitCastExpr") == 0)
+  if (rhs->getStmtClass() == Stmt::ImplicitCastExprClass)
   {
-    std::cerr << "\tImplicitCastExpr: " << "\n";
+    getErrStream() << "\tImplicitCastExpr: " << "\n";
 
     const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(rhs);
 
     const Expr *se = ICE->getSubExpr();
-    std::cerr << "\tCastKind: " << ICE->getCastKind() << "\n";
+    getErrStream() << "\tCastKind: " << ICE->getCastKind() << "\n";
 
     // Get ImplicitCastExpr->LValueToRValue
     if (ICE->getCastKind() == CK_LValueToRValue)
     {
-      std::cerr << "\tLValueToRValue " << "\n";
+      getErrStream() << "\tLValueToRValue " << "\n";
 
       const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -564,73 +571,37 @@ bool MyProcessStmt::VisitBinAssign(BinaryOperator *E)
 
         if (valueDecl)
         {
-          std::string rhsVar = valueDecl->getNameAsString();
-          std::string varType = getTypeAsString(valueDecl);
-          std::cerr << "\tRHS identifier = " << rhsVar << "\n";
-          std::cerr << "\ttype: " << varType << "\n";
+          VariableCount* rhsVar = getVariableSymbol(valueDecl);
+          getErrStream() << "\tRHS identifier = " << rhsVar->varName << "\n";
+          getErrStream() << "\ttype: " << rhsVar->varType << "\n";
 
           // set value for variable on RHS (e.g. y = x;)
-          setValueForRHSVariable(lhsVarName.c_str(), rhsVar.c_str(),
-            varType.c_str(), assignCount);
-          assignCount--;
+          setValueForRHSVariable(lhsVar, rhsVar,
+            m_context->assignCount);
+          m_context->assignCount--;
           rhs_found = true;
         }
       }
     }
     else
-    // Get ImplicitCastExpr->IntegralCast
-    if (ICE->getCastKind() == CK_IntegralCast)
-    {
-      std::cerr << "\tIntegralCast \n";
-
-      // IntegralCast can be CharacterLiteral or IntegerLiteral
-      // i.e. unsigned int x = 0; or char c = 'a';
-      if (strcmp(se->getStmtClassName(), "CharacterLiteral") == 0)
-      {
-        std::cerr << "\tCharacterLiteral:\n";
-
-        const CharacterLiteral *CL = dyn_cast<CharacterLiteral>(se);
-        unsigned ch = CL->getValue();
-        std::cerr << "\tRHS value: " << ch << "\n";
-
-        // Set value for character literal
-        setValueForIntegerLiteral(lhsVarName.c_str(), (double) ch, assignCount);
-        assignCount--;
-        rhs_found = true;
-      }
-      else
-      if (strcmp(se->getStmtClassName(), "IntegerLiteral") == 0)
-      {
-        std::cerr << "\tIntegerLiteral:\n";
-
-        const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(se);
-        double dval = IL->getValue().signedRoundToDouble();
-        std::cerr << "\tRHS value: " << dval << "\n";
-
-        // Set value for integer literal
-        setValueForIntegerLiteral(lhsVarName.c_str(), dval, assignCount);
-        assignCount--;
-        rhs_found = true;
-      }
-    }
-    else
     // Get ImplicitCastExpr->FloatingCast
     if (ICE->getCastKind() == CK_FloatingCast)
     {
-      std::cerr << "\tFloatingCast \n";
+      getErrStream() << "\tFloatingCast \n";
 
       // FloatingCast can be FloatingLiteral
-      if (strcmp(se->getStmtClassName(), "FloatingLiteral") == 0)
+      if (se->getStmtClass() == Stmt::FloatingLiteralClass)
       {
-        std::cerr << "\tFloatingLiteral: \n";
+        getErrStream() << "\tFloatingLiteral: \n";
 
         const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(se);
         double dval = FL->getValue().convertToDouble();
-        std::cerr << "\tinitial value: " << dval << "\n";
+        getErrStream() << "\tinitial value: " << dval << "\n";
 
         // Set value for floating literal
-        setValueForFloatingLiteral(lhsVarName.c_str(), dval, assignCount);
-        assignCount--;
+        setValueForFloatingLiteral(lhsVar,
+          dval, m_context->assignCount);
+        m_context->assignCount--;
         rhs_found = true;
       }
     }
@@ -646,11 +617,12 @@ bool MyProcessStmt::VisitBinAssign(BinaryOperator *E)
 
     // now evaluate assignment by taking rhs expression from list
     // and updating abstract value for lhs identifier
-    evaluateAssignment(lhsVarName.c_str(), assignCount, m_isLastStatement);
+    evaluateAssignment(lhsVar,
+      m_context->assignCount, m_isLastStatement);
 
-    assignCount--;
+    m_context->assignCount--;
 
-    if (isCascadedAssign == false)
+    if (m_context->isCascadedAssign == false)
     {
       removeTemporaryVariables();
     }
@@ -658,7 +630,7 @@ bool MyProcessStmt::VisitBinAssign(BinaryOperator *E)
   }
 
   // remove temporary variables after all assignments are done
-  if (assignCount == 0)
+  if (m_context->assignCount == 0)
   {
     removeTemporaryVariables();
   }
@@ -667,8 +639,12 @@ bool MyProcessStmt::VisitBinAssign(BinaryOperator *E)
   // struct, pointers, etc)
   if (this->m_ignoreExpr)
   {
-    std::cerr << "\n found ignoreExpr! \n";
-    lhs->dump();
+    getErrStream() << "\n found ignoreExpr! \n";
+
+    // dump uses SourceManager, which is shared by analysis threads
+    std::lock_guard<std::mutex> lock(getSourceManagerMutex());
+    FileRawOstream errStream(getErrFile());
+    lhs->dump(errStream, m_compilerInstance->getSourceManager());
   }
 
   // That's all! we are done, no need to go down further in AST, return false
@@ -679,7 +655,7 @@ bool MyProcessStmt::VisitBinAssign(BinaryOperator *E)
 void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
 {
   // get arithmetic operator
-  std::string opcode = E->getOpcodeStr();
+  BinaryOperatorKind opcode = E->getOpcode();
 
   // get LHS and RHS of binary operator
   Expr* lhs = E->getLHS();
@@ -690,16 +666,28 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
   // take care of parenthesies and implicit cast expressions on rhs
   rhs = rhs->IgnoreParenImpCasts();
 
-  std::string lhsVarName;
-  std::string lhsVarType;
+  VariableCount* lhsVar = NULL;
 
   // lhsFound (or rhsFound)
   // - a flag to denote lhs (or rhs) literal/identifier found
   int lhsFound = 0, rhsFound = 0;
 
+  // value of an operand which is an integer constant expression
+  double constVal = 0;
+
   // LHS of binary operator
 
-  if (strcmp(lhs->getStmtClassName(), "DeclRefExpr") == 0)
+  if (getIntegerConstant(lhs, constVal))
+  {
+    // literal or constant subexpression folded by clang
+    getErrStream() << "\tconstant LHS value: " << constVal << "\n";
+
+    getIntegerLiteral(constVal);
+
+    lhsFound = 1;
+  }
+  else
+  if (lhs->getStmtClass() == Stmt::DeclRefExprClass)
   {
     // get name and type for Expr *lhs from DeclRefExpr
     const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(lhs);
@@ -708,48 +696,33 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
 
     if (valueDecl)
     {
-      std::string varName = valueDecl->getNameAsString();
-      std::string varType = getTypeAsString(valueDecl);
-      std::cerr << "\tLHS identifier = " << varName << "\n";
-      std::cerr << "\ttype: " << varType << "\n";
+      VariableCount* var = getVariableSymbol(valueDecl);
+      getErrStream() << "\tLHS identifier = " << var->varName << "\n";
+      getErrStream() << "\ttype: " << var->varType << "\n";
 
-      getVariable(varName.c_str(), varType.c_str());
+      getVariable(var);
 
       lhsFound = 1;
     }
   }
   else
-  if (strcmp(lhs->getStmtClassName(), "IntegerLiteral") == 0)
-  {
-    std::cerr << "\tIntegerLiteral: " << "\n";
-
-    const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(lhs);
-
-    double dval = IL->getValue().signedRoundToDouble();
-    std::cerr << "\tLHS value: " << dval << "\n";
-
-    getIntegerLiteral(dval);
-
-    lhsFound = 1;
-  }
-  else
-  if (strcmp(lhs->getStmtClassName(), "FloatingLiteral") == 0)
+  if (lhs->getStmtClass() == Stmt::FloatingLiteralClass)
   {
-    std::cerr << "\tFloatingLiteral: " << "\n";
+    getErrStream() << "\tFloatingLiteral: " << "\n";
 
     const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(lhs);
 
     double dval = FL->getValue().convertToDouble();
-    std::cerr << "\tLHS value: " << dval << "\n";
+    getErrStream() << "\tLHS value: " << dval << "\n";
 
     getFloatingLiteral(dval);
 
     lhsFound = 1;
   }
   else
-  if (strcmp(lhs->getStmtClassName(), "ImplicitCastExpr") == 0)
+  if (lhs->getStmtClass() == Stmt::ImplicitCastExprClass)
   {
-    std::cerr << "\tImplicitCastExpr: " << "\n";
+    getErrStream() << "\tImplicitCastExpr: " << "\n";
 
     const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(lhs);
 
@@ -757,7 +730,7 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
 
     if (ICE->getCastKind() == CK_LValueToRValue)
     {
-      std::cerr << "\tLValueToRValue " << "\n";
+      getErrStream() << "\tLValueToRValue " << "\n";
 
       const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -765,12 +738,11 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
 
       if (valueDecl)
       {
-        std::string varName = valueDecl->getNameAsString();
-        std::string varType = getTypeAsString(valueDecl);
-        std::cerr << "\tLHS identifier = " << varName << "\n";
-        std::cerr << "\ttype: " << varType << "\n";
+        VariableCount* var = getVariableSymbol(valueDecl);
+        getErrStream() << "\tLHS identifier = " << var->varName << "\n";
+        getErrStream() << "\ttype: " << var->varType << "\n";
 
-        getVariable(varName.c_str(), varType.c_str());
+        getVariable(var);
 
         lhsFound = 1;
       }
@@ -778,20 +750,18 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
     else
     if (ICE->getCastKind() == CK_IntegralCast)
     {
-      std::cerr << "\tIntegralCast " << "\n";
+      getErrStream() << "\tIntegralCast " << "\n";
 
       se = se->IgnoreParenImpCasts();
 
       // Under ImplicitCastExpr - IntegralCast can be as follows:
       // int x,y; unsigned int ui;
-      // x = ui + 1; <- ICE->IntegralCast->IntegerLiteral on rhs
-      // x = 1 + ui; <- ICE->IntegralCast->IntegerLiteral on lhs
       // x = ui + y; <- ICE->IntegralCast->ICE->LValueToRValue->DeclRefExpr on rhs
       // x = y + ui; <- ICE->IntegralCast->ICE->LValueToRValue->DeclRefExpr on lhs
       // see AST dump for these examples
-      if (strcmp(se->getStmtClassName(), "DeclRefExpr") == 0)
+      if (se->getStmtClass() == Stmt::DeclRefExprClass)
       {
-        std::cerr << "\nICE->IntegralCast->DeclRefExpr\n";
+        getErrStream() << "\nICE->IntegralCast->DeclRefExpr\n";
 
         const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -799,56 +769,27 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
 
         if (valueDecl)
         {
-          std::string varName = valueDecl->getNameAsString();
-          std::string varType = getTypeAsString(valueDecl);
-          std::cerr << "\tLHS identifier = " << varName << "\n";
-          std::cerr << "\ttype: " << varType << "\n";
+          VariableCount* var = getVariableSymbol(valueDecl);
+          getErrStream() << "\tLHS identifier = " << var->varName << "\n";
+          getErrStream() << "\ttype: " << var->varType << "\n";
 
-          getVariable(varName.c_str(), varType.c_str());
+          getVariable(var);
 
           lhsFound = 1;
         }
       }
-      else
-      if (strcmp(se->getStmtClassName(), "IntegerLiteral") == 0)
-      {
-        std::cerr << "\nICE->IntegralCast->IntegerLiteral\n";
-
-        const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(se);
-
-        double dval = IL->getValue().signedRoundToDouble();
-        std::cerr << "\tLHS value: " << dval << "\n";
-
-        getIntegerLiteral(dval);
-
-        lhsFound = 1;
-      }
-      else
-      if (strcmp(se->getStmtClassName(), "CharacterLiteral") == 0)
-      {
-        std::cerr << "\nICE->IntegralCast->CharacterLiteral\n";
-
-        const CharacterLiteral *CL = dyn_cast<CharacterLiteral>(se);
-
-        unsigned ch = CL->getValue();
-        std::cerr << "\tLHS value: " << ch << "\n";
-
-        getIntegerLiteral((double)ch);
-
-        lhsFound = 1;
-      }
 
     } // IntegralCast ends
     else
     if (ICE->getCastKind() == CK_FloatingCast)
     {
-      std::cerr << "\tFloatingCast \n";
+      getErrStream() << "\tFloatingCast \n";
 
       se = se->IgnoreParenImpCasts();
 
-      if (strcmp(se->getStmtClassName(), "DeclRefExpr") == 0)
+      if (se->getStmtClass() == Stmt::DeclRefExprClass)
       {
-        std::cout << "\nICE->FloatingCast->DeclRefExpr\n";
+        getOutStream() << "\nICE->FloatingCast->DeclRefExpr\n";
 
         const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -856,24 +797,23 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
 
         if (valueDecl)
         {
-          std::string varName = valueDecl->getNameAsString();
-          std::string varType = getTypeAsString(valueDecl);
-          std::cerr << "\tLHS identifier = " << varName << "\n";
-          std::cerr << "\ttype: " << varType << "\n";
+          VariableCount* var = getVariableSymbol(valueDecl);
+          getErrStream() << "\tLHS identifier = " << var->varName << "\n";
+          getErrStream() << "\ttype: " << var->varType << "\n";
 
-          getVariable(varName.c_str(), varType.c_str());
+          getVariable(var);
 
           lhsFound = 1;
         }
       }
       else
-      if (strcmp(se->getStmtClassName(), "FloatingLiteral") == 0)
+      if (se->getStmtClass() == Stmt::FloatingLiteralClass)
       {
-        std::cout << "\nICE->FloatingCast->FloatingLiteral\n";
+        getOutStream() << "\nICE->FloatingCast->FloatingLiteral\n";
 
         const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(se);
         double dval = FL->getValue().convertToDouble();
-        std::cerr << "\tLHS value: " << dval << "\n";
+        getErrStream() << "\tLHS value: " << dval << "\n";
 
         getFloatingLiteral(dval);
 
@@ -882,8 +822,8 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
     } // FloatingCast ends
     else
     {
-      std::cout << "\nTough Luck in ImplicitCastExpr on lhs!\n";
-      std::cout << "\ngot " << ICE->getCastKind() << "\n";
+      getOutStream() << "\nTough Luck in ImplicitCastExpr on lhs!\n";
+      getOutStream() << "\ngot " << ICE->getCastKind() << "\n";
     }
 
   }  // ImplicitCastExpr ends
@@ -891,22 +831,22 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
   // if lhs operand not found, recursively traverse AST for lhs
   if (!lhsFound)
   {
-    std::cout << "\n!lhsFound\n";
-    std::cout << "\nCannot determine lhs -> we are at operator node\n";
+    getOutStream() << "\n!lhsFound\n";
+    getOutStream() << "\nCannot determine lhs -> we are at operator node\n";
 
     // if lhs is again operator node in AST, get StmtClass of operation
     // cast it appropriately and print operator
 
-    std::cout << lhs->getStmtClassName() << "\n";
+    getOutStream() << lhs->getStmtClassName() << "\n";
 
-    if (strcmp(lhs->getStmtClassName(), "BinaryOperator") == 0)
+    if (lhs->getStmtClass() == Stmt::BinaryOperatorClass)
     {
-      std::cout << ((BinaryOperator*)lhs)->getOpcodeStr() << "\n";
+      getOutStream() << ((BinaryOperator*)lhs)->getOpcodeStr() << "\n";
     }
     else
-    if (strcmp(lhs->getStmtClassName(), "UnaryOperator") == 0)
+    if (lhs->getStmtClass() == Stmt::UnaryOperatorClass)
     {
-      std::cout << ((UnaryOperator*)lhs)->getOpcodeStr(
+      getOutStream() << ((UnaryOperator*)lhs)->getOpcodeStr(
         ((UnaryOperator*)lhs)->getOpcode()) << "\n";
     }
 
@@ -916,7 +856,17 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
 
   // RHS of binary operator
 
-  if (strcmp(rhs->getStmtClassName(), "DeclRefExpr") == 0)
+  if (getIntegerConstant(rhs, constVal))
+  {
+    // literal or constant subexpression folded by clang
+    getErrStream() << "\tconstant RHS value: " << constVal << "\n";
+
+    getIntegerLiteral(constVal);
+
+    rhsFound = 1;
+  }
+  else
+  if (rhs->getStmtClass() == Stmt::DeclRefExprClass)
   {
     // get name and type for Expr *rhs from DeclRefExpr
     const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(rhs);
@@ -925,48 +875,33 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
 
     if (valueDecl)
     {
-      std::string varName = valueDecl->getNameAsString();
-      std::string varType = getTypeAsString(valueDecl);
-      std::cerr << "\tRHS identifier = " << varName << "\n";
-      std::cerr << "\ttype: " << varType << "\n";
+      VariableCount* var = getVariableSymbol(valueDecl);
+      getErrStream() << "\tRHS identifier = " << var->varName << "\n";
+      getErrStream() << "\ttype: " << var->varType << "\n";
 
-      getVariable(varName.c_str(), varType.c_str());
+      getVariable(var);
 
       rhsFound = 1;
     }
   }
   else
-  if (strcmp(rhs->getStmtClassName(), "IntegerLiteral") == 0)
-  {
-    std::cerr << "\tIntegerLiteral: " << "\n";
-
-    const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(rhs);
-
-    double dval = IL->getValue().signedRoundToDouble();
-    std::cerr << "\tRHS value: " << dval << "\n";
-
-    getIntegerLiteral(dval);
-
-    rhsFound = 1;
-  }
-  else
-  if (strcmp(rhs->getStmtClassName(), "FloatingLiteral") == 0)
+  if (rhs->getStmtClass() == Stmt::FloatingLiteralClass)
   {
-    std::cerr << "\tFloatingLiteral: " << "\n";
+    getErrStream() << "\tFloatingLiteral: " << "\n";
 
     const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(rhs);
 
     double dval = FL->getValue().convertToDouble();
-    std::cerr << "\tRHS value: " << dval << "\n";
+    getErrStream() << "\tRHS value: " << dval << "\n";
 
     getFloatingLiteral(dval);
 
     rhsFound = 1;
   }
   else
-  if (strcmp(rhs->getStmtClassName(), "ImplicitCastExpr") == 0)
+  if (rhs->getStmtClass() == Stmt::ImplicitCastExprClass)
   {
-    std::cerr << "\tImplicitCastExpr: " << "\n";
+    getErrStream() << "\tImplicitCastExpr: " << "\n";
 
     const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(rhs);
 
@@ -974,7 +909,7 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
 
     if (ICE->getCastKind() == CK_LValueToRValue)
     {
-      std::cerr << "\tLValueToRValue " << "\n";
+      getErrStream() << "\tLValueToRValue " << "\n";
 
       const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -982,12 +917,11 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
 
       if (valueDecl)
       {
-        std::string varName = valueDecl->getNameAsString();
-        std::string varType = getTypeAsString(valueDecl);
-        std::cerr << "\tRHS identifier = " << varName << "\n";
-        std::cerr << "\ttype: " << varType << "\n";
+        VariableCount* var = getVariableSymbol(valueDecl);
+        getErrStream() << "\tRHS identifier = " << var->varName << "\n";
+        getErrStream() << "\ttype: " << var->varType << "\n";
 
-        getVariable(varName.c_str(), varType.c_str());
+        getVariable(var);
  
         rhsFound = 1;
       }
@@ -995,13 +929,13 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
     else
     if (ICE->getCastKind() == CK_IntegralCast)
     {
-      std::cerr << "\tIntegralCast " << "\n";
+      getErrStream() << "\tIntegralCast " << "\n";
 
       se = se->IgnoreParenImpCasts();
 
-      if (strcmp(se->getStmtClassName(), "DeclRefExpr") == 0)
+      if (se->getStmtClass() == Stmt::DeclRefExprClass)
       {
-        std::cout << "\nICE->IntegralCast->DeclRefExpr\n";
+        getOutStream() << "\nICE->IntegralCast->DeclRefExpr\n";
 
         const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -1009,56 +943,27 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
 
         if (valueDecl)
         {
-          std::string varName = valueDecl->getNameAsString();
-          std::string varType = getTypeAsString(valueDecl);
-          std::cerr << "\tRHS identifier = " << varName << "\n";
-          std::cerr << "\ttype: " << varType << "\n";
+          VariableCount* var = getVariableSymbol(valueDecl);
+          getErrStream() << "\tRHS identifier = " << var->varName << "\n";
+          getErrStream() << "\ttype: " << var->varType << "\n";
 
-          getVariable(varName.c_str(), varType.c_str());
+          getVariable(var);
 
           rhsFound = 1;
         }
       }
-      else
-      if (strcmp(se->getStmtClassName(), "IntegerLiteral") == 0)
-      {
-        std::cout << "\nICE->IntegralCast->IntegerLiteral\n";
-
-        const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(se);
-
-        double dval = IL->getValue().signedRoundToDouble();
-        std::cerr << "\tRHS value: " << dval << "\n";
-
-        getIntegerLiteral(dval);
-
-        rhsFound = 1;
-      }
-      else
-      if (strcmp(se->getStmtClassName(), "CharacterLiteral") == 0)
-      {
-        std::cerr << "\nICE->IntegralCast->CharacterLiteral\n";
-
-        const CharacterLiteral *CL = dyn_cast<CharacterLiteral>(se);
-
-        unsigned ch = CL->getValue();
-        std::cerr << "\tRHS value: " << ch << "\n";
-
-        getIntegerLiteral((double)ch);
-
-        rhsFound = 1;
-      }
 
     } // IntegralCast ends
     else
     if (ICE->getCastKind() == CK_FloatingCast)
     {
-      std::cerr << "\tFloatingCast \n";
+      getErrStream() << "\tFloatingCast \n";
 
       se = se->IgnoreParenImpCasts();
 
-      if (strcmp(se->getStmtClassName(), "DeclRefExpr") == 0)
+      if (se->getStmtClass() == Stmt::DeclRefExprClass)
       {
-        std::cout << "\nICE->FloatingCast->DeclRefExpr\n";
+        getOutStream() << "\nICE->FloatingCast->DeclRefExpr\n";
 
         const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -1066,24 +971,23 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
 
         if (valueDecl)
         {
-          std::string varName = valueDecl->getNameAsString();
-          std::string varType = getTypeAsString(valueDecl);
-          std::cerr << "\tRHS identifier = " << varName << "\n";
-          std::cerr << "\ttype: " << varType << "\n";
+          VariableCount* var = getVariableSymbol(valueDecl);
+          getErrStream() << "\tRHS identifier = " << var->varName << "\n";
+          getErrStream() << "\ttype: " << var->varType << "\n";
 
-          getVariable(varName.c_str(), varType.c_str());
+          getVariable(var);
 
           rhsFound = 1;
         }
       }
       else
-      if (strcmp(se->getStmtClassName(), "FloatingLiteral") == 0)
+      if (se->getStmtClass() == Stmt::FloatingLiteralClass)
       {
-        std::cout << "\nICE->FloatingCast->FloatingLiteral\n";
+        getOutStream() << "\nICE->FloatingCast->FloatingLiteral\n";
 
         const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(se);
         double dval = FL->getValue().convertToDouble();
-        std::cerr << "\tRHS value: " << dval << "\n";
+        getErrStream() << "\tRHS value: " << dval << "\n";
 
         getFloatingLiteral(dval);
 
@@ -1092,8 +996,8 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
     } // FloatingCast ends
     else
     {
-      std::cout << "\nTough Luck in ImplicitCastExpr on rhs!\n";
-      std::cout << "\ngot " << ICE->getCastKind() << "\n";
+      getOutStream() << "\nTough Luck in ImplicitCastExpr on rhs!\n";
+      getOutStream() << "\ngot " << ICE->getCastKind() << "\n";
     }
 
   }  // ImplicitCastExpr ends
@@ -1101,22 +1005,22 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
   // if rhs operand not found, recursively traverse AST for rhs
   if (!rhsFound)
   {
-    std::cout << "\n!rhsFound\n";
-    std::cout << "\nCannot determine rhs -> we are at operator node\n";
+    getOutStream() << "\n!rhsFound\n";
+    getOutStream() << "\nCannot determine rhs -> we are at operator node\n";
 
     // if rhs is again operator node in AST, get StmtClass of operation
     // cast it appropriately and print operator
 
-    std::cout << rhs->getStmtClassName() << "\n";
+    getOutStream() << rhs->getStmtClassName() << "\n";
 
-    if (strcmp(rhs->getStmtClassName(), "BinaryOperator") == 0)
+    if (rhs->getStmtClass() == Stmt::BinaryOperatorClass)
     {
-      std::cout << ((BinaryOperator*)rhs)->getOpcodeStr() << "\n";
+      getOutStream() << ((BinaryOperator*)rhs)->getOpcodeStr() << "\n";
     }
     else
-    if (strcmp(rhs->getStmtClassName(), "UnaryOperator") == 0)
+    if (rhs->getStmtClass() == Stmt::UnaryOperatorClass)
     {
-      std::cout << ((UnaryOperator*)rhs)->getOpcodeStr(
+      getOutStream() << ((UnaryOperator*)rhs)->getOpcodeStr(
         ((UnaryOperator*)rhs)->getOpcode()) << "\n";
     }
 
@@ -1125,7 +1029,7 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
   }
 
   // create a single expression for current opcode
-  createSingleExpressionForBinOp(opcode.c_str());
+  createSingleExpressionForBinOp(opcode);
 }
 
 // Override visit methods for arithmetic operators +, -, *, /, %
@@ -1134,8 +1038,8 @@ void MyProcessStmt::getLHSAndRHSForBO(BinaryOperator* E)
 bool MyProcessStmt::VisitBinAdd(BinaryOperator* E)
 {
   // BO_Add +
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tAdditive Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tAdditive Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForBO(E);
 
@@ -1146,8 +1050,8 @@ bool MyProcessStmt::VisitBinAdd(BinaryOperator* E)
 bool MyProcessStmt::VisitBinSub(BinaryOperator* E)
 {
   // BO_Sub -
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tAdditive Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tAdditive Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForBO(E);
 
@@ -1158,8 +1062,8 @@ bool MyProcessStmt::VisitBinSub(BinaryOperator* E)
 bool MyProcessStmt::VisitBinMul(BinaryOperator* E)
 {
   // BO_Mul *
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tMultiplicative Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tMultiplicative Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForBO(E);
 
@@ -1170,8 +1074,8 @@ bool MyProcessStmt::VisitBinMul(BinaryOperator* E)
 bool MyProcessStmt::VisitBinDiv(BinaryOperator* E)
 {
   // BO_Div /
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tMultiplicative Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tMultiplicative Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForBO(E);
 
@@ -1182,8 +1086,8 @@ bool MyProcessStmt::VisitBinDiv(BinaryOperator* E)
 bool MyProcessStmt::VisitBinRem(BinaryOperator* E)
 {
   // BO_Div %
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tMultiplicative Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tMultiplicative Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForBO(E);
 
@@ -1194,7 +1098,7 @@ bool MyProcessStmt::VisitBinRem(BinaryOperator* E)
 void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
 {
   // get arithmetic operator
-  std::string opcode = E->getOpcodeStr();
+  BinaryOperatorKind opcode = E->getOpcode();
 
   // get LHS and RHS of binary operator
   Expr* lhs = E->getLHS();
@@ -1205,16 +1109,28 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
   // take care of parenthesies and implicit cast expressions on rhs
   rhs = rhs->IgnoreParenImpCasts();
 
-  std::string lhsVarName;
-  std::string lhsVarType;
+  VariableCount* lhsVar = NULL;
 
   // lhsFound (or rhsFound)
   // - a flag to denote lhs (or rhs) literal/identifier found
   int lhsFound = 0, rhsFound = 0;
 
+  // value of an operand which is an integer constant expression
+  double constVal = 0;
+
   // LHS of binary operator
 
-  if (strcmp(lhs->getStmtClassName(), "DeclRefExpr") == 0)
+  if (getIntegerConstant(lhs, constVal))
+  {
+    // literal or constant subexpression folded by clang
+    getErrStream() << "\tconstant LHS value: " << constVal << "\n";
+
+    getIntegerLiteral(constVal);
+
+    lhsFound = 1;
+  }
+  else
+  if (lhs->getStmtClass() == Stmt::DeclRefExprClass)
   {
     // get name and type for Expr *lhs from DeclRefExpr
     const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(lhs);
@@ -1223,48 +1139,33 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
 
     if (valueDecl)
     {
-      std::string varName = valueDecl->getNameAsString();
-      std::string varType = getTypeAsString(valueDecl);
-      std::cerr << "\tLHS identifier = " << varName << "\n";
-      std::cerr << "\ttype: " << varType << "\n";
+      VariableCount* var = getVariableSymbol(valueDecl);
+      getErrStream() << "\tLHS identifier = " << var->varName << "\n";
+      getErrStream() << "\ttype: " << var->varType << "\n";
 
-      getVariable(varName.c_str(), varType.c_str());
+      getVariable(var);
 
       lhsFound = 1;
     }
   }
   else
-  if (strcmp(lhs->getStmtClassName(), "IntegerLiteral") == 0)
-  {
-    std::cerr << "\tIntegerLiteral: " << "\n";
-
-    const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(lhs);
-
-    double dval = IL->getValue().signedRoundToDouble();
-    std::cerr << "\tLHS value: " << dval << "\n";
-
-    getIntegerLiteral(dval);
-
-    lhsFound = 1;
-  }
-  else
-  if (strcmp(lhs->getStmtClassName(), "FloatingLiteral") == 0)
+  if (lhs->getStmtClass() == Stmt::FloatingLiteralClass)
   {
-    std::cerr << "\tFloatingLiteral: " << "\n";
+    getErrStream() << "\tFloatingLiteral: " << "\n";
 
     const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(lhs);
 
     double dval = FL->getValue().convertToDouble();
-    std::cerr << "\tLHS value: " << dval << "\n";
+    getErrStream() << "\tLHS value: " << dval << "\n";
 
     getFloatingLiteral(dval);
 
     lhsFound = 1;
   }
   else
-  if (strcmp(lhs->getStmtClassName(), "ImplicitCastExpr") == 0)
+  if (lhs->getStmtClass() == Stmt::ImplicitCastExprClass)
   {
-    std::cerr << "\tImplicitCastExpr: " << "\n";
+    getErrStream() << "\tImplicitCastExpr: " << "\n";
 
     const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(lhs);
 
@@ -1272,7 +1173,7 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
 
     if (ICE->getCastKind() == CK_LValueToRValue)
     {
-      std::cerr << "\tLValueToRValue " << "\n";
+      getErrStream() << "\tLValueToRValue " << "\n";
 
       const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -1280,12 +1181,11 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
 
       if (valueDecl)
       {
-        std::string varName = valueDecl->getNameAsString();
-        std::string varType = getTypeAsString(valueDecl);
-        std::cerr << "\tLHS identifier = " << varName << "\n";
-        std::cerr << "\ttype: " << varType << "\n";
+        VariableCount* var = getVariableSymbol(valueDecl);
+        getErrStream() << "\tLHS identifier = " << var->varName << "\n";
+        getErrStream() << "\ttype: " << var->varType << "\n";
 
-        getVariable(varName.c_str(), varType.c_str());
+        getVariable(var);
 
         lhsFound = 1;
       }
@@ -1293,20 +1193,18 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
     else
     if (ICE->getCastKind() == CK_IntegralCast)
     {
-      std::cerr << "\tIntegralCast " << "\n";
+      getErrStream() << "\tIntegralCast " << "\n";
 
       se = se->IgnoreParenImpCasts();
 
       // Under ImplicitCastExpr - IntegralCast can be as follows:
       // int x,y; unsigned int ui;
-      // x = ui + 1; <- ICE->IntegralCast->IntegerLiteral on rhs
-      // x = 1 + ui; <- ICE->IntegralCast->IntegerLiteral on lhs
       // x = ui + y; <- ICE->IntegralCast->ICE->LValueToRValue->DeclRefExpr on rhs
       // x = y + ui; <- ICE->IntegralCast->ICE->LValueToRValue->DeclRefExpr on lhs
       // see AST dump for these examples
-      if (strcmp(se->getStmtClassName(), "DeclRefExpr") == 0)
+      if (se->getStmtClass() == Stmt::DeclRefExprClass)
       {
-        std::cerr << "\nICE->IntegralCast->DeclRefExpr\n";
+        getErrStream() << "\nICE->IntegralCast->DeclRefExpr\n";
 
         const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -1314,56 +1212,27 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
 
         if (valueDecl)
         {
-          std::string varName = valueDecl->getNameAsString();
-          std::string varType = getTypeAsString(valueDecl);
-          std::cerr << "\tLHS identifier = " << varName << "\n";
-          std::cerr << "\ttype: " << varType << "\n";
+          VariableCount* var = getVariableSymbol(valueDecl);
+          getErrStream() << "\tLHS identifier = " << var->varName << "\n";
+          getErrStream() << "\ttype: " << var->varType << "\n";
 
-          getVariable(varName.c_str(), varType.c_str());
+          getVariable(var);
 
           lhsFound = 1;
         }
       }
-      else
-      if (strcmp(se->getStmtClassName(), "IntegerLiteral") == 0)
-      {
-        std::cerr << "\nICE->IntegralCast->IntegerLiteral\n";
-
-        const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(se);
-
-        double dval = IL->getValue().signedRoundToDouble();
-        std::cerr << "\tLHS value: " << dval << "\n";
-
-        getIntegerLiteral(dval);
-
-        lhsFound = 1;
-      }
-      else
-      if (strcmp(se->getStmtClassName(), "CharacterLiteral") == 0)
-      {
-        std::cerr << "\nICE->IntegralCast->CharacterLiteral\n";
-
-        const CharacterLiteral *CL = dyn_cast<CharacterLiteral>(se);
-
-        unsigned ch = CL->getValue();
-        std::cerr << "\tLHS value: " << ch << "\n";
-
-        getIntegerLiteral((double)ch);
-
-        lhsFound = 1;
-      }
 
     } // IntegralCast ends
     else
     if (ICE->getCastKind() == CK_FloatingCast)
     {
-      std::cerr << "\tFloatingCast \n";
+      getErrStream() << "\tFloatingCast \n";
 
       se = se->IgnoreParenImpCasts();
 
-      if (strcmp(se->getStmtClassName(), "DeclRefExpr") == 0)
+      if (se->getStmtClass() == Stmt::DeclRefExprClass)
       {
-        std::cout << "\nICE->FloatingCast->DeclRefExpr\n";
+        getOutStream() << "\nICE->FloatingCast->DeclRefExpr\n";
 
         const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -1371,24 +1240,23 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
 
         if (valueDecl)
         {
-          std::string varName = valueDecl->getNameAsString();
-          std::string varType = getTypeAsString(valueDecl);
-          std::cerr << "\tLHS identifier = " << varName << "\n";
-          std::cerr << "\ttype: " << varType << "\n";
+          VariableCount* var = getVariableSymbol(valueDecl);
+          getErrStream() << "\tLHS identifier = " << var->varName << "\n";
+          getErrStream() << "\ttype: " << var->varType << "\n";
 
-          getVariable(varName.c_str(), varType.c_str());
+          getVariable(var);
 
           lhsFound = 1;
         }
       }
       else
-      if (strcmp(se->getStmtClassName(), "FloatingLiteral") == 0)
+      if (se->getStmtClass() == Stmt::FloatingLiteralClass)
       {
-        std::cout << "\nICE->FloatingCast->FloatingLiteral\n";
+        getOutStream() << "\nICE->FloatingCast->FloatingLiteral\n";
 
         const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(se);
         double dval = FL->getValue().convertToDouble();
-        std::cerr << "\tLHS value: " << dval << "\n";
+        getErrStream() << "\tLHS value: " << dval << "\n";
 
         getFloatingLiteral(dval);
 
@@ -1397,8 +1265,8 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
     } // FloatingCast ends
     else
     {
-      std::cout << "\nTough Luck in ImplicitCastExpr on lhs!\n";
-      std::cout << "\ngot " << ICE->getCastKind() << "\n";
+      getOutStream() << "\nTough Luck in ImplicitCastExpr on lhs!\n";
+      getOutStream() << "\ngot " << ICE->getCastKind() << "\n";
     }
 
   }  // ImplicitCastExpr ends
@@ -1406,22 +1274,22 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
   // if lhs operand not found, recursively traverse AST for lhs
   if (!lhsFound)
   {
-    std::cout << "\n!lhsFound\n";
-    std::cout << "\nCannot determine lhs -> we are at operator node\n";
+    getOutStream() << "\n!lhsFound\n";
+    getOutStream() << "\nCannot determine lhs -> we are at operator node\n";
 
     // if lhs is again operator node in AST, get StmtClass of operation
     // cast it appropriately and print operator
 
-    std::cout << lhs->getStmtClassName() << "\n";
+    getOutStream() << lhs->getStmtClassName() << "\n";
 
-    if (strcmp(lhs->getStmtClassName(), "BinaryOperator") == 0)
+    if (lhs->getStmtClass() == Stmt::BinaryOperatorClass)
     {
-      std::cout << ((BinaryOperator*)lhs)->getOpcodeStr() << "\n";
+      getOutStream() << ((BinaryOperator*)lhs)->getOpcodeStr() << "\n";
     }
     else
-    if (strcmp(lhs->getStmtClassName(), "UnaryOperator") == 0)
+    if (lhs->getStmtClass() == Stmt::UnaryOperatorClass)
     {
-      std::cout << ((UnaryOperator*)lhs)->getOpcodeStr(
+      getOutStream() << ((UnaryOperator*)lhs)->getOpcodeStr(
         ((UnaryOperator*)lhs)->getOpcode()) << "\n";
     }
 
@@ -1431,7 +1299,17 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
 
   // RHS of binary operator
 
-  if (strcmp(rhs->getStmtClassName(), "DeclRefExpr") == 0)
+  if (getIntegerConstant(rhs, constVal))
+  {
+    // literal or constant subexpression folded by clang
+    getErrStream() << "\tconstant RHS value: " << constVal << "\n";
+
+    getIntegerLiteral(constVal);
+
+    rhsFound = 1;
+  }
+  else
+  if (rhs->getStmtClass() == Stmt::DeclRefExprClass)
   {
     // get name and type for Expr *rhs from DeclRefExpr
     const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(rhs);
@@ -1440,48 +1318,33 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
 
     if (valueDecl)
     {
-      std::string varName = valueDecl->getNameAsString();
-      std::string varType = getTypeAsString(valueDecl);
-      std::cerr << "\tRHS identifier = " << varName << "\n";
-      std::cerr << "\ttype: " << varType << "\n";
+      VariableCount* var = getVariableSymbol(valueDecl);
+      getErrStream() << "\tRHS identifier = " << var->varName << "\n";
+      getErrStream() << "\ttype: " << var->varType << "\n";
 
-      getVariable(varName.c_str(), varType.c_str());
+      getVariable(var);
 
       rhsFound = 1;
     }
   }
   else
-  if (strcmp(rhs->getStmtClassName(), "IntegerLiteral") == 0)
-  {
-    std::cerr << "\tIntegerLiteral: " << "\n";
-
-    const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(rhs);
-
-    double dval = IL->getValue().signedRoundToDouble();
-    std::cerr << "\tRHS value: " << dval << "\n";
-
-    getIntegerLiteral(dval);
-
-    rhsFound = 1;
-  }
-  else
-  if (strcmp(rhs->getStmtClassName(), "FloatingLiteral") == 0)
+  if (rhs->getStmtClass() == Stmt::FloatingLiteralClass)
   {
-    std::cerr << "\tFloatingLiteral: " << "\n";
+    getErrStream() << "\tFloatingLiteral: " << "\n";
 
     const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(rhs);
 
     double dval = FL->getValue().convertToDouble();
-    std::cerr << "\tRHS value: " << dval << "\n";
+    getErrStream() << "\tRHS value: " << dval << "\n";
 
     getFloatingLiteral(dval);
 
     rhsFound = 1;
   }
   else
-  if (strcmp(rhs->getStmtClassName(), "ImplicitCastExpr") == 0)
+  if (rhs->getStmtClass() == Stmt::ImplicitCastExprClass)
   {
-    std::cerr << "\tImplicitCastExpr: " << "\n";
+    getErrStream() << "\tImplicitCastExpr: " << "\n";
 
     const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(rhs);
 
@@ -1489,7 +1352,7 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
 
     if (ICE->getCastKind() == CK_LValueToRValue)
     {
-      std::cerr << "\tLValueToRValue " << "\n";
+      getErrStream() << "\tLValueToRValue " << "\n";
 
       const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -1497,12 +1360,11 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
 
       if (valueDecl)
       {
-        std::string varName = valueDecl->getNameAsString();
-        std::string varType = getTypeAsString(valueDecl);
-        std::cerr << "\tRHS identifier = " << varName << "\n";
-        std::cerr << "\ttype: " << varType << "\n";
+        VariableCount* var = getVariableSymbol(valueDecl);
+        getErrStream() << "\tRHS identifier = " << var->varName << "\n";
+        getErrStream() << "\ttype: " << var->varType << "\n";
 
-        getVariable(varName.c_str(), varType.c_str());
+        getVariable(var);
 
         rhsFound = 1;
       }
@@ -1510,13 +1372,13 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
     else
     if (ICE->getCastKind() == CK_IntegralCast)
     {
-      std::cerr << "\tIntegralCast " << "\n";
+      getErrStream() << "\tIntegralCast " << "\n";
 
       se = se->IgnoreParenImpCasts();
 
-      if (strcmp(se->getStmtClassName(), "DeclRefExpr") == 0)
+      if (se->getStmtClass() == Stmt::DeclRefExprClass)
       {
-        std::cout << "\nICE->IntegralCast->DeclRefExpr\n";
+        getOutStream() << "\nICE->IntegralCast->DeclRefExpr\n";
 
         const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -1524,56 +1386,27 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
 
         if (valueDecl)
         {
-          std::string varName = valueDecl->getNameAsString();
-          std::string varType = getTypeAsString(valueDecl);
-          std::cerr << "\tRHS identifier = " << varName << "\n";
-          std::cerr << "\ttype: " << varType << "\n";
+          VariableCount* var = getVariableSymbol(valueDecl);
+          getErrStream() << "\tRHS identifier = " << var->varName << "\n";
+          getErrStream() << "\ttype: " << var->varType << "\n";
 
-          getVariable(varName.c_str(), varType.c_str());
+          getVariable(var);
 
           rhsFound = 1;
         }
       }
-      else
-      if (strcmp(se->getStmtClassName(), "IntegerLiteral") == 0)
-      {
-        std::cout << "\nICE->IntegralCast->IntegerLiteral\n";
-
-        const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(se);
-
-        double dval = IL->getValue().signedRoundToDouble();
-        std::cerr << "\tRHS value: " << dval << "\n";
-
-        getIntegerLiteral(dval);
-
-        rhsFound = 1;
-      }
-      else
-      if (strcmp(se->getStmtClassName(), "CharacterLiteral") == 0)
-      {
-        std::cerr << "\nICE->IntegralCast->CharacterLiteral\n";
-
-        const CharacterLiteral *CL = dyn_cast<CharacterLiteral>(se);
-
-        unsigned ch = CL->getValue();
-        std::cerr << "\tRHS value: " << ch << "\n";
-
-        getIntegerLiteral((double)ch);
-
-        rhsFound = 1;
-      }
 
     } // IntegralCast ends
     else
     if (ICE->getCastKind() == CK_FloatingCast)
     {
-      std::cerr << "\tFloatingCast \n";
+      getErrStream() << "\tFloatingCast \n";
 
       se = se->IgnoreParenImpCasts();
 
-      if (strcmp(se->getStmtClassName(), "DeclRefExpr") == 0)
+      if (se->getStmtClass() == Stmt::DeclRefExprClass)
       {
-        std::cout << "\nICE->FloatingCast->DeclRefExpr\n";
+        getOutStream() << "\nICE->FloatingCast->DeclRefExpr\n";
 
         const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -1581,24 +1414,23 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
 
         if (valueDecl)
         {
-          std::string varName = valueDecl->getNameAsString();
-          std::string varType = getTypeAsString(valueDecl);
-          std::cerr << "\tRHS identifier = " << varName << "\n";
-          std::cerr << "\ttype: " << varType << "\n";
+          VariableCount* var = getVariableSymbol(valueDecl);
+          getErrStream() << "\tRHS identifier = " << var->varName << "\n";
+          getErrStream() << "\ttype: " << var->varType << "\n";
 
-          getVariable(varName.c_str(), varType.c_str());
+          getVariable(var);
 
           rhsFound = 1;
         }
       }
       else
-      if (strcmp(se->getStmtClassName(), "FloatingLiteral") == 0)
+      if (se->getStmtClass() == Stmt::FloatingLiteralClass)
       {
-        std::cout << "\nICE->FloatingCast->FloatingLiteral\n";
+        getOutStream() << "\nICE->FloatingCast->FloatingLiteral\n";
 
         const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(se);
         double dval = FL->getValue().convertToDouble();
-        std::cerr << "\tRHS value: " << dval << "\n";
+        getErrStream() << "\tRHS value: " << dval << "\n";
 
         getFloatingLiteral(dval);
 
@@ -1607,8 +1439,8 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
     } // FloatingCast ends
     else
     {
-      std::cout << "\nTough Luck in ImplicitCastExpr on rhs!\n";
-      std::cout << "\ngot " << ICE->getCastKind() << "\n";
+      getOutStream() << "\nTough Luck in ImplicitCastExpr on rhs!\n";
+      getOutStream() << "\ngot " << ICE->getCastKind() << "\n";
     }
 
   }  // ImplicitCastExpr ends
@@ -1616,22 +1448,22 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
   // if rhs operand not found, recursively traverse AST for rhs
   if (!rhsFound)
   {
-    std::cout << "\n!rhsFound\n";
-    std::cout << "\nCannot determine rhs -> we are at operator node\n";
+    getOutStream() << "\n!rhsFound\n";
+    getOutStream() << "\nCannot determine rhs -> we are at operator node\n";
 
     // if rhs is again operator node in AST, get StmtClass of operation
     // cast it appropriately and print operator
 
-    std::cout << rhs->getStmtClassName() << "\n";
+    getOutStream() << rhs->getStmtClassName() << "\n";
 
-    if (strcmp(rhs->getStmtClassName(), "BinaryOperator") == 0)
+    if (rhs->getStmtClass() == Stmt::BinaryOperatorClass)
     {
-      std::cout << ((BinaryOperator*)rhs)->getOpcodeStr() << "\n";
+      getOutStream() << ((BinaryOperator*)rhs)->getOpcodeStr() << "\n";
     }
     else
-    if (strcmp(rhs->getStmtClassName(), "UnaryOperator") == 0)
+    if (rhs->getStmtClass() == Stmt::UnaryOperatorClass)
     {
-      std::cout << ((UnaryOperator*)rhs)->getOpcodeStr(
+      getOutStream() << ((UnaryOperator*)rhs)->getOpcodeStr(
         ((UnaryOperator*)rhs)->getOpcode()) << "\n";
     }
 
@@ -1639,7 +1471,7 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
     TraverseStmt((Stmt*) rhs);
   }
 
-  createSingleExpressionForBinShiftOp(opcode.c_str(), assignCount);
+  createSingleExpressionForBinShiftOp(opcode, m_context->assignCount);
 
   //Check if the relational operator's result is part of an assignment.
   //If yes, then create a temporary variable and put it on the stack.
@@ -1651,8 +1483,8 @@ void MyProcessStmt::getLHSAndRHSForShBO(BinaryOperator* E)
 bool MyProcessStmt::VisitBinShl(BinaryOperator* E)
 {
   // BO_Shl <<
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tShift Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tShift Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForShBO(E);
 
@@ -1665,8 +1497,8 @@ bool MyProcessStmt::VisitBinShl(BinaryOperator* E)
 bool MyProcessStmt::VisitBinShr(BinaryOperator* E)
 {
   // BO_Shr >>
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tShift Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tShift Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForShBO(E);
 
@@ -1677,7 +1509,7 @@ bool MyProcessStmt::VisitBinShr(BinaryOperator* E)
 void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
 {
   // get relational operator
-  std::string opcode = E->getOpcodeStr();
+  BinaryOperatorKind opcode = E->getOpcode();
 
   // get LHS and RHS of binary operator
   Expr* lhs = E->getLHS();
@@ -1688,15 +1520,34 @@ void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
   // take care of parenthesies and implicit cast expressions on rhs
   rhs = rhs->IgnoreParenImpCasts();
 
-  assignCount++;
+  // e.g. 3 > 2 - no constraint needs to be built
+  if (setConstantCondition(E))
+  {
+    return;
+  }
+
+  m_context->assignCount++;
 
   // lhsFound (or rhsFound)
   // - a flag to denote lhs (or rhs) literal/identifier found
   int lhsFound = 0, rhsFound = 0;
 
+  // value of an operand which is an integer constant expression
+  double constVal = 0;
+
   // LHS of relational operator
 
-  if (strcmp(lhs->getStmtClassName(), "DeclRefExpr") == 0)
+  if (getIntegerConstant(lhs, constVal))
+  {
+    // literal or constant subexpression folded by clang
+    getErrStream() << "\tconstant LHS value: " << constVal << "\n";
+
+    getIntegerLiteral(constVal);
+
+    lhsFound = 1;
+  }
+  else
+  if (lhs->getStmtClass() == Stmt::DeclRefExprClass)
   {
     // get name and type for Expr *lhs from DeclRefExpr
     const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(lhs);
@@ -1705,48 +1556,33 @@ void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
 
     if (valueDecl)
     {
-      std::string varName = valueDecl->getNameAsString();
-      std::string varType = getTypeAsString(valueDecl);
-      std::cerr << "\tLHS identifier = " << varName << "\n";
-      std::cerr << "\ttype: " << varType << "\n";
+      VariableCount* var = getVariableSymbol(valueDecl);
+      getErrStream() << "\tLHS identifier = " << var->varName << "\n";
+      getErrStream() << "\ttype: " << var->varType << "\n";
 
-      getVariable(varName.c_str(), varType.c_str());
+      getVariable(var);
 
       lhsFound = 1;
     }
   }
   else
-  if (strcmp(lhs->getStmtClassName(), "IntegerLiteral") == 0)
-  {
-    std::cerr << "\tIntegerLiteral: " << "\n";
-
-    const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(lhs);
-
-    double dval = IL->getValue().signedRoundToDouble();
-    std::cerr << "\tLHS value: " << dval << "\n";
-
-    getIntegerLiteral(dval);
-
-    lhsFound = 1;
-  }
-  else
-  if (strcmp(lhs->getStmtClassName(), "FloatingLiteral") == 0)
+  if (lhs->getStmtClass() == Stmt::FloatingLiteralClass)
   {
-    std::cerr << "\tFloatingLiteral: " << "\n";
+    getErrStream() << "\tFloatingLiteral: " << "\n";
 
     const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(lhs);
 
     double dval = FL->getValue().convertToDouble();
-    std::cerr << "\tLHS value: " << dval << "\n";
+    getErrStream() << "\tLHS value: " << dval << "\n";
 
     getFloatingLiteral(dval);
 
     lhsFound = 1;
   }
   else
-  if (strcmp(lhs->getStmtClassName(), "ImplicitCastExpr") == 0)
+  if (lhs->getStmtClass() == Stmt::ImplicitCastExprClass)
   {
-    std::cerr << "\tImplicitCastExpr: " << "\n";
+    getErrStream() << "\tImplicitCastExpr: " << "\n";
 
     const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(lhs);
 
@@ -1754,7 +1590,7 @@ void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
 
     if (ICE->getCastKind() == CK_LValueToRValue)
     {
-      std::cerr << "\tLValueToRValue " << "\n";
+      getErrStream() << "\tLValueToRValue " << "\n";
 
       const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -1762,12 +1598,11 @@ void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
 
       if (valueDecl)
       {
-        std::string varName = valueDecl->getNameAsString();
-        std::string varType = getTypeAsString(valueDecl);
-        std::cerr << "\tLHS identifier = " << varName << "\n";
-        std::cerr << "\ttype: " << varType << "\n";
+        VariableCount* var = getVariableSymbol(valueDecl);
+        getErrStream() << "\tLHS identifier = " << var->varName << "\n";
+        getErrStream() << "\ttype: " << var->varType << "\n";
 
-        getVariable(varName.c_str(), varType.c_str());
+        getVariable(var);
 
         lhsFound = 1;
       }
@@ -1775,13 +1610,13 @@ void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
     else
     if (ICE->getCastKind() == CK_IntegralCast)
     {
-      std::cerr << "\tIntegralCast " << "\n";
+      getErrStream() << "\tIntegralCast " << "\n";
 
       se = se->IgnoreParenImpCasts();
 
-      if (strcmp(se->getStmtClassName(), "DeclRefExpr") == 0)
+      if (se->getStmtClass() == Stmt::DeclRefExprClass)
       {
-        std::cerr << "\nICE->IntegralCast->DeclRefExpr\n";
+        getErrStream() << "\nICE->IntegralCast->DeclRefExpr\n";
 
         const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -1789,56 +1624,27 @@ void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
 
         if (valueDecl)
         {
-          std::string varName = valueDecl->getNameAsString();
-          std::string varType = getTypeAsString(valueDecl);
-          std::cerr << "\tLHS identifier = " << varName << "\n";
-          std::cerr << "\ttype: " << varType << "\n";
+          VariableCount* var = getVariableSymbol(valueDecl);
+          getErrStream() << "\tLHS identifier = " << var->varName << "\n";
+          getErrStream() << "\ttype: " << var->varType << "\n";
 
-          getVariable(varName.c_str(), varType.c_str());
+          getVariable(var);
 
           lhsFound = 1;
         }
       }
-      else
-      if (strcmp(se->getStmtClassName(), "IntegerLiteral") == 0)
-      {
-        std::cerr << "\nICE->IntegralCast->IntegerLiteral\n";
-
-        const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(se);
-
-        double dval = IL->getValue().signedRoundToDouble();
-        std::cerr << "\tLHS value: " << dval << "\n";
-
-        getIntegerLiteral(dval);
-
-        lhsFound = 1;
-      }
-      else
-      if (strcmp(se->getStmtClassName(), "CharacterLiteral") == 0)
-      {
-        std::cerr << "\nICE->IntegralCast->CharacterLiteral\n";
-
-        const CharacterLiteral *CL = dyn_cast<CharacterLiteral>(se);
-
-        unsigned ch = CL->getValue();
-        std::cerr << "\tLHS value: " << ch << "\n";
-
-        getIntegerLiteral((double) ch);
-
-        lhsFound = 1;
-      }
 
     } // IntegralCast ends
     else
     if (ICE->getCastKind() == CK_FloatingCast)
     {
-      std::cerr << "\tFloatingCast \n";
+      getErrStream() << "\tFloatingCast \n";
 
       se = se->IgnoreParenImpCasts();
 
-      if (strcmp(se->getStmtClassName(), "DeclRefExpr") == 0)
+      if (se->getStmtClass() == Stmt::DeclRefExprClass)
       {
-        std::cout << "\nICE->FloatingCast->DeclRefExpr\n";
+        getOutStream() << "\nICE->FloatingCast->DeclRefExpr\n";
 
         const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -1846,25 +1652,24 @@ void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
 
         if (valueDecl)
         {
-          std::string varName = valueDecl->getNameAsString();
-          std::string varType = getTypeAsString(valueDecl);
-          std::cerr << "\tLHS identifier = " << varName << "\n";
-          std::cerr << "\ttype: " << varType << "\n";
+          VariableCount* var = getVariableSymbol(valueDecl);
+          getErrStream() << "\tLHS identifier = " << var->varName << "\n";
+          getErrStream() << "\ttype: " << var->varType << "\n";
 
-          getVariable(varName.c_str(), varType.c_str());
+          getVariable(var);
 
           lhsFound = 1;
         }
       }
       else
-      if (strcmp(se->getStmtClassName(), "FloatingLiteral") == 0)
+      if (se->getStmtClass() == Stmt::FloatingLiteralClass)
       {
-        std::cout << "\nICE->FloatingCast->FloatingLiteral\n";
+        getOutStream() << "\nICE->FloatingCast->FloatingLiteral\n";
 
         const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(se);
 
         double dval = FL->getValue().convertToDouble();
-        std::cerr << "\tLHS value: " << dval << "\n";
+        getErrStream() << "\tLHS value: " << dval << "\n";
 
         getFloatingLiteral(dval);
 
@@ -1877,9 +1682,9 @@ void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
   // if lhs operand not found, recursively traverse AST for lhs
   if (!lhsFound)
   {
-    std::cout << "\n!lhsFound\n";
+    getOutStream() << "\n!lhsFound\n";
 
-    std::cout << lhs->getStmtClassName() << "\n";
+    getOutStream() << lhs->getStmtClassName() << "\n";
 
     lhs = lhs->IgnoreParenImpCasts();
     TraverseStmt((Stmt*) lhs);
@@ -1887,7 +1692,17 @@ void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
 
   // RHS of relational operator
 
-  if (strcmp(rhs->getStmtClassName(), "DeclRefExpr") == 0)
+  if (getIntegerConstant(rhs, constVal))
+  {
+    // literal or constant subexpression folded by clang
+    getErrStream() << "\tconstant RHS value: " << constVal << "\n";
+
+    getIntegerLiteral(constVal);
+
+    rhsFound = 1;
+  }
+  else
+  if (rhs->getStmtClass() == Stmt::DeclRefExprClass)
   {
     // get name and type for Expr *rhs from DeclRefExpr
     const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(rhs);
@@ -1896,48 +1711,33 @@ void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
 
     if (valueDecl)
     {
-      std::string varName = valueDecl->getNameAsString();
-      std::string varType = getTypeAsString(valueDecl);
-      std::cerr << "\tRHS identifier = " << varName << "\n";
-      std::cerr << "\ttype: " << varType << "\n";
+      VariableCount* var = getVariableSymbol(valueDecl);
+      getErrStream() << "\tRHS identifier = " << var->varName << "\n";
+      getErrStream() << "\ttype: " << var->varType << "\n";
 
-      getVariable(varName.c_str(), varType.c_str());
+      getVariable(var);
 
       rhsFound = 1;
     }
   }
   else
-  if (strcmp(rhs->getStmtClassName(), "IntegerLiteral") == 0)
-  {
-    std::cerr << "\tIntegerLiteral: " << "\n";
-
-    const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(rhs);
-
-    double dval = IL->getValue().signedRoundToDouble();
-    std::cerr << "\tRHS value: " << dval << "\n";
-
-    getIntegerLiteral(dval);
-
-    rhsFound = 1;
-  }
-  else
-  if (strcmp(rhs->getStmtClassName(), "FloatingLiteral") == 0)
+  if (rhs->getStmtClass() == Stmt::FloatingLiteralClass)
   {
-    std::cerr << "\tFloatingLiteral: " << "\n";
+    getErrStream() << "\tFloatingLiteral: " << "\n";
 
     const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(rhs);
 
     double dval = FL->getValue().convertToDouble();
-    std::cerr << "\tRHS value: " << dval << "\n";
+    getErrStream() << "\tRHS value: " << dval << "\n";
 
     getFloatingLiteral(dval);
 
     rhsFound = 1;
   }
   else
-  if (strcmp(rhs->getStmtClassName(), "ImplicitCastExpr") == 0)
+  if (rhs->getStmtClass() == Stmt::ImplicitCastExprClass)
   {
-    std::cerr << "\tImplicitCastExpr: " << "\n";
+    getErrStream() << "\tImplicitCastExpr: " << "\n";
 
     const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(rhs);
 
@@ -1945,7 +1745,7 @@ void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
 
     if (ICE->getCastKind() == CK_LValueToRValue)
     {
-      std::cerr << "\tLValueToRValue " << "\n";
+      getErrStream() << "\tLValueToRValue " << "\n";
 
       const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -1953,12 +1753,11 @@ void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
 
       if (valueDecl)
       {
-        std::string varName = valueDecl->getNameAsString();
-        std::string varType = getTypeAsString(valueDecl);
-        std::cerr << "\tRHS identifier = " << varName << "\n";
-        std::cerr << "\ttype: " << varType << "\n";
+        VariableCount* var = getVariableSymbol(valueDecl);
+        getErrStream() << "\tRHS identifier = " << var->varName << "\n";
+        getErrStream() << "\ttype: " << var->varType << "\n";
 
-        getVariable(varName.c_str(), varType.c_str());
+        getVariable(var);
 
         rhsFound = 1;
       }
@@ -1966,15 +1765,15 @@ void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
     else
     if (ICE->getCastKind() == CK_IntegralCast)
     {
-      std::cerr << "\tIntegralCast " << "\n";
+      getErrStream() << "\tIntegralCast " << "\n";
 
-      std::cerr << "\tIntegralCast " << "\n";
+      getErrStream() << "\tIntegralCast " << "\n";
 
       se = se->IgnoreParenImpCasts();
 
-      if (strcmp(se->getStmtClassName(), "DeclRefExpr") == 0)
+      if (se->getStmtClass() == Stmt::DeclRefExprClass)
       {
-        std::cout << "\nICE->IntegralCast->DeclRefExpr\n";
+        getOutStream() << "\nICE->IntegralCast->DeclRefExpr\n";
 
         const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -1982,56 +1781,27 @@ void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
 
         if (valueDecl)
         {
-          std::string varName = valueDecl->getNameAsString();
-          std::string varType = getTypeAsString(valueDecl);
-          std::cerr << "\tRHS identifier = " << varName << "\n";
-          std::cerr << "\ttype: " << varType << "\n";
+          VariableCount* var = getVariableSymbol(valueDecl);
+          getErrStream() << "\tRHS identifier = " << var->varName << "\n";
+          getErrStream() << "\ttype: " << var->varType << "\n";
 
-          getVariable(varName.c_str(), varType.c_str());
+          getVariable(var);
 
           rhsFound = 1;
         }
       }
-      else
-      if (strcmp(se->getStmtClassName(), "IntegerLiteral") == 0)
-      {
-        std::cout << "\nICE->IntegralCast->IntegerLiteral\n";
-
-        const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(se);
-
-        double dval = IL->getValue().signedRoundToDouble();
-        std::cerr << "\tRHS value: " << dval << "\n";
- 
-        getIntegerLiteral(dval);
-
-        rhsFound = 1;
-      }
-      else
-      if (strcmp(se->getStmtClassName(), "CharacterLiteral") == 0)
-      {
-        std::cerr << "\nICE->IntegralCast->CharacterLiteral\n";
-
-        const CharacterLiteral *CL = dyn_cast<CharacterLiteral>(se);
-
-        unsigned ch = CL->getValue();
-        std::cerr << "\tRHS value: " << ch << "\n";
-
-        getIntegerLiteral((double) ch);
-
-        rhsFound = 1;
-      }
 
     } // IntegralCast ends
     else
     if (ICE->getCastKind() == CK_FloatingCast)
     {
-      std::cerr << "\tFloatingCast \n";
+      getErrStream() << "\tFloatingCast \n";
 
       se = se->IgnoreParenImpCasts();
 
-      if (strcmp(se->getStmtClassName(), "DeclRefExpr") == 0)
+      if (se->getStmtClass() == Stmt::DeclRefExprClass)
       {
-        std::cout << "\nICE->FloatingCast->DeclRefExpr\n";
+        getOutStream() << "\nICE->FloatingCast->DeclRefExpr\n";
 
         const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -2039,24 +1809,23 @@ void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
 
         if (valueDecl)
         {
-          std::string varName = valueDecl->getNameAsString();
-          std::string varType = getTypeAsString(valueDecl);
-          std::cerr << "\tRHS identifier = " << varName << "\n";
-          std::cerr << "\ttype: " << varType << "\n";
+          VariableCount* var = getVariableSymbol(valueDecl);
+          getErrStream() << "\tRHS identifier = " << var->varName << "\n";
+          getErrStream() << "\ttype: " << var->varType << "\n";
 
-          getVariable(varName.c_str(), varType.c_str());
+          getVariable(var);
 
           rhsFound = 1;
         }
       }
       else
-      if (strcmp(se->getStmtClassName(), "FloatingLiteral") == 0)
+      if (se->getStmtClass() == Stmt::FloatingLiteralClass)
       {
-        std::cout << "\nICE->FloatingCast->FloatingLiteral\n";
+        getOutStream() << "\nICE->FloatingCast->FloatingLiteral\n";
 
         const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(se);
         double dval = FL->getValue().convertToDouble();
-        std::cerr << "\tRHS value: " << dval << "\n";
+        getErrStream() << "\tRHS value: " << dval << "\n";
 
         getFloatingLiteral(dval);
 
@@ -2069,18 +1838,18 @@ void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
   // if lhs operand not found, recursively traverse AST for lhs
   if (!rhsFound)
   {
-    std::cout << "\n!rhsFound\n";
+    getOutStream() << "\n!rhsFound\n";
 
-    std::cout << rhs->getStmtClassName() << "\n";
+    getOutStream() << rhs->getStmtClassName() << "\n";
 
     rhs = rhs->IgnoreParenImpCasts();
     TraverseStmt((Stmt*) rhs);
   }
 
   // create a single expression for current opcode >, >=, <, <=
-  createConstraintForBinRelOp(opcode.c_str());
+  createConstraintForBinRelOp(opcode);
 
-  assignCount--;
+  m_context->assignCount--;
 
 }
 
@@ -2090,8 +1859,8 @@ void MyProcessStmt::getLHSAndRHSForRelBO(BinaryOperator* E)
 bool MyProcessStmt::VisitBinGT(BinaryOperator* E)
 {
   // BO_GT >
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tRelational Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tRelational Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForRelBO(E);
 
@@ -2102,8 +1871,8 @@ bool MyProcessStmt::VisitBinGT(BinaryOperator* E)
 bool MyProcessStmt::VisitBinGE(BinaryOperator* E)
 {
   // BO_GE >=
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tRelational Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tRelational Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForRelBO(E);
 
@@ -2114,8 +1883,8 @@ bool MyProcessStmt::VisitBinGE(BinaryOperator* E)
 bool MyProcessStmt::VisitBinLT(BinaryOperator* E)
 {
   // BO_LT <
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tRelational Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tRelational Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForRelBO(E);
 
@@ -2126,8 +1895,8 @@ bool MyProcessStmt::VisitBinLT(BinaryOperator* E)
 bool MyProcessStmt::VisitBinLE(BinaryOperator* E)
 {
   // BO_LE <=
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tRelational Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tRelational Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForRelBO(E);
 
@@ -2138,8 +1907,8 @@ bool MyProcessStmt::VisitBinLE(BinaryOperator* E)
 bool MyProcessStmt::VisitBinEQ(BinaryOperator* E)
 {
   // BO_EQ ==
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tEquality Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tEquality Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForRelBO(E);
 
@@ -2150,8 +1919,8 @@ bool MyProcessStmt::VisitBinEQ(BinaryOperator* E)
 bool MyProcessStmt::VisitBinNE(BinaryOperator* E)
 {
   // BO_EQ !=
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tEquality Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tEquality Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForRelBO(E);
 
@@ -2164,8 +1933,8 @@ bool MyProcessStmt::VisitBinNE(BinaryOperator* E)
 bool MyProcessStmt::VisitBinAnd(BinaryOperator* E)
 {
   // BO_And &
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tBitwise Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tBitwise Op " << E->getOpcodeStr() << "\n";
 
   Expr* lhs = E->getLHS();
   lhs = lhs->IgnoreParenImpCasts();
@@ -2180,8 +1949,8 @@ bool MyProcessStmt::VisitBinAnd(BinaryOperator* E)
 bool MyProcessStmt::VisitBinOr(BinaryOperator* E)
 {
   // BO_Or |
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tBitwise Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tBitwise Op " << E->getOpcodeStr() << "\n";
 
   Expr* lhs = E->getLHS();
   lhs = lhs->IgnoreParenImpCasts();
@@ -2198,8 +1967,8 @@ bool MyProcessStmt::VisitBinOr(BinaryOperator* E)
 bool MyProcessStmt::VisitBinLAnd(BinaryOperator* E)
 {
   // BO_LAnd &&
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tLogical Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tLogical Op " << E->getOpcodeStr() << "\n";
 
   Expr* lhs = E->getLHS();
   lhs = lhs->IgnoreParenImpCasts();
@@ -2217,8 +1986,8 @@ bool MyProcessStmt::VisitBinLAnd(BinaryOperator* E)
 bool MyProcessStmt::VisitBinLOr(BinaryOperator* E)
 {
   // BO_LOr ||
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tLogical Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tLogical Op " << E->getOpcodeStr() << "\n";
 
   Expr* lhs = E->getLHS();
   lhs = lhs->IgnoreParenImpCasts();
@@ -2236,7 +2005,7 @@ bool MyProcessStmt::VisitBinLOr(BinaryOperator* E)
 void MyProcessStmt::getLHSAndRHSForCAO(CompoundAssignOperator* E)
 {
   // get compound assignment operator
-  std::string opcode = E->getOpcodeStr();
+  BinaryOperatorKind opcode = E->getOpcode();
 
   // get LHS and RHS of compound assignment operator
   Expr* lhs = E->getLHS();
@@ -2245,18 +2014,20 @@ void MyProcessStmt::getLHSAndRHSForCAO(CompoundAssignOperator* E)
   // take care of parenthesies and implicit cast expressions on rhs
   rhs = rhs->IgnoreParenImpCasts();
 
-  std::string lhsVarName;
-  std::string lhsVarType;
+  VariableCount* lhsVar = NULL;
 
   // increment assignCount for every compound assignment
-  assignCount++;
+  m_context->assignCount++;
 
   // rhsFound - a flag to denote rhs literal/identifier found
   int rhsFound = 0;
 
+  // value of an operand which is an integer constant expression
+  double constVal = 0;
+
   // LHS of compound assignment operator
 
-  if (strcmp(lhs->getStmtClassName(), "DeclRefExpr") == 0)
+  if (lhs->getStmtClass() == Stmt::DeclRefExprClass)
   {
     // get name and type for Expr *lhs from DeclRefExpr
     const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(lhs);
@@ -2265,34 +2036,43 @@ void MyProcessStmt::getLHSAndRHSForCAO(CompoundAssignOperator* E)
 
     if (valueDecl)
     {
-      lhsVarName = valueDecl->getNameAsString();
-      lhsVarType = getTypeAsString(valueDecl);
-      std::cerr << "\tLHS identifier = " << lhsVarName << "\n";
-      std::cerr << "\ttype: " << lhsVarType << "\n";
+      lhsVar = getVariableSymbol(valueDecl);
+      getErrStream() << "\tLHS identifier = " << lhsVar->varName << "\n";
+      getErrStream() << "\ttype: " << lhsVar->varType << "\n";
 
-      getVariable(lhsVarName.c_str(), lhsVarType.c_str());
+      getVariable(lhsVar);
     }
   }
 
   // RHS of compound assignment operator
 
-  if (strcmp(rhs->getStmtClassName(), "CompoundAssignOperator") == 0)
+  if (rhs->getStmtClass() == Stmt::CompoundAssignOperatorClass)
   {
-    std::string opcode = ((BinaryOperator*)rhs)->getOpcodeStr();
+    BinaryOperatorKind opcode = ((BinaryOperator*)rhs)->getOpcode();
 
-    if ((strcmp(opcode.c_str(), "+=") == 0) ||
-        (strcmp(opcode.c_str(), "-=") == 0) ||
-        (strcmp(opcode.c_str(), "*=") == 0) ||
-        (strcmp(opcode.c_str(), "/=") == 0) ||
-        (strcmp(opcode.c_str(), "%=") == 0) )
+    if ((opcode == BO_AddAssign) ||
+        (opcode == BO_SubAssign) ||
+        (opcode == BO_MulAssign) ||
+        (opcode == BO_DivAssign) ||
+        (opcode == BO_RemAssign) )
     {
-      std::cout << "\nFound compound assignment on rhs,"
+      getOutStream() << "\nFound compound assignment on rhs,"
         " it is cascaded compound assignment.\n";
-      isCascadedAssign = true;
+      m_context->isCascadedAssign = true;
     }
   }
   else
-  if (strcmp(rhs->getStmtClassName(), "DeclRefExpr") == 0)
+  if (getIntegerConstant(rhs, constVal))
+  {
+    // literal or constant subexpression folded by clang
+    getErrStream() << "\tconstant RHS value: " << constVal << "\n";
+
+    getIntegerLiteral(constVal);
+
+    rhsFound = 1;
+  }
+  else
+  if (rhs->getStmtClass() == Stmt::DeclRefExprClass)
   {
     // get name and type for Expr *rhs from DeclRefExpr
     const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(rhs);
@@ -2301,48 +2081,33 @@ void MyProcessStmt::getLHSAndRHSForCAO(CompoundAssignOperator* E)
 
     if (valueDecl)
     {
-      std::string varName = valueDecl->getNameAsString();
-      std::string varType = getTypeAsString(valueDecl);
-      std::cerr << "\tRHS identifier = " << varName << "\n";
-      std::cerr << "\ttype: " << varType << "\n";
+      VariableCount* var = getVariableSymbol(valueDecl);
+      getErrStream() << "\tRHS identifier = " << var->varName << "\n";
+      getErrStream() << "\ttype: " << var->varType << "\n";
 
-      getVariable(varName.c_str(), varType.c_str());
+      getVariable(var);
 
       rhsFound = 1;
     }
   }
   else
-  if (strcmp(rhs->getStmtClassName(), "IntegerLiteral") == 0)
-  {
-    std::cerr << "\tIntegerLiteral: " << "\n";
-
-    const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(rhs);
-
-    double dval = IL->getValue().signedRoundToDouble();
-    std::cerr << "\tRHS value: " << dval << "\n";
-
-    getIntegerLiteral(dval);
-
-    rhsFound = 1;
-  }
-  else
-  if (strcmp(rhs->getStmtClassName(), "FloatingLiteral") == 0)
+  if (rhs->getStmtClass() == Stmt::FloatingLiteralClass)
   {
-    std::cerr << "\tFloatingLiteral: " << "\n";
+    getErrStream() << "\tFloatingLiteral: " << "\n";
 
     const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(rhs);
 
     double dval = FL->getValue().convertToDouble();
-    std::cerr << "\tRHS value: " << dval << "\n";
+    getErrStream() << "\tRHS value: " << dval << "\n";
 
     getFloatingLiteral(dval);
 
     rhsFound = 1;
   }
   else
-  if (strcmp(rhs->getStmtClassName(), "ImplicitCastExpr") == 0)
+  if (rhs->getStmtClass() == Stmt::ImplicitCastExprClass)
   {
-    std::cerr << "\tImplicitCastExpr: " << "\n";
+    getErrStream() << "\tImplicitCastExpr: " << "\n";
 
     const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(rhs);
 
@@ -2350,7 +2115,7 @@ void MyProcessStmt::getLHSAndRHSForCAO(CompoundAssignOperator* E)
 
     if (ICE->getCastKind() == CK_LValueToRValue)
     {
-      std::cerr << "\tLValueToRValue " << "\n";
+      getErrStream() << "\tLValueToRValue " << "\n";
 
       const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -2358,12 +2123,11 @@ void MyProcessStmt::getLHSAndRHSForCAO(CompoundAssignOperator* E)
 
       if (valueDecl)
       {
-        std::string varName = valueDecl->getNameAsString();
-        std::string varType = getTypeAsString(valueDecl);
-        std::cerr << "\tRHS identifier = " << varName << "\n";
-        std::cerr << "\ttype: " << varType << "\n";
+        VariableCount* var = getVariableSymbol(valueDecl);
+        getErrStream() << "\tRHS identifier = " << var->varName << "\n";
+        getErrStream() << "\ttype: " << var->varType << "\n";
 
-        getVariable(varName.c_str(), varType.c_str());
+        getVariable(var);
 
         rhsFound = 1;
       }
@@ -2371,12 +2135,12 @@ void MyProcessStmt::getLHSAndRHSForCAO(CompoundAssignOperator* E)
     else
     if (ICE->getCastKind() == CK_IntegralCast)
     {
-      std::cerr << "\tIntegralCast " << "\n";
+      getErrStream() << "\tIntegralCast " << "\n";
 
       const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(se);
 
       double dval = IL->getValue().signedRoundToDouble();
-      std::cerr << "\tRHS value: " << dval << "\n";
+      getErrStream() << "\tRHS value: " << dval << "\n";
 
       getIntegerLiteral(dval);
 
@@ -2385,16 +2149,16 @@ void MyProcessStmt::getLHSAndRHSForCAO(CompoundAssignOperator* E)
     else
     if (ICE->getCastKind() == CK_FloatingCast)
     {
-      std::cerr << "\tFloatingCast \n";
+      getErrStream() << "\tFloatingCast \n";
 
-      if (strcmp(se->getStmtClassName(), "FloatingLiteral") == 0)
+      if (se->getStmtClass() == Stmt::FloatingLiteralClass)
       {
-        std::cerr << "\tFloatingLiteral: \n";
+        getErrStream() << "\tFloatingLiteral: \n";
 
         const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(se);
 
         double dval = FL->getValue().convertToDouble();
-        std::cerr << "\tRHS value: " << dval << "\n";
+        getErrStream() << "\tRHS value: " << dval << "\n";
 
         getFloatingLiteral(dval);
 
@@ -2406,26 +2170,27 @@ void MyProcessStmt::getLHSAndRHSForCAO(CompoundAssignOperator* E)
 
   if (!rhsFound)
   {
-    std::cout << "\n!rhsFound\n";
-    std::cout << "\nCannot determine rhs -> we are at operator node\n";
+    getOutStream() << "\n!rhsFound\n";
+    getOutStream() << "\nCannot determine rhs -> we are at operator node\n";
 
     TraverseStmt((Stmt*) rhs);
   }
 
   // create a single expression for current opcode
-  createSingleExpressionForBinOp(opcode.c_str());
+  createSingleExpressionForBinOp(opcode);
 
   // now evaluate assignment by taking rhs expression from list
   // and updating abstract value for lhs identifier
-  evaluateAssignment(lhsVarName.c_str(), assignCount, m_isLastStatement);
-  assignCount--;
+  evaluateAssignment(lhsVar,
+    m_context->assignCount, m_isLastStatement);
+  m_context->assignCount--;
 
-  if (isCascadedAssign == false)
+  if (m_context->isCascadedAssign == false)
   {
     removeTemporaryVariables();
   }
 
-  if (assignCount == 0)
+  if (m_context->assignCount == 0)
   {
     removeTemporaryVariables();
   }
@@ -2437,8 +2202,8 @@ void MyProcessStmt::getLHSAndRHSForCAO(CompoundAssignOperator* E)
 bool MyProcessStmt::VisitBinAddAssign(CompoundAssignOperator* E)
 {
   // BO_AddAssign +=
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tCompound Assignment Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tCompound Assignment Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForCAO(E);
 
@@ -2449,8 +2214,8 @@ bool MyProcessStmt::VisitBinAddAssign(CompoundAssignOperator* E)
 bool MyProcessStmt::VisitBinSubAssign(CompoundAssignOperator* E)
 {
   // BO_SubAssign -=
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tCompound Assignment Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tCompound Assignment Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForCAO(E);
 
@@ -2461,8 +2226,8 @@ bool MyProcessStmt::VisitBinSubAssign(CompoundAssignOperator* E)
 bool MyProcessStmt::VisitBinMulAssign(CompoundAssignOperator* E)
 {
   // BO_MulAssign *=
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tCompound Assignment Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tCompound Assignment Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForCAO(E);
 
@@ -2473,8 +2238,8 @@ bool MyProcessStmt::VisitBinMulAssign(CompoundAssignOperator* E)
 bool MyProcessStmt::VisitBinDivAssign(CompoundAssignOperator* E)
 {
   // BO_DivAssign /=
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tCompound Assignment Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tCompound Assignment Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForCAO(E);
 
@@ -2485,8 +2250,8 @@ bool MyProcessStmt::VisitBinDivAssign(CompoundAssignOperator* E)
 bool MyProcessStmt::VisitBinRemAssign(CompoundAssignOperator* E)
 {
   // BO_RemAssign %=
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tCompound Assignment Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tCompound Assignment Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForCAO(E);
 
@@ -2496,17 +2261,16 @@ bool MyProcessStmt::VisitBinRemAssign(CompoundAssignOperator* E)
 /// \brief Common method for compound shift operators <<=, >>=
 void MyProcessStmt::getLHSAndRHSForShCAO(CompoundAssignOperator* E)
 {
-  std::string opcode = E->getOpcodeStr();
+  BinaryOperatorKind opcode = E->getOpcode();
   // get LHS side
   Expr* lhs = E->getLHS();
   Expr* rhs = E->getRHS();
 
-  std::string lhsVarName;
-  std::string lhsVarType;
+  VariableCount* lhsVar = NULL;
 
-  assignCount++;
+  m_context->assignCount++;
 
-  if (strcmp(lhs->getStmtClassName(), "DeclRefExpr") == 0)
+  if (lhs->getStmtClass() == Stmt::DeclRefExprClass)
   {
     // get name and type for Expr *lhs from DeclRefExpr
     const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(lhs);
@@ -2515,12 +2279,11 @@ void MyProcessStmt::getLHSAndRHSForShCAO(CompoundAssignOperator* E)
 
     if (valueDecl)
     {
-      lhsVarName = valueDecl->getNameAsString();
-      lhsVarType = getTypeAsString(valueDecl);
-      std::cerr << "\tLHS identifier = " << valueDecl->getNameAsString() << "\n";
-      std::cerr << "\ttype: " << getTypeAsString(valueDecl) << "\n";
+      lhsVar = getVariableSymbol(valueDecl);
+      getErrStream() << "\tLHS identifier = " << lhsVar->varName << "\n";
+      getErrStream() << "\ttype: " << lhsVar->varType << "\n";
 
-      getVariable(lhsVarName.c_str(), lhsVarType.c_str());
+      getVariable(lhsVar);
     }
 
   }
@@ -2529,23 +2292,36 @@ void MyProcessStmt::getLHSAndRHSForShCAO(CompoundAssignOperator* E)
 
   int rhsFound = 0;
 
-  if (strcmp(rhs->getStmtClassName(), "CompoundAssignOperator") == 0)
+  // value of an operand which is an integer constant expression
+  double constVal = 0;
+
+  if (rhs->getStmtClass() == Stmt::CompoundAssignOperatorClass)
   {
-    std::string opcode = ((BinaryOperator*)rhs)->getOpcodeStr();
+    BinaryOperatorKind opcode = ((BinaryOperator*)rhs)->getOpcode();
 
-    if ((strcmp(opcode.c_str(), "+=") == 0) ||
-        (strcmp(opcode.c_str(), "-=") == 0) ||
-        (strcmp(opcode.c_str(), "*=") == 0) ||
-        (strcmp(opcode.c_str(), "/=") == 0) ||
-        (strcmp(opcode.c_str(), "%=") == 0) )
+    if ((opcode == BO_AddAssign) ||
+        (opcode == BO_SubAssign) ||
+        (opcode == BO_MulAssign) ||
+        (opcode == BO_DivAssign) ||
+        (opcode == BO_RemAssign) )
     {
-      std::cout << "\nFound compound assignment on rhs,"
+      getOutStream() << "\nFound compound assignment on rhs,"
         " it is cascaded compound assignment.\n";
-      isCascadedAssign = true;
+      m_context->isCascadedAssign = true;
     }
   }
   else
-  if (strcmp(rhs->getStmtClassName(), "DeclRefExpr") == 0)
+  if (getIntegerConstant(rhs, constVal))
+  {
+    // literal or constant subexpression folded by clang
+    getErrStream() << "\tconstant RHS value: " << constVal << "\n";
+
+    getIntegerLiteral(constVal);
+
+    rhsFound = 1;
+  }
+  else
+  if (rhs->getStmtClass() == Stmt::DeclRefExprClass)
   {
     // get name and type for Expr *rhs from DeclRefExpr
     const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(rhs);
@@ -2554,48 +2330,33 @@ void MyProcessStmt::getLHSAndRHSForShCAO(CompoundAssignOperator* E)
 
     if (valueDecl)
     {
-      std::string varName = valueDecl->getNameAsString();
-      std::string varType = getTypeAsString(valueDecl);
-      std::cerr << "\tRHS identifier = " << varName << "\n";
-      std::cerr << "\ttype: " << varType << "\n";
+      VariableCount* var = getVariableSymbol(valueDecl);
+      getErrStream() << "\tRHS identifier = " << var->varName << "\n";
+      getErrStream() << "\ttype: " << var->varType << "\n";
 
-      getVariable(varName.c_str(), varType.c_str());
+      getVariable(var);
 
       rhsFound = 1;
     }
   }
   else
-  if (strcmp(rhs->getStmtClassName(), "IntegerLiteral") == 0)
+  if (rhs->getStmtClass() == Stmt::FloatingLiteralClass)
   {
-    std::cerr << "\tIntegerLiteral: " << "\n";
-
-    const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(rhs);
-
-    double dval = IL->getValue().signedRoundToDouble();
-    std::cerr << "\tRHS value: " << dval << "\n";
-
-    getIntegerLiteral(dval);
-
-    rhsFound = 1;
-  }
-  else
-  if (strcmp(rhs->getStmtClassName(), "FloatingLiteral") == 0)
-  {
-    std::cerr << "\tFloatingLiteral: " << "\n";
+    getErrStream() << "\tFloatingLiteral: " << "\n";
 
     const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(rhs);
 
     double dval = FL->getValue().convertToDouble();
-    std::cerr << "\tRHS value: " << dval << "\n";
+    getErrStream() << "\tRHS value: " << dval << "\n";
 
     getFloatingLiteral(dval);
 
     rhsFound = 1;
   }
   else
-  if (strcmp(rhs->getStmtClassName(), "ImplicitCastExpr") == 0)
+  if (rhs->getStmtClass() == Stmt::ImplicitCastExprClass)
   {
-    std::cerr << "\tImplicitCastExpr: " << "\n";
+    getErrStream() << "\tImplicitCastExpr: " << "\n";
 
     const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(rhs);
 
@@ -2603,7 +2364,7 @@ void MyProcessStmt::getLHSAndRHSForShCAO(CompoundAssignOperator* E)
 
     if (ICE->getCastKind() == CK_LValueToRValue)
     {
-      std::cerr << "\tLValueToRValue " << "\n";
+      getErrStream() << "\tLValueToRValue " << "\n";
 
       const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(se);
 
@@ -2611,12 +2372,11 @@ void MyProcessStmt::getLHSAndRHSForShCAO(CompoundAssignOperator* E)
 
       if (valueDecl)
       {
-        std::string varName = valueDecl->getNameAsString();
-        std::string varType = getTypeAsString(valueDecl);
-        std::cerr << "\tRHS identifier = " << varName << "\n";
-        std::cerr << "\ttype: " << varType << "\n";
+        VariableCount* var = getVariableSymbol(valueDecl);
+        getErrStream() << "\tRHS identifier = " << var->varName << "\n";
+        getErrStream() << "\ttype: " << var->varType << "\n";
 
-        getVariable(varName.c_str(), varType.c_str());
+        getVariable(var);
 
         rhsFound = 1;
       }
@@ -2624,12 +2384,12 @@ void MyProcessStmt::getLHSAndRHSForShCAO(CompoundAssignOperator* E)
     else
     if (ICE->getCastKind() == CK_IntegralCast)
     {
-      std::cerr << "\tIntegralCast " << "\n";
+      getErrStream() << "\tIntegralCast " << "\n";
 
       const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(se);
 
       double dval = IL->getValue().signedRoundToDouble();
-      std::cerr << "\tRHS value: " << dval << "\n";
+      getErrStream() << "\tRHS value: " << dval << "\n";
 
       getIntegerLiteral(dval);
 
@@ -2638,16 +2398,16 @@ void MyProcessStmt::getLHSAndRHSForShCAO(CompoundAssignOperator* E)
     else
     if (ICE->getCastKind() == CK_FloatingCast)
     {
-      std::cerr << "\tFloatingCast \n";
+      getErrStream() << "\tFloatingCast \n";
 
-      if (strcmp(se->getStmtClassName(), "FloatingLiteral") == 0)
+      if (se->getStmtClass() == Stmt::FloatingLiteralClass)
       {
-        std::cerr << "\tFloatingLiteral: \n";
+        getErrStream() << "\tFloatingLiteral: \n";
 
         const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(se);
 
         double dval = FL->getValue().convertToDouble();
-        std::cerr << "\tRHS value: " << dval << "\n";
+        getErrStream() << "\tRHS value: " << dval << "\n";
 
         getFloatingLiteral(dval);
 
@@ -2659,25 +2419,26 @@ void MyProcessStmt::getLHSAndRHSForShCAO(CompoundAssignOperator* E)
 
   if (!rhsFound)
   {
-    std::cout << "\n!rhsFound\n";
-    std::cout << "\nCannot determine rhs -> we are at operator node\n";
+    getOutStream() << "\n!rhsFound\n";
+    getOutStream() << "\nCannot determine rhs -> we are at operator node\n";
 
     TraverseStmt((Stmt*) rhs);
   }
 
   //Create a new temporary variable.
-  createSingleExpressionForBinShiftOp(opcode.c_str(),assignCount);
+  createSingleExpressionForBinShiftOp(opcode,m_context->assignCount);
   //Set value of lhs to the new temp variable.
-  evaluateAssignment(lhsVarName.c_str(), assignCount, m_isLastStatement);
+  evaluateAssignment(lhsVar,
+    m_context->assignCount, m_isLastStatement);
 
-  assignCount--;
+  m_context->assignCount--;
 
-  if (isCascadedAssign == false)
+  if (m_context->isCascadedAssign == false)
   {
     removeTemporaryVariables();
   }
 
-  if (assignCount == 0)
+  if (m_context->assignCount == 0)
   {
     removeTemporaryVariables();
   }
@@ -2690,8 +2451,8 @@ void MyProcessStmt::getLHSAndRHSForShCAO(CompoundAssignOperator* E)
 bool MyProcessStmt::VisitBinShlAssign(CompoundAssignOperator* E)
 {
   // BO_ShlAssign <<=
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tShift Assignment Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tShift Assignment Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForShCAO(E);
 
@@ -2702,8 +2463,8 @@ bool MyProcessStmt::VisitBinShlAssign(CompoundAssignOperator* E)
 bool MyProcessStmt::VisitBinShrAssign(CompoundAssignOperator* E)
 {
   // BO_ShrAssign >>=
-  std::cerr << "\n    Found BinaryOperator \n";
-  std::cerr << "\tShift Assignment Op " << E->getOpcodeStr() << "\n";
+  getErrStream() << "\n    Found BinaryOperator \n";
+  getErrStream() << "\tShift Assignment Op " << E->getOpcodeStr() << "\n";
 
   getLHSAndRHSForShCAO(E);
 
@@ -2715,8 +2476,8 @@ bool MyProcessStmt::VisitBinShrAssign(CompoundAssignOperator* E)
 /// \brief Override visit method for unary operator -
 bool MyProcessStmt::VisitUnaryMinus(UnaryOperator *E)
 {
-  std::string opcode = E->getOpcodeStr(E->getOpcode());
-  std::cerr << "\tArithmetic Unary Op " << opcode << "\n";
+  UnaryOperatorKind opcode = E->getOpcode();
+  getErrStream() << "\tArithmetic Unary Op " << E->getOpcodeStr(opcode) << "\n";
 
   // get sub expression
   Expr* subexpr = E->getSubExpr();
@@ -2727,25 +2488,25 @@ bool MyProcessStmt::VisitUnaryMinus(UnaryOperator *E)
   // flag to indicate unary subexpression received
   int got_unary_subexpr = 0;
 
-  if (strcmp(subexpr->getStmtClassName(), "IntegerLiteral") == 0)
+  double dval;
+
+  if (getIntegerConstant(subexpr, dval))
   {
-    const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(subexpr);
-    double dval = IL->getValue().signedRoundToDouble();
 
-    getIntegerLiteralUnaryOp(dval, opcode.c_str());
+    getIntegerLiteralUnaryOp(dval, opcode);
     got_unary_subexpr = 1;
   }
   else
-  if (strcmp(subexpr->getStmtClassName(), "FloatingLiteral") == 0)
+  if (subexpr->getStmtClass() == Stmt::FloatingLiteralClass)
   {
     const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(subexpr);
     double dval = FL->getValue().convertToDouble();
 
-    getFloatingLiteralUnaryOp(dval, opcode.c_str());
+    getFloatingLiteralUnaryOp(dval, opcode);
     got_unary_subexpr = 1;
   }
   else
-  if (strcmp(subexpr->getStmtClassName(), "DeclRefExpr") == 0)
+  if (subexpr->getStmtClass() == Stmt::DeclRefExprClass)
   {
     const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(subexpr);
 
@@ -2755,19 +2516,18 @@ bool MyProcessStmt::VisitUnaryMinus(UnaryOperator *E)
 
       if (valueDecl)
       {
-        std::string uVarName = valueDecl->getNameAsString();
-        std::string uVarType = getTypeAsString(valueDecl);
-        std::cerr << "\tunary op identifier = " << uVarName << "\n";
-        std::cerr << "\ttype: " << uVarType << "\n";
+        VariableCount* uVar = getVariableSymbol(valueDecl);
+        getErrStream() << "\tunary op identifier = " << uVar->varName << "\n";
+        getErrStream() << "\ttype: " << uVar->varType << "\n";
 
-        getVariableUnaryOp(uVarName.c_str(), uVarType.c_str(),
-          opcode.c_str());
+        getVariableUnaryOp(uVar,
+          opcode);
         got_unary_subexpr = 1;
       }
     }
   }
   else
-  if (strcmp(subexpr->getStmtClassName(), "ImplicitCastExpr") == 0)
+  if (subexpr->getStmtClass() == Stmt::ImplicitCastExprClass)
   {
     const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(subexpr);
     const Expr *se = ICE->getSubExpr();
@@ -2783,13 +2543,12 @@ bool MyProcessStmt::VisitUnaryMinus(UnaryOperator *E)
 
         if (valueDecl)
         {
-          std::string uVarName = valueDecl->getNameAsString();
-          std::string uVarType = getTypeAsString(valueDecl);
-          std::cerr << "\tunary op identifier = " << uVarName << "\n";
-          std::cerr << "\ttype: " << uVarType << "\n";
+          VariableCount* uVar = getVariableSymbol(valueDecl);
+          getErrStream() << "\tunary op identifier = " << uVar->varName << "\n";
+          getErrStream() << "\ttype: " << uVar->varType << "\n";
 
-          getVariableUnaryOp(uVarName.c_str(), uVarType.c_str(),
-            opcode.c_str());
+          getVariableUnaryOp(uVar,
+            opcode);
           got_unary_subexpr = 1;
         }
       }
@@ -2805,7 +2564,7 @@ bool MyProcessStmt::VisitUnaryMinus(UnaryOperator *E)
 
     // get the expression, negate it and add to MyApronExpr list
     // e.g -(x + 1)
-    createSingleExpressionForUnaryOp(opcode.c_str());
+    createSingleExpressionForUnaryOp(opcode);
   }
 
   return false;
@@ -2814,8 +2573,8 @@ bool MyProcessStmt::VisitUnaryMinus(UnaryOperator *E)
 /// \brief Override visit method for unary operator +
 bool MyProcessStmt::VisitUnaryPlus(UnaryOperator *E)
 {
-  std::string opcode = E->getOpcodeStr(E->getOpcode());
-  std::cerr << "\tArithmetic Unary Op " << opcode << "\n";
+  UnaryOperatorKind opcode = E->getOpcode();
+  getErrStream() << "\tArithmetic Unary Op " << E->getOpcodeStr(opcode) << "\n";
 
   // get sub expression
   Expr* subexpr = E->getSubExpr();
@@ -2825,27 +2584,27 @@ bool MyProcessStmt::VisitUnaryPlus(UnaryOperator *E)
   // flag to indicate unary subexpression received
   int got_unary_subexpr = 0;
 
-  if (strcmp(subexpr->getStmtClassName(), "IntegerLiteral") == 0)
+  double dval;
+
+  if (getIntegerConstant(subexpr, dval))
   {
-    const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(subexpr);
-    double dval = IL->getValue().signedRoundToDouble();
-    std::cerr << "\tvalue: " << dval << "\n";
+    getErrStream() << "\tvalue: " << dval << "\n";
 
-    getIntegerLiteralUnaryOp(dval, opcode.c_str());
+    getIntegerLiteralUnaryOp(dval, opcode);
     got_unary_subexpr = 1;
   }
   else
-  if (strcmp(subexpr->getStmtClassName(), "FloatingLiteral") == 0)
+  if (subexpr->getStmtClass() == Stmt::FloatingLiteralClass)
   {
     const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(subexpr);
     double dval = FL->getValue().convertToDouble();
-    std::cerr << "\tvalue: " << dval << "\n";
+    getErrStream() << "\tvalue: " << dval << "\n";
 
-    getFloatingLiteralUnaryOp(dval, opcode.c_str());
+    getFloatingLiteralUnaryOp(dval, opcode);
     got_unary_subexpr = 1;
   }
   else
-  if (strcmp(subexpr->getStmtClassName(), "DeclRefExpr") == 0)
+  if (subexpr->getStmtClass() == Stmt::DeclRefExprClass)
   {
     const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(subexpr);
 
@@ -2855,19 +2614,18 @@ bool MyProcessStmt::VisitUnaryPlus(UnaryOperator *E)
 
       if (valueDecl)
       {
-        std::string uVarName = valueDecl->getNameAsString();
-        std::string uVarType = getTypeAsString(valueDecl);
-        std::cerr << "\tunary op identifier = " << uVarName << "\n";
-        std::cerr << "\ttype: " << uVarType << "\n";
+        VariableCount* uVar = getVariableSymbol(valueDecl);
+        getErrStream() << "\tunary op identifier = " << uVar->varName << "\n";
+        getErrStream() << "\ttype: " << uVar->varType << "\n";
 
-        getVariableUnaryOp(uVarName.c_str(), uVarType.c_str(),
-          opcode.c_str());
+        getVariableUnaryOp(uVar,
+          opcode);
         got_unary_subexpr = 1;
       }
     }
   }
   else
-  if (strcmp(subexpr->getStmtClassName(), "ImplicitCastExpr") == 0)
+  if (subexpr->getStmtClass() == Stmt::ImplicitCastExprClass)
   {
     const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(subexpr);
     const Expr *se = ICE->getSubExpr();
@@ -2883,13 +2641,12 @@ bool MyProcessStmt::VisitUnaryPlus(UnaryOperator *E)
 
         if (valueDecl)
         {
-          std::string uVarName = valueDecl->getNameAsString();
-          std::string uVarType = getTypeAsString(valueDecl);
-          std::cerr << "\tunary op identifier = " << uVarName << "\n";
-          std::cerr << "\ttype: " << uVarType << "\n";
+          VariableCount* uVar = getVariableSymbol(valueDecl);
+          getErrStream() << "\tunary op identifier = " << uVar->varName << "\n";
+          getErrStream() << "\ttype: " << uVar->varType << "\n";
 
-          getVariableUnaryOp(uVarName.c_str(), uVarType.c_str(),
-            opcode.c_str());
+          getVariableUnaryOp(uVar,
+            opcode);
           got_unary_subexpr = 1;
         }
       }
@@ -2905,7 +2662,7 @@ bool MyProcessStmt::VisitUnaryPlus(UnaryOperator *E)
 
     // get the expression and add to MyApronExpr list
     // e.g +(x + 1)
-    createSingleExpressionForUnaryOp(opcode.c_str());
+    createSingleExpressionForUnaryOp(opcode);
   }
 
   return false;
@@ -2914,16 +2671,19 @@ bool MyProcessStmt::VisitUnaryPlus(UnaryOperator *E)
 /// \brief Override visit method for unary operator ++ (a++)
 bool MyProcessStmt::VisitUnaryPostInc(UnaryOperator *E)
 {
-  std::cerr << "\n    Found UnaryOperator \n";
-  std::cerr << "\tUnary post Increment Op " << E->getOpcodeStr(E->getOpcode());
-  std::cerr << "\n";
+  getErrStream() << "\n    Found UnaryOperator \n";
+  getErrStream() << "\tUnary post Increment Op "
+    << E->getOpcodeStr(E->getOpcode());
+  getErrStream() << "\n";
 
-  std::string varName;
-  varName = getOperandForUnaryOp(E);
+  VariableCount* var = getOperandForUnaryOp(E);
 
-  doPostIncrement(varName.c_str(), assignCount);
+  if (var)
+  {
+    doPostIncrement(var, m_context->assignCount);
+  }
 
-  if (assignCount == 0)
+  if (m_context->assignCount == 0)
   {
     removeTemporaryVariables();
   }
@@ -2934,16 +2694,19 @@ bool MyProcessStmt::VisitUnaryPostInc(UnaryOperator *E)
 /// \brief Override visit method for unary operator -- (a--)
 bool MyProcessStmt::VisitUnaryPostDec(UnaryOperator *E)
 {
-  std::cerr << "\n    Found UnaryOperator \n";
-  std::cerr << "\tUnary pre Increment Op " << E->getOpcodeStr(E->getOpcode());
-  std::cerr << "\n";
+  getErrStream() << "\n    Found UnaryOperator \n";
+  getErrStream() << "\tUnary pre Increment Op "
+    << E->getOpcodeStr(E->getOpcode());
+  getErrStream() << "\n";
 
-  std::string varName;
-  varName = getOperandForUnaryOp(E);
+  VariableCount* var = getOperandForUnaryOp(E);
 
-  doPostDecrement(varName.c_str(), assignCount);
+  if (var)
+  {
+    doPostDecrement(var, m_context->assignCount);
+  }
 
-  if (assignCount == 0)
+  if (m_context->assignCount == 0)
   {
     removeTemporaryVariables();
   }
@@ -2954,16 +2717,19 @@ bool MyProcessStmt::VisitUnaryPostDec(UnaryOperator *E)
 /// \brief Override visit method for unary operator ++ (++a)
 bool MyProcessStmt::VisitUnaryPreInc(UnaryOperator *E)
 {
-  std::cerr << "\n    Found UnaryOperator \n";
-  std::cerr << "\tUnary pre Increment Op " << E->getOpcodeStr(E->getOpcode());
-  std::cerr << "\n";
+  getErrStream() << "\n    Found UnaryOperator \n";
+  getErrStream() << "\tUnary pre Increment Op "
+    << E->getOpcodeStr(E->getOpcode());
+  getErrStream() << "\n";
 
-  std::string varName;
-  varName = getOperandForUnaryOp(E);
+  VariableCount* var = getOperandForUnaryOp(E);
 
-  doPreIncrement(varName.c_str(), assignCount);
+  if (var)
+  {
+    doPreIncrement(var, m_context->assignCount);
+  }
 
-  if (assignCount == 0)
+  if (m_context->assignCount == 0)
   {
     removeTemporaryVariables();
   }
@@ -2974,16 +2740,19 @@ bool MyProcessStmt::VisitUnaryPreInc(UnaryOperator *E)
 /// \brief Override visit method for unary operator -- (--a)
 bool MyProcessStmt::VisitUnaryPreDec(UnaryOperator *E)
 {
-  std::cerr << "\n    Found UnaryOperator \n";
-  std::cerr << "\tUnary pre Decrement Op " << E->getOpcodeStr(E->getOpcode());
-  std::cerr << "\n";
+  getErrStream() << "\n    Found UnaryOperator \n";
+  getErrStream() << "\tUnary pre Decrement Op "
+    << E->getOpcodeStr(E->getOpcode());
+  getErrStream() << "\n";
 
-  std::string varName;
-  varName = getOperandForUnaryOp(E);
+  VariableCount* var = getOperandForUnaryOp(E);
 
-  doPreDecrement(varName.c_str(), assignCount);
+  if (var)
+  {
+    doPreDecrement(var, m_context->assignCount);
+  }
 
-  if (assignCount)
+  if (m_context->assignCount)
   {
     removeTemporaryVariables();
   }
@@ -2994,7 +2763,7 @@ bool MyProcessStmt::VisitUnaryPreDec(UnaryOperator *E)
 /// \brief Override visit method for UO_AddrOf operator &
 bool MyProcessStmt::VisitUnaryAddrOf(UnaryOperator *S)
 {
-  std::cerr <<"\n\tfound UO_AddrOf & \n";
+  getErrStream() <<"\n\tfound UO_AddrOf & \n";
 
   return false;
 }
@@ -3002,7 +2771,7 @@ bool MyProcessStmt::VisitUnaryAddrOf(UnaryOperator *S)
 /// \brief Override visit method for UO_Deref operator *
 bool MyProcessStmt::VisitUnaryDeref(UnaryOperator *S)
 {
-  std::cerr <<"\n\tfound UO_Deref * \n";
+  getErrStream() <<"\n\tfound UO_Deref * \n";
 
   return false;
 }
@@ -3010,8 +2779,8 @@ bool MyProcessStmt::VisitUnaryDeref(UnaryOperator *S)
 /// \brief Override visit method for UO_LNot operator !
 bool MyProcessStmt::VisitUnaryLNot(UnaryOperator *E)
 {
-  std::string opcode = E->getOpcodeStr(E->getOpcode());
-  std::cerr << "\tLogical Unary Op " << opcode << "\n";
+  UnaryOperatorKind opcode = E->getOpcode();
+  getErrStream() << "\tLogical Unary Op " << E->getOpcodeStr(opcode) << "\n";
 
   // get sub expression
   Expr* subexpr = E->getSubExpr();
@@ -3021,27 +2790,13 @@ bool MyProcessStmt::VisitUnaryLNot(UnaryOperator *E)
   // flag to indicate unary subexpression received
   int got_unary_subexpr = 0;
 
-  if (strcmp(subexpr->getStmtClassName(), "IntegerLiteral") == 0)
+  // e.g. !0, !(3 > 2)
+  if (setConstantCondition(subexpr))
   {
-    const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(subexpr);
-    double dval = IL->getValue().signedRoundToDouble();
-    std::cerr << "\tvalue: " << dval << "\n";
-
-    if (dval == 0)
-    {
-      std::cerr << "\t\tIntegerLiteral is zero! \n";
-      setAbstractMemory(0);
-    }
-    else
-    {
-      std::cerr << "\t\tIntegerLiteral is non-zero! \n";
-      setAbstractMemory(1);
-    }
-
     got_unary_subexpr = 1;
   }
   else
-  if (strcmp(subexpr->getStmtClassName(), "FloatingLiteral") == 0)
+  if (subexpr->getStmtClass() == Stmt::FloatingLiteralClass)
   {
     const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(subexpr);
     double dval = FL->getValue().convertToDouble();
@@ -3051,7 +2806,7 @@ bool MyProcessStmt::VisitUnaryLNot(UnaryOperator *E)
     got_unary_subexpr = 1;
   }
   else
-  if (strcmp(subexpr->getStmtClassName(), "DeclRefExpr") == 0)
+  if (subexpr->getStmtClass() == Stmt::DeclRefExprClass)
   {
     const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(subexpr);
 
@@ -3061,10 +2816,9 @@ bool MyProcessStmt::VisitUnaryLNot(UnaryOperator *E)
 
       if (valueDecl)
       {
-        std::string uVarName = valueDecl->getNameAsString();
-        std::string uVarType = getTypeAsString(valueDecl);
-        std::cerr << "\tunary op identifier = " << uVarName << "\n";
-        std::cerr << "\ttype: " << uVarType << "\n";
+        VariableCount* uVar = getVariableSymbol(valueDecl);
+        getErrStream() << "\tunary op identifier = " << uVar->varName << "\n";
+        getErrStream() << "\ttype: " << uVar->varType << "\n";
 
         setAbstractMemory(2);
         got_unary_subexpr = 1;
@@ -3072,7 +2826,7 @@ bool MyProcessStmt::VisitUnaryLNot(UnaryOperator *E)
     }
   }
   else
-  if (strcmp(subexpr->getStmtClassName(), "ImplicitCastExpr") == 0)
+  if (subexpr->getStmtClass() == Stmt::ImplicitCastExprClass)
   {
     const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(subexpr);
     const Expr *se = ICE->getSubExpr();
@@ -3088,10 +2842,9 @@ bool MyProcessStmt::VisitUnaryLNot(UnaryOperator *E)
 
         if (valueDecl)
         {
-          std::string uVarName = valueDecl->getNameAsString();
-          std::string uVarType = getTypeAsString(valueDecl);
-          std::cerr << "\tunary op identifier = " << uVarName << "\n";
-          std::cerr << "\ttype: " << uVarType << "\n";
+          VariableCount* uVar = getVariableSymbol(valueDecl);
+          getErrStream() << "\tunary op identifier = " << uVar->varName << "\n";
+          getErrStream() << "\ttype: " << uVar->varType << "\n";
 
           setAbstractMemory(2);
           got_unary_subexpr = 1;
@@ -3117,8 +2870,8 @@ bool MyProcessStmt::VisitUnaryLNot(UnaryOperator *E)
 /// \brief Override visit method for UO_Not operator ~
 bool MyProcessStmt::VisitUnaryNot(UnaryOperator *E)
 {
-  std::string opcode = E->getOpcodeStr(E->getOpcode());
-  std::cerr << "\tUnary Op " << opcode << "\n";
+  UnaryOperatorKind opcode = E->getOpcode();
+  getErrStream() << "\tUnary Op " << E->getOpcodeStr(opcode) << "\n";
 
   return false;
 }
@@ -3126,39 +2879,25 @@ bool MyProcessStmt::VisitUnaryNot(UnaryOperator *E)
 /// \brief Override VisitIfStmt to get condition, then clause and else clause
 bool MyProcessStmt::VisitIfStmt(Stmt *s)
 {
-  std::cerr << "\tfound if stmt in B" << this->m_blockId << "\n";
+  getErrStream() << "\tfound if stmt in B" << this->m_blockId << "\n";
 
   // Cast s to IfStmt to access then and else clauses
   IfStmt *If = cast<IfStmt>(s);
 
   const Expr* cond = If->getCond();
-  std::cerr << "\t=> condition: \n";
-  std::cerr << "\tStatement class: " << cond->getStmtClassName();
+  getErrStream() << "\t=> condition: \n";
+  getErrStream() << "\tStatement class: " << cond->getStmtClassName();
 
   if (cond)
   {
-    // Find if (1) or if (0)
-    if (strcmp(cond->getStmtClassName(), "IntegerLiteral") == 0)
+    // Find if (1), if (0) or a constant condition
+    if (setConstantCondition(cond))
     {
-      // condition is integer literal, no need to traverse further
-      const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(cond);
-      double val = IL->getValue().signedRoundToDouble();
-      std::cerr << "\t\tvalue: " << val << "\n";
-
-      if (val == 0)
-      {
-        std::cerr << "\t\tIntegerLiteral is zero! \n";
-        setAbstractMemory(0);
-      }
-      else
-      {
-        std::cerr << "\t\tIntegerLiteral is non-zero! \n";
-        setAbstractMemory(1);
-      }
+      // condition is constant, no need to traverse further
     }
     else
     // Find if (x)
-    if (strcmp(cond->getStmtClassName(), "ImplicitCastExpr") == 0)
+    if (cond->getStmtClass() == Stmt::ImplicitCastExprClass)
     {
       const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(cond);
 
@@ -3174,10 +2913,9 @@ bool MyProcessStmt::VisitIfStmt(Stmt *s)
 
           if (valueDecl)
           {
-            std::string varName = valueDecl->getNameAsString();
-            std::string varType = getTypeAsString(valueDecl);
-            std::cerr << "\tidentifier = " << varName << "\n";
-            std::cerr << "\ttype: " << varType << "\n";
+            VariableCount* var = getVariableSymbol(valueDecl);
+            getErrStream() << "\tidentifier = " << var->varName << "\n";
+            getErrStream() << "\ttype: " << var->varType << "\n";
 
             setAbstractMemory(2);
           }
@@ -3186,10 +2924,10 @@ bool MyProcessStmt::VisitIfStmt(Stmt *s)
     }
     else
     // Find if (x = y)
-    if ((strcmp(cond->getStmtClassName(), "BinaryOperator") == 0) &&
-        (strcmp(((BinaryOperator*)cond)->getOpcodeStr(), "=") == 0) )
+    if ((cond->getStmtClass() == Stmt::BinaryOperatorClass) &&
+        (((BinaryOperator*)cond)->getOpcode() == BO_Assign) )
     {
-      std::cerr << "Assignment found in condition!\n";
+      getErrStream() << "Assignment found in condition!\n";
     }
     else
     {
@@ -3203,39 +2941,25 @@ bool MyProcessStmt::VisitIfStmt(Stmt *s)
 /// \brief Override VisitWhileStmt to get condition and compound stmt block
 bool MyProcessStmt::VisitWhileStmt(Stmt *s)
 {
-  std::cerr << "\n\tfound while in B" << this->m_blockId << "\n";
+  getErrStream() << "\n\tfound while in B" << this->m_blockId << "\n";
 
   // Cast s to WhileStmt to access cond and body of while
   WhileStmt* While = cast<WhileStmt>(s);
 
   const Expr* cond = While->getCond();
-  std::cerr << "\t=> condition: \n";
-  std::cerr << "\tStatement class: " << cond->getStmtClassName();
+  getErrStream() << "\t=> condition: \n";
+  getErrStream() << "\tStatement class: " << cond->getStmtClassName();
 
   if (cond)
   {
-    // Find while (1) or while (0)
-    if (strcmp(cond->getStmtClassName(), "IntegerLiteral") == 0)
+    // Find while (1), while (0) or a constant condition
+    if (setConstantCondition(cond))
     {
-      // condition is integer literal, no need to traverse further
-      const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(cond);
-      double dval = IL->getValue().signedRoundToDouble();
-      std::cerr << "\t\tvalue: " << dval << "\n";
-
-      if (dval == 0)
-      {
-        std::cerr << "\t\tIntegerLiteral is zero! \n";
-        setAbstractMemory(0);
-      }
-      else
-      {
-        std::cerr << "\t\tIntegerLiteral is non-zero! \n";
-        setAbstractMemory(1);
-      }
+      // condition is constant, no need to traverse further
     }
     else
     // Find while (x)
-    if (strcmp(cond->getStmtClassName(), "ImplicitCastExpr") == 0)
+    if (cond->getStmtClass() == Stmt::ImplicitCastExprClass)
     {
       const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(cond);
 
@@ -3251,10 +2975,9 @@ bool MyProcessStmt::VisitWhileStmt(Stmt *s)
 
           if (valueDecl)
           {
-            std::string varName = valueDecl->getNameAsString();
-            std::string varType = getTypeAsString(valueDecl);
-            std::cerr << "\tidentifier = " << varName << "\n";
-            std::cerr << "\ttype: " << varType << "\n";
+            VariableCount* var = getVariableSymbol(valueDecl);
+            getErrStream() << "\tidentifier = " << var->varName << "\n";
+            getErrStream() << "\ttype: " << var->varType << "\n";
         
             setAbstractMemory(2);
           }
@@ -3263,10 +2986,10 @@ bool MyProcessStmt::VisitWhileStmt(Stmt *s)
     }
     else
     // Find while (x = y)
-    if ((strcmp(cond->getStmtClassName(), "BinaryOperator") == 0) &&
-        (strcmp(((BinaryOperator*)cond)->getOpcodeStr(), "=") == 0) )
+    if ((cond->getStmtClass() == Stmt::BinaryOperatorClass) &&
+        (((BinaryOperator*)cond)->getOpcode() == BO_Assign) )
     {
-      std::cerr << "Assignment found in condition!\n";
+      getErrStream() << "Assignment found in condition!\n";
     }
     else
     {
@@ -3280,39 +3003,25 @@ bool MyProcessStmt::VisitWhileStmt(Stmt *s)
 /// \brief Override VisitDoStmt to get condition and compound stmt block
 bool MyProcessStmt::VisitDoStmt(Stmt *s)
 {
-  std::cerr << "\n\tfound do-while in B" << this->m_blockId << "\n";
+  getErrStream() << "\n\tfound do-while in B" << this->m_blockId << "\n";
 
   // Cast s to DoStmt to access cond and body of do-while
   DoStmt* do_while = cast<DoStmt>(s);
 
   const Expr* cond = do_while->getCond();
-  std::cerr << "\t=> condition: \n";
-  std::cerr << "\tStatement class: " << cond->getStmtClassName();
+  getErrStream() << "\t=> condition: \n";
+  getErrStream() << "\tStatement class: " << cond->getStmtClassName();
 
   if (cond)
   {
-    // Find while (1) or while (0)
-    if (strcmp(cond->getStmtClassName(), "IntegerLiteral") == 0)
+    // Find while (1), while (0) or a constant condition
+    if (setConstantCondition(cond))
     {
-      // condition is integer literal, no need to traverse further
-      const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(cond);
-      double val = IL->getValue().signedRoundToDouble();
-      std::cerr << "\t\tvalue: " << val << "\n";
-
-      if (val == 0)
-      {
-        std::cerr << "\t\tIntegerLiteral is zero! \n";
-        setAbstractMemory(0);
-      }
-      else
-      {
-        std::cerr << "\t\tIntegerLiteral is non-zero! \n";
-        setAbstractMemory(1);
-      }
+      // condition is constant, no need to traverse further
     }
     else
     // Find while (x)
-    if (strcmp(cond->getStmtClassName(), "ImplicitCastExpr") == 0)
+    if (cond->getStmtClass() == Stmt::ImplicitCastExprClass)
     {
       const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(cond);
 
@@ -3328,20 +3037,19 @@ bool MyProcessStmt::VisitDoStmt(Stmt *s)
 
           if (valueDecl)
           {
-            std::string varName = valueDecl->getNameAsString();
-            std::string varType = getTypeAsString(valueDecl);
-            std::cerr << "\tidentifier = " << varName << "\n";
-            std::cerr << "\ttype: " << varType << "\n";
+            VariableCount* var = getVariableSymbol(valueDecl);
+            getErrStream() << "\tidentifier = " << var->varName << "\n";
+            getErrStream() << "\ttype: " << var->varType << "\n";
           }
         }
       }
     }
     else
     // Find while (x = y)
-    if ((strcmp(cond->getStmtClassName(), "BinaryOperator") == 0) &&
-        (strcmp(((BinaryOperator*)cond)->getOpcodeStr(), "=") == 0) )
+    if ((cond->getStmtClass() == Stmt::BinaryOperatorClass) &&
+        (((BinaryOperator*)cond)->getOpcode() == BO_Assign) )
     {
-      std::cerr << "Assignment found in condition!\n";
+      getErrStream() << "Assignment found in condition!\n";
     }
     else
     {
@@ -3356,39 +3064,25 @@ bool MyProcessStmt::VisitDoStmt(Stmt *s)
 /// section and compound stmt body
 bool MyProcessStmt::VisitForStmt(Stmt *s)
 {
-  std::cerr << "\n\tfound for stmt in B" << this->m_blockId << "\n";
+  getErrStream() << "\n\tfound for stmt in B" << this->m_blockId << "\n";
 
   // Cast s to ForStmt to access init, cond, inc, body of for
   ForStmt* For = cast<ForStmt>(s);
 
   const Expr* cond = For->getCond();
-  std::cerr << "\n\t=> condition: \n";
-  std::cerr << "\tStatement class: " << cond->getStmtClassName();
+  getErrStream() << "\n\t=> condition: \n";
+  getErrStream() << "\tStatement class: " << cond->getStmtClassName();
 
   if (cond)
   {
     // Find for (1) or (0)
-    if (strcmp(cond->getStmtClassName(), "IntegerLiteral") == 0)
+    if (setConstantCondition(cond))
     {
-      // condition is integer literal, no need to traverse further
-      const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(cond);
-      double val = IL->getValue().signedRoundToDouble();
-      std::cerr << "\t\tvalue: " << val << "\n";
-
-      if (val == 0)
-      {
-        std::cerr << "\t\tIntegerLiteral is zero! \n";
-        setAbstractMemory(0);
-      }
-      else
-      {
-        std::cerr << "\t\tIntegerLiteral is non-zero! \n";
-        setAbstractMemory(1);
-      }
+      // condition is constant, no need to traverse further
     }
     else
     // Find for (x)
-    if (strcmp(cond->getStmtClassName(), "ImplicitCastExpr") == 0)
+    if (cond->getStmtClass() == Stmt::ImplicitCastExprClass)
     {
       const ImplicitCastExpr *ICE = dyn_cast<ImplicitCastExpr>(cond);
 
@@ -3404,20 +3098,19 @@ bool MyProcessStmt::VisitForStmt(Stmt *s)
 
           if (valueDecl)
           {
-            std::string varName = valueDecl->getNameAsString();
-            std::string varType = getTypeAsString(valueDecl);
-            std::cerr << "\tidentifier = " << varName << "\n";
-            std::cerr << "\ttype: " << varType << "\n";
+            VariableCount* var = getVariableSymbol(valueDecl);
+            getErrStream() << "\tidentifier = " << var->varName << "\n";
+            getErrStream() << "\ttype: " << var->varType << "\n";
           }
         }
       }
     }
     else
     // Find for (x = y)
-    if ((strcmp(cond->getStmtClassName(), "BinaryOperator") == 0) &&
-        (strcmp(((BinaryOperator*)cond)->getOpcodeStr(), "=") == 0) )
+    if ((cond->getStmtClass() == Stmt::BinaryOperatorClass) &&
+        (((BinaryOperator*)cond)->getOpcode() == BO_Assign) )
     {
-      std::cerr << "Assignment found in condition!\n";
+      getErrStream() << "Assignment found in condition!\n";
     }
     else
     {
@@ -3431,22 +3124,23 @@ bool MyProcessStmt::VisitForStmt(Stmt *s)
 /// \brief Override visit method for conditional operator ?:
 bool MyProcessStmt::VisitConditionalOperator(ConditionalOperator* s)
 {
-  std::cerr << "\tfound conditional operator in B" << this->m_blockId << "\n";
+  getErrStream() << "\tfound conditional operator in B" << this->m_blockId
+    << "\n";
 
   // Cast s to ConditionalOperator to access condition, true and false expression
   ConditionalOperator *CO = cast<ConditionalOperator>(s);
 
-  std::cerr << "\t=> condition: \n";
+  getErrStream() << "\t=> condition: \n";
   const Expr* cond = CO->getCond();
 
   if (cond)
   {
-    if (strcmp(cond->getStmtClassName(), "IntegerLiteral") == 0)
+    if (cond->getStmtClass() == Stmt::IntegerLiteralClass)
     {
       // condition is integer literal, no need to traverse further
       const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(cond);
       double val = IL->getValue().signedRoundToDouble();
-      std::cerr << "\tvalue: " << val << "\n";
+      getErrStream() << "\tvalue: " << val << "\n";
     }
     else
     {
@@ -3454,17 +3148,17 @@ bool MyProcessStmt::VisitConditionalOperator(ConditionalOperator* s)
     }
   }
 
-  std::cerr << "\n\t=> true expression: \n";
+  getErrStream() << "\n\t=> true expression: \n";
   const Expr* TrueExpr = CO->getTrueExpr();
 
   if (TrueExpr)
   {
-    if (strcmp(TrueExpr->getStmtClassName(), "IntegerLiteral") == 0)
+    if (TrueExpr->getStmtClass() == Stmt::IntegerLiteralClass)
     {
       // TrueExpr is integer literal, no need to traverse further
       const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(TrueExpr);
       double val = IL->getValue().signedRoundToDouble();
-      std::cerr << "\tvalue: " << val << "\n";
+      getErrStream() << "\tvalue: " << val << "\n";
     }
     else
     {
@@ -3472,17 +3166,17 @@ bool MyProcessStmt::VisitConditionalOperator(ConditionalOperator* s)
     }
   }
 
-  std::cerr << "\n\t=> false expression: \n";
+  getErrStream() << "\n\t=> false expression: \n";
   const Expr* FalseExpr = CO->getFalseExpr();
 
   if (FalseExpr)
   {
-    if (strcmp(FalseExpr->getStmtClassName(), "IntegerLiteral") == 0)
+    if (FalseExpr->getStmtClass() == Stmt::IntegerLiteralClass)
     {
       // FalseExpr is integer literal, no need to traverse further
       const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(FalseExpr);
       double val = IL->getValue().signedRoundToDouble();
-      std::cerr << "\tvalue: " << val << "\n";
+      getErrStream() << "\tvalue: " << val << "\n";
     }
     else
     {
@@ -3496,7 +3190,7 @@ bool MyProcessStmt::VisitConditionalOperator(ConditionalOperator* s)
 /// \brief Override VisitReturnStmt to get expression of return statement
 bool MyProcessStmt::VisitReturnStmt(Stmt *s)
 {
-  std::cerr << "\treturn stmt: in B" << this->m_blockId << "\n";
+  getErrStream() << "\treturn stmt: in B" << this->m_blockId << "\n";
 
   // Cast s to ReturnStmt to get return value
   ReturnStmt* Return = cast<ReturnStmt>(s);
@@ -3508,50 +3202,38 @@ bool MyProcessStmt::VisitReturnStmt(Stmt *s)
 
   if (ret_value)
   {
-    if (strcmp(ret_value->getStmtClassName(), "IntegerLiteral") == 0)
-    {
-      // return value is integer literal, no need to traverse further
-      const IntegerLiteral *IL = dyn_cast<IntegerLiteral>(ret_value);
-
-      double dval = IL->getValue().signedRoundToDouble();
-      std::cerr << "\tvalue: " << dval << "\n";
+    double dval;
 
-      getIntegerLiteral(dval);
-    }
-    else
-    if (strcmp(ret_value->getStmtClassName(), "CharacterLiteral") == 0)
+    if (getIntegerConstant(ret_value, dval))
     {
-      const CharacterLiteral *CL = dyn_cast<CharacterLiteral>(ret_value);
+      // return value is integer constant, no need to traverse further
+      getErrStream() << "\tvalue: " << dval << "\n";
 
-      unsigned ch = CL->getValue();
-      std::cerr << "\tvalue: " << ch << "\n";
-
-      getIntegerLiteral((double) ch);
+      getIntegerLiteral(dval);
     }
     else
-    if (strcmp(ret_value->getStmtClassName(), "FloatingLiteral") == 0)
+    if (ret_value->getStmtClass() == Stmt::FloatingLiteralClass)
     {
       const FloatingLiteral *FL = dyn_cast<FloatingLiteral>(ret_value);
 
       double dval = FL->getValue().convertToDouble();
-      std::cerr << "\tvalue: " << dval << "\n";
+      getErrStream() << "\tvalue: " << dval << "\n";
 
       getFloatingLiteral(dval);
     }
     else
-    if (strcmp(ret_value->getStmtClassName(), "DeclRefExpr") == 0)
+    if (ret_value->getStmtClass() == Stmt::DeclRefExprClass)
     {
       const DeclRefExpr *declRefExpr = dyn_cast<DeclRefExpr>(ret_value);
       const ValueDecl *valueDecl = declRefExpr->getDecl();
 
       if (valueDecl)
       {
-        std::string varName = valueDecl->getNameAsString();
-        std::string varType = getTypeAsString(valueDecl);
-        std::cerr << "\tvarName = " << (char *)varName.c_str() << "\n";
-        std::cerr << "\tvarType = " << varType << "\n";
+        VariableCount* var = getVariableSymbol(valueDecl);
+        getErrStream() << "\tvarName = " << var->varName << "\n";
+        getErrStream() << "\tvarType = " << var->varType << "\n";
 
-        getVariable(varName.c_str(), varType.c_str());
+        getVariable(var);
       }
     }
     else
@@ -3562,7 +3244,7 @@ bool MyProcessStmt::VisitReturnStmt(Stmt *s)
   }
   else
   {
-    std::cout << "\nEmpty return statement found!\n";
+    getOutStream() << "\nEmpty return statement found!\n";
   }
 
   evaluateReturn();
@@ -3573,7 +3255,7 @@ bool MyProcessStmt::VisitReturnStmt(Stmt *s)
 /// \brief Override VisitNullStmt to traverse null Stmt i.e. ;
 bool MyProcessStmt::VisitNullStmt(Stmt *s)
 {
-  std::cerr << "\t\tNull stmt ;\n";
+  getErrStream() << "\t\tNull stmt ;\n";
   // Nothing to be done for null statement
   return false;
 }
@@ -42,10 +42,30 @@ class MyProcessStmt : public clang::RecursiveASTVisitor<MyProcessStmt>
     /// @return std::string - type in string
     std::string getTypeAsString(const ValueDecl *vd);
 
+    /// \brief Get symbol of a variable declaration, it is added on first use
+    /// if the function has none for it (e.g. global variable)
+    /// @param valueDecl - variable declaration
+    /// @return VariableCount* - symbol of variable
+    VariableCount* getVariableSymbol(const ValueDecl* valueDecl);
+
     /// \brief Get operand for unary incr/decr operator
     /// @param E - unary operator
-    /// @return std::string - operand of unary operator
-    std::string getOperandForUnaryOp(UnaryOperator *E);
+    /// @return VariableCount* - symbol of operand of unary operator, NULL if
+    ///         operand is not a variable
+    VariableCount* getOperandForUnaryOp(UnaryOperator *E);
+
+    /// \brief Fold an integer constant expression (e.g. 2 * 3, enum
+    /// constant, sizeof) with clang's constant evaluator
+    /// @param E - expression
+    /// @param dval - value of expression, set if it is constant
+    /// @return bool - true if E is an integer constant expression
+    bool getIntegerConstant(const Expr* E, double& dval);
+
+    /// \brief Set constraints of a condition which folds to a constant,
+    /// e.g. while (1), while (3 > 2), if (False)
+    /// @param cond - condition
+    /// @return bool - true if constraints of the constant condition are set
+    bool setConstantCondition(const Expr* cond);
 
     // Visit methods for MyProcessStmt
 
@@ -325,6 +345,9 @@ private:
     /// \brief Ignore expression flag to ignore an expression, e.g. array,
     /// struct, pointer, etc.
     bool m_ignoreExpr;
+
+    /// \brief Analysis context of the function this statement belongs to
+    AnalysisContext* m_context;
 };
 
 #endif // MYPROCESSSTMT_H
@@ -0,0 +1,65 @@
+//
+// StatementArena.cpp
+//
+
+/// \file
+/// \brief Defines StatementArena - bump allocator for data that lives as
+/// long as one statement
+///
+#include <stdlib.h>
+
+#include "StatementArena.h"
+
+/// \brief Create empty arena
+StatementArena::StatementArena()
+{
+  m_current = 0;
+  m_offset = 0;
+}
+
+/// \brief Free all chunks
+StatementArena::~StatementArena()
+{
+  for (int i = 0; i < m_chunks.size(); i++)
+  {
+    free(m_chunks[i]);
+  }
+}
+
+/// \brief Allocate memory, aligned for any scalar type
+void* StatementArena::allocate(size_t size)
+{
+  size = (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+  // first chunk (from current one) with enough free space
+  while (m_current < m_chunks.size())
+  {
+    if (m_offset + size <= m_chunkSizes[m_current])
+    {
+      void* memory = m_chunks[m_current] + m_offset;
+      m_offset += size;
+
+      return memory;
+    }
+
+    m_current++;
+    m_offset = 0;
+  }
+
+  size_t chunkSize = (size > CHUNK_SIZE) ? size : CHUNK_SIZE;
+
+  m_chunks.push_back((char *) malloc(chunkSize));
+  m_chunkSizes.push_back(chunkSize);
+
+  m_current = m_chunks.size() - 1;
+  m_offset = size;
+
+  return m_chunks.back();
+}
+
+/// \brief Give back all memory allocated since last reset
+void StatementArena::reset()
+{
+  m_current = 0;
+  m_offset = 0;
+}
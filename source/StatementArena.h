@@ -0,0 +1,144 @@
+//
+// StatementArena.h
+//
+
+/// \file
+/// \brief Defines StatementArena - bump allocator for data that lives as
+/// long as one statement, and ArenaAllocator to back std containers by it
+///
+#include <new>
+#include <stddef.h>
+#include <vector>
+
+#ifndef STATEMENTARENA_H
+# define STATEMENTARENA_H
+
+/// \brief Bump allocator for data of one statement
+///
+/// Memory is taken from large chunks and is never freed one object at a
+/// time, reset() gives all of it back at once and keeps the chunks for the
+/// next statement. Objects allocated in the arena must not need a
+/// destructor.
+class StatementArena
+{
+  public:
+
+    /// \brief Create empty arena
+    StatementArena();
+
+    /// \brief Free all chunks
+    ~StatementArena();
+
+    /// \brief Allocate memory, aligned for any scalar type
+    /// @param size - number of bytes
+    /// @return void* - memory, valid until reset()
+    void* allocate(size_t size);
+
+    /// \brief Give back all memory allocated since last reset
+    /// @return void (nothing)
+    void reset();
+
+  private:
+
+    /// \brief Size of a chunk, larger allocations get a chunk of their own
+    static const size_t CHUNK_SIZE = 16384;
+
+    /// \brief Alignment of every allocation
+    static const size_t ALIGNMENT = 16;
+
+    /// \brief Chunks and their sizes
+    std::vector<char *> m_chunks;
+    std::vector<size_t> m_chunkSizes;
+
+    /// \brief Chunk being filled and first free byte in it
+    size_t m_current;
+    size_t m_offset;
+
+    // Arena owns its chunks, it must not be copied
+    StatementArena(const StatementArena&);
+    StatementArena& operator=(const StatementArena&);
+};
+
+/// \brief Allocator taking memory of a container from a StatementArena,
+/// deallocate() does nothing (memory is given back by reset() of arena)
+template <typename T>
+class ArenaAllocator
+{
+  public:
+
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+
+    template <typename U>
+    struct rebind
+    {
+      typedef ArenaAllocator<U> other;
+    };
+
+    /// \brief Create allocator for an arena
+    /// @param arena - arena to take memory from
+    ArenaAllocator(StatementArena* arena) : m_arena(arena)
+    {
+    }
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : m_arena(other.m_arena)
+    {
+    }
+
+    pointer allocate(size_type n, const void* hint = 0)
+    {
+      return (pointer) m_arena->allocate(n * sizeof(T));
+    }
+
+    void deallocate(pointer p, size_type n)
+    {
+    }
+
+    size_type max_size() const
+    {
+      return ((size_type) -1) / sizeof(T);
+    }
+
+    void construct(pointer p, const T& value)
+    {
+      new ((void *) p) T(value);
+    }
+
+    void destroy(pointer p)
+    {
+      p->~T();
+    }
+
+    pointer address(reference x) const
+    {
+      return &x;
+    }
+
+    const_pointer address(const_reference x) const
+    {
+      return &x;
+    }
+
+    /// \brief Arena memory is taken from
+    StatementArena* m_arena;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{
+  return a.m_arena == b.m_arena;
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{
+  return a.m_arena != b.m_arena;
+}
+
+#endif // STATEMENTARENA_H
@@ -0,0 +1,115 @@
+//
+// TransferProgram.cpp
+//
+
+/// \file
+/// \brief Defines TransferProgram - the effect of the statements of a basic
+/// block on the abstract value as a list of Apron level-0 operations
+///
+#include "TransferProgram.h"
+
+/// \brief Create empty program
+TransferProgram::TransferProgram()
+{
+}
+
+/// \brief Free expressions of the program
+TransferProgram::~TransferProgram()
+{
+  for (int i = 0; i < m_ops.size(); i++)
+  {
+    for (int j = 0; j < m_ops[i].exprs.size(); j++)
+    {
+      ap_texpr0_free(m_ops[i].exprs[j]);
+    }
+
+    for (int j = 0; j < m_ops[i].linexprs.size(); j++)
+    {
+      ap_linexpr0_free(m_ops[i].linexprs[j]);
+    }
+  }
+}
+
+/// \brief Add parallel assignment, expressions are copied
+void TransferProgram::addAssign(const ap_dim_t* dims, ap_texpr0_t** exprs,
+  size_t size)
+{
+  m_ops.push_back(TransferOp());
+
+  TransferOp& op = m_ops.back();
+  op.kind = TRANSFER_ASSIGN;
+  op.dims.assign(dims, dims + size);
+
+  for (int i = 0; i < size; i++)
+  {
+    op.exprs.push_back(ap_texpr0_copy(exprs[i]));
+  }
+}
+
+/// \brief Add parallel assignment of linear expressions, expressions are
+/// copied
+void TransferProgram::addLinearAssign(const ap_dim_t* dims,
+  ap_linexpr0_t** linexprs, size_t size)
+{
+  m_ops.push_back(TransferOp());
+
+  TransferOp& op = m_ops.back();
+  op.kind = TRANSFER_ASSIGN_LINEAR;
+  op.dims.assign(dims, dims + size);
+
+  for (int i = 0; i < size; i++)
+  {
+    op.linexprs.push_back(ap_linexpr0_copy(linexprs[i]));
+  }
+}
+
+/// \brief Add forget of dimensions
+void TransferProgram::addForget(const ap_dim_t* dims, size_t size)
+{
+  m_ops.push_back(TransferOp());
+
+  TransferOp& op = m_ops.back();
+  op.kind = TRANSFER_FORGET;
+  op.dims.assign(dims, dims + size);
+}
+
+/// \brief Run the program on an abstract value (destructive)
+void TransferProgram::run(ap_manager_t* man, ap_abstract1_t* absVal) const
+{
+  for (int i = 0; i < m_ops.size(); i++)
+  {
+    const TransferOp& op = m_ops[i];
+
+    // level-1 environment of value stays the same
+    if (op.kind == TRANSFER_ASSIGN)
+    {
+      absVal->abstract0 = ap_abstract0_assign_texpr_array(man, true,
+        absVal->abstract0, (ap_dim_t *) &op.dims[0],
+        (ap_texpr0_t **) &op.exprs[0], op.dims.size(), NULL);
+    }
+    else
+    if (op.kind == TRANSFER_ASSIGN_LINEAR)
+    {
+      absVal->abstract0 = ap_abstract0_assign_linexpr_array(man, true,
+        absVal->abstract0, (ap_dim_t *) &op.dims[0],
+        (ap_linexpr0_t **) &op.linexprs[0], op.dims.size(), NULL);
+    }
+    else
+    {
+      absVal->abstract0 = ap_abstract0_forget_array(man, true,
+        absVal->abstract0, (ap_dim_t *) &op.dims[0], op.dims.size(), false);
+    }
+  }
+}
+
+/// \brief Get number of operations
+size_t TransferProgram::size() const
+{
+  return m_ops.size();
+}
+
+/// \brief Get an operation
+const TransferOp& TransferProgram::getOp(size_t index) const
+{
+  return m_ops[index];
+}
@@ -0,0 +1,113 @@
+//
+// TransferProgram.h
+//
+
+/// \file
+/// \brief Defines TransferProgram - the effect of the statements of a basic
+/// block on the abstract value as a list of Apron level-0 operations, built
+/// once per function and run on every later visit of the block
+///
+#include <stddef.h>
+#include <vector>
+
+#ifndef TRANSFERPROGRAM_H
+# define TRANSFERPROGRAM_H
+
+#include <ap_global1.h>
+
+/// \brief Kind of a transfer operation
+typedef enum TransferOpKind
+{
+  /// \brief Parallel assignment dims[i] := exprs[i]
+  TRANSFER_ASSIGN = 0,
+
+  /// \brief Forget (havoc) dims, e.g. temporaries after a statement
+  TRANSFER_FORGET = 1,
+
+  /// \brief Parallel assignment dims[i] := linexprs[i] of affine
+  /// expressions, linearized once when recorded
+  TRANSFER_ASSIGN_LINEAR = 2
+} TransferOpKind;
+
+/// \brief One operation of a transfer program
+typedef struct TransferOp
+{
+  /// \brief Kind of operation
+  TransferOpKind kind;
+
+  /// \brief Dimensions assigned or forgotten
+  std::vector<ap_dim_t> dims;
+
+  /// \brief Expressions of an assignment, one per dimension, owned by the
+  /// program (empty for forget)
+  std::vector<ap_texpr0_t *> exprs;
+
+  /// \brief Expressions of a linear assignment, one per dimension, owned
+  /// by the program (empty for other kinds)
+  std::vector<ap_linexpr0_t *> linexprs;
+} TransferOp;
+
+/// \brief Transfer program of the statements of a basic block
+///
+/// Operations are recorded while the statements are traversed for the
+/// first time (see startTransferRecording()) and are run in the same order
+/// on later visits, so iterations do not traverse the clang AST again.
+/// Dimensions are those of the environment of the function.
+class TransferProgram
+{
+  public:
+
+    /// \brief Create empty program
+    TransferProgram();
+
+    /// \brief Free expressions of the program
+    ~TransferProgram();
+
+    /// \brief Add parallel assignment, expressions are copied
+    /// @param dims - assigned dimensions
+    /// @param exprs - expressions (not owned)
+    /// @param size - number of assignments
+    /// @return void (nothing)
+    void addAssign(const ap_dim_t* dims, ap_texpr0_t** exprs, size_t size);
+
+    /// \brief Add parallel assignment of linear expressions, expressions
+    /// are copied
+    /// @param dims - assigned dimensions
+    /// @param linexprs - linear expressions (not owned)
+    /// @param size - number of assignments
+    /// @return void (nothing)
+    void addLinearAssign(const ap_dim_t* dims, ap_linexpr0_t** linexprs,
+      size_t size);
+
+    /// \brief Add forget of dimensions
+    /// @param dims - forgotten dimensions
+    /// @param size - number of dimensions
+    /// @return void (nothing)
+    void addForget(const ap_dim_t* dims, size_t size);
+
+    /// \brief Run the program on an abstract value (destructive)
+    /// @param man - Apron manager of value
+    /// @param absVal - abstract value on environment of the function
+    /// @return void (nothing)
+    void run(ap_manager_t* man, ap_abstract1_t* absVal) const;
+
+    /// \brief Get number of operations
+    /// @return size_t - number of operations
+    size_t size() const;
+
+    /// \brief Get an operation
+    /// @param index - index of operation in order of execution
+    /// @return const TransferOp& - operation (owned by the program)
+    const TransferOp& getOp(size_t index) const;
+
+  private:
+
+    /// \brief Operations in order of execution
+    std::vector<TransferOp> m_ops;
+
+    // Program owns its expressions, it must not be copied
+    TransferProgram(const TransferProgram&);
+    TransferProgram& operator=(const TransferProgram&);
+};
+
+#endif // TRANSFERPROGRAM_H
@@ -0,0 +1,236 @@
+//
+// WeakTopologicalOrder.cpp
+//
+
+/// \file
+/// \brief Defines WeakTopologicalOrder - Bourdoncle's weak topological
+/// ordering of CFG blocks, the order blocks are analyzed in
+///
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+#include "WeakTopologicalOrder.h"
+#include "AnalysisOutput.h"
+
+/// \brief Build ordering from loop-nesting forest, blocks not reachable
+/// from entry block are left out
+void WeakTopologicalOrder::build(const LoopForest& forest,
+  const EdgeIndex& edgeIndex, const std::vector<bool>& reachableBlocks)
+{
+  m_forest = &forest;
+  m_edgeIndex = &edgeIndex;
+  m_reachableBlocks = &reachableBlocks;
+  m_elements.clear();
+
+  t_loopStruct* root = forest.getRoot();
+
+  m_blocks.assign(edgeIndex.getNumBlocks(), NULL);
+
+  for (int i = 0; i < root->body.size(); i++)
+  {
+    m_blocks[root->body[i]->getBlockID()] = root->body[i];
+  }
+
+  m_mark.assign(edgeIndex.getNumBlocks(), 0);
+  m_markCount = 0;
+
+  appendLoop(root);
+}
+
+/// \brief Get elements
+const std::vector<WTOElement>& WeakTopologicalOrder::getElements() const
+{
+  return m_elements;
+}
+
+/// \brief Print ordering in Bourdoncle's notation, e.g. 5 (4 3 (2 1)) 0
+void WeakTopologicalOrder::print() const
+{
+  std::vector<int> ends;
+
+  for (int i = 0; i < m_elements.size(); i++)
+  {
+    while (!ends.empty() && ends.back() == i)
+    {
+      getOutStream() << ")";
+      ends.pop_back();
+    }
+
+    getOutStream() << " ";
+
+    if (m_elements[i].componentEnd)
+    {
+      getOutStream() << "(";
+      ends.push_back(m_elements[i].componentEnd);
+    }
+
+    getOutStream() << m_elements[i].block->getBlockID();
+  }
+
+  while (!ends.empty())
+  {
+    getOutStream() << ")";
+    ends.pop_back();
+  }
+}
+
+/// \brief Append elements of a loop, or of the function for the root
+void WeakTopologicalOrder::appendLoop(t_loopStruct* loop)
+{
+  bool isRoot = (loop->parent == NULL);
+  int headIndex = -1;
+
+  if (!isRoot)
+  {
+    WTOElement head;
+    head.block = loop->loopStart;
+    head.loop = loop;
+    head.componentEnd = 0;
+
+    headIndex = m_elements.size();
+    m_elements.push_back(head);
+  }
+
+  // reverse postorder of the body, DFS from header first; for the function
+  // it reaches all blocks reachable from entry block, the others are left
+  // out
+  int mark = ++m_markCount;
+  std::vector<unsigned> postorder;
+  std::vector<std::pair<unsigned, std::vector<unsigned> > > frames;
+  std::vector<unsigned> frameNext;
+
+  for (int i = 0; i < loop->body.size(); i++)
+  {
+    int start = getNode(loop->body[i], loop);
+
+    if (start < 0 || m_mark[start] == mark || !(*m_reachableBlocks)[start])
+    {
+      continue;
+    }
+
+    m_mark[start] = mark;
+    frames.push_back(std::make_pair((unsigned) start, std::vector<unsigned>()));
+    getSuccNodes(start, loop, frames.back().second);
+    frameNext.push_back(0);
+
+    while (!frames.empty())
+    {
+      unsigned node = frames.back().first;
+      std::vector<unsigned>& succs = frames.back().second;
+
+      if (frameNext.back() < succs.size())
+      {
+        unsigned succ = succs[frameNext.back()++];
+
+        if (m_mark[succ] != mark)
+        {
+          m_mark[succ] = mark;
+          frames.push_back(std::make_pair(succ, std::vector<unsigned>()));
+          getSuccNodes(succ, loop, frames.back().second);
+          frameNext.push_back(0);
+        }
+
+        continue;
+      }
+
+      postorder.push_back(node);
+      frames.pop_back();
+      frameNext.pop_back();
+    }
+  }
+
+  for (int i = postorder.size() - 1; i >= 0; i--)
+  {
+    clang::CFGBlock* block = m_blocks[postorder[i]];
+
+    if (!isRoot && block == loop->loopStart)
+    {
+      // header is already the head of the component
+      continue;
+    }
+
+    t_loopStruct* inner = m_forest->getInnermostLoop(block);
+
+    if (inner != loop)
+    {
+      // node is header of a nested loop
+      appendLoop(inner);
+    }
+    else
+    {
+      WTOElement element;
+      element.block = block;
+      element.loop = NULL;
+      element.componentEnd = 0;
+
+      m_elements.push_back(element);
+    }
+  }
+
+  if (headIndex >= 0)
+  {
+    m_elements[headIndex].componentEnd = m_elements.size();
+  }
+}
+
+/// \brief Get node of a block in the graph of a loop body
+int WeakTopologicalOrder::getNode(clang::CFGBlock* block,
+  t_loopStruct* loop) const
+{
+  t_loopStruct* inner = m_forest->getInnermostLoop(block);
+
+  if (inner == loop)
+  {
+    return block->getBlockID();
+  }
+
+  while (inner && inner->parent != loop)
+  {
+    inner = inner->parent;
+  }
+
+  return inner ? (int) inner->loopStart->getBlockID() : -1;
+}
+
+/// \brief Get successor nodes of a node in the graph of a loop body,
+/// edges back to loop header are left out
+void WeakTopologicalOrder::getSuccNodes(unsigned node, t_loopStruct* loop,
+  std::vector<unsigned>& succs) const
+{
+  clang::CFGBlock* block = m_blocks[node];
+  t_loopStruct* inner = m_forest->getInnermostLoop(block);
+
+  std::vector<edgeStruct *> edges;
+
+  if (inner == loop)
+  {
+    for (int i = 0; i < m_edgeIndex->getNumSuccEdges(node); i++)
+    {
+      edges.push_back(m_edgeIndex->getSuccEdge(node, i));
+    }
+  }
+  else
+  {
+    // nested loop is left through its exit edges only
+    edges = inner->exitEdges;
+  }
+
+  for (int i = 0; i < edges.size(); i++)
+  {
+    clang::CFGBlock* dest = edges[i]->destBlock;
+
+    if (dest == loop->loopStart)
+    {
+      continue;
+    }
+
+    int succ = getNode(dest, loop);
+
+    if (succ >= 0 && succ != (int) node &&
+        std::find(succs.begin(), succs.end(), (unsigned) succ) == succs.end())
+    {
+      succs.push_back(succ);
+    }
+  }
+}
@@ -0,0 +1,105 @@
+//
+// WeakTopologicalOrder.h
+//
+
+/// \file
+/// \brief Defines WeakTopologicalOrder - Bourdoncle's weak topological
+/// ordering of CFG blocks, the order blocks are analyzed in
+///
+#include <vector>
+
+#ifndef WEAKTOPOLOGICALORDER_H
+# define WEAKTOPOLOGICALORDER_H
+
+#include "MyASTVisitor.h"
+#include "EdgeIndex.h"
+#include "LoopForest.h"
+
+/// \brief Element of a weak topological ordering - a block, or the head of a
+/// component (loop) followed by the elements of the component
+typedef struct WTOElement
+{
+  /// \brief Block to be analyzed
+  clang::CFGBlock* block;
+
+  /// \brief Loop headed by block, NULL if block is no component head
+  t_loopStruct* loop;
+
+  /// \brief Index past the last element of the component headed by block,
+  /// 0 if block is no component head
+  int componentEnd;
+} WTOElement;
+
+/// \brief Weak topological ordering of the blocks of a CFG
+///
+/// Components are the loops of the loop-nesting forest, the head of a
+/// component is the loop header. Elements of a component (and of the
+/// function) are in topological order of the CFG without back edges, with
+/// nested loops collapsed, so every block comes after its predecessors
+/// except for predecessors on back edges to a component head.
+///
+/// Elements are stored flat, e.g. 5 (4 3 (2 1)) 0 is
+/// 5, 4 [end 5], 3, 2 [end 5], 1, 0.
+class WeakTopologicalOrder
+{
+  public:
+
+    /// \brief Build ordering from loop-nesting forest, blocks not reachable
+    /// from entry block are left out
+    /// @param forest - loop-nesting forest of CFG
+    /// @param edgeIndex - edges of CFG
+    /// @param reachableBlocks - bitset of block ids reachable from entry
+    /// @return void (nothing)
+    void build(const LoopForest& forest, const EdgeIndex& edgeIndex,
+      const std::vector<bool>& reachableBlocks);
+
+    /// \brief Get elements
+    /// @return const std::vector<WTOElement>& - elements in order
+    const std::vector<WTOElement>& getElements() const;
+
+    /// \brief Print ordering in Bourdoncle's notation, e.g. 5 (4 3 (2 1)) 0
+    /// @param none
+    /// @return void (nothing)
+    void print() const;
+
+  private:
+
+    /// \brief Append elements of a loop, or of the function for the root
+    /// @param loop - loop of forest
+    /// @return void (nothing)
+    void appendLoop(t_loopStruct* loop);
+
+    /// \brief Get node of a block in the graph of a loop body - the block
+    /// itself or header of the nested loop directly in loop containing it
+    /// @param block - block of loop body
+    /// @param loop - loop
+    /// @return int - block id of node, -1 if block is not in loop
+    int getNode(clang::CFGBlock* block, t_loopStruct* loop) const;
+
+    /// \brief Get successor nodes of a node in the graph of a loop body,
+    /// edges back to loop header are left out
+    /// @param node - block id of node
+    /// @param loop - loop
+    /// @param succs - filled with block ids of successor nodes
+    /// @return void (nothing)
+    void getSuccNodes(unsigned node, t_loopStruct* loop,
+      std::vector<unsigned>& succs) const;
+
+    /// \brief Loop-nesting forest, edges and reachable blocks of CFG
+    const LoopForest* m_forest;
+    const EdgeIndex* m_edgeIndex;
+    const std::vector<bool>* m_reachableBlocks;
+
+    /// \brief Elements in order
+    std::vector<WTOElement> m_elements;
+
+    /// \brief Blocks of CFG by block id
+    std::vector<clang::CFGBlock *> m_blocks;
+
+    /// \brief DFS visit mark of every block id, every appendLoop() uses
+    /// a new mark
+    std::vector<int> m_mark;
+    int m_markCount;
+};
+
+#endif // WEAKTOPOLOGICALORDER_H